@@ -0,0 +1,74 @@
+// Standard Library Includes
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// jpl_ephemeris includes
+#include <jpl_ephemeris.hpp>
+using namespace jpl_ephemeris;
+
+// Strong-scaling benchmark of BatchEphemeris: a fixed set of epochs is evaluated with 1..N threads, and the speedup and
+// parallel efficiency are reported relative to a single thread. The output of every run is checked against the
+// single-threaded output, which must match exactly.
+//
+// Usage: ./batch_scaling.exe [num_epochs] [max_threads]
+
+double time_states(BatchEphemeris& batch, CentralBody target, const std::vector<double>& epochs,
+                   std::vector<std::array<double, 6>>& states) {
+    auto start = std::chrono::high_resolution_clock::now();
+    batch.get_states(target, epochs.data(), epochs.size(), states.data());
+    auto stop = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() * 1e-9;
+}
+
+int main(int argc, char** argv) {
+    size_t num_epochs        = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+    unsigned int max_threads = argc > 2 ? std::atoi(argv[2]) : std::max(std::thread::hardware_concurrency(), 1u);
+
+    // Epochs spread over ten years, as for a catalogue screening run
+    std::vector<double> epochs(num_epochs);
+    for (size_t k = 0; k < num_epochs; k++) {
+        epochs[k] = 3650.0 * k / num_epochs;
+    }
+
+    for (CentralBody target : {CentralBody::Moon, CentralBody::Sun}) {
+        std::cout << (target == CentralBody::Moon ? "Moon" : "Sun") << " states relative to the Earth, " << num_epochs
+                  << " epochs\n";
+        std::cout << std::setw(8) << "threads" << std::setw(14) << "time (sec)" << std::setw(14) << "ns/epoch"
+                  << std::setw(10) << "speedup" << std::setw(12) << "efficiency" << std::setw(10) << "match"
+                  << "\n";
+
+        std::vector<std::array<double, 6>> reference(num_epochs);
+        std::vector<std::array<double, 6>> states(num_epochs);
+        double base_time = 0.;
+
+        for (unsigned int num_threads = 1; num_threads <= max_threads; num_threads++) {
+            BatchEphemeris batch(num_threads);
+
+            // Warm up the pool and the page cache, then keep the best of three runs
+            time_states(batch, target, epochs, states);
+            double duration = time_states(batch, target, epochs, states);
+            for (int k = 0; k < 2; k++) {
+                duration = std::min(duration, time_states(batch, target, epochs, states));
+            }
+
+            if (num_threads == 1) {
+                base_time = duration;
+                reference = states;
+            }
+            bool match = std::memcmp(reference.data(), states.data(), num_epochs * sizeof(states[0])) == 0;
+
+            std::cout << std::setw(8) << num_threads << std::setw(14) << std::setprecision(5) << duration
+                      << std::setw(14) << duration * 1e9 / num_epochs << std::setw(10) << base_time / duration
+                      << std::setw(12) << base_time / duration / num_threads << std::setw(10)
+                      << (match ? "yes" : "NO") << "\n";
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -1,4 +1,5 @@
 // Standard Library Includes
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <iomanip>
@@ -196,6 +197,78 @@ void accuracy_test(double mjdj2k_tdb, double step, const std::array<CentralBody,
 
 //--------------------------------------------------------------------------------------------------------------------------
 
+void apparent_accuracy_test(double mjdj2k_tdb, double step, double err_tol = 1e-6) {
+    // Compare the light-time and stellar aberration corrected positions of the Sun and Moon as seen from the Earth
+    const std::array<std::pair<AberrationCorrection, std::string>, 4> corrections{
+        std::pair<AberrationCorrection, std::string>{AberrationCorrection::LT, "LT"},
+        std::pair<AberrationCorrection, std::string>{AberrationCorrection::LT_S, "LT+S"},
+        std::pair<AberrationCorrection, std::string>{AberrationCorrection::CN, "CN"},
+        std::pair<AberrationCorrection, std::string>{AberrationCorrection::CN_S, "CN+S"}};
+
+    ApparentEphemeris apparent;
+    double max_err = 0.;
+    double max_lt_err = 0.;
+    while (mjdj2k_tdb <= 35000) {
+        for (const auto& [correction, abcorr] : corrections) {
+            for (CentralBody tgt_body : {CentralBody::Sun, CentralBody::Moon}) {
+                SpiceDouble cspice_pos[3];
+                SpiceDouble cspice_lt;
+                spkpos_c(tgt_body == CentralBody::Sun ? "SUN" : "MOON", mjdj2k_tdb * 86400.0, "J2000", abcorr.c_str(),
+                         "EARTH", cspice_pos, &cspice_lt);
+
+                ApparentPosition jpl_ephem = apparent.get_position(tgt_body, mjdj2k_tdb, CentralBody::Earth, correction);
+
+                double err = compute_error({cspice_pos[0], cspice_pos[1], cspice_pos[2]}, jpl_ephem.position);
+                max_err    = std::max(max_err, err);
+                max_lt_err = std::max(max_lt_err, std::abs(cspice_lt - jpl_ephem.light_time));
+
+                if (err > err_tol) {
+                    std::cout << "mjdj2k_tdb = " << mjdj2k_tdb << ", abcorr = " << abcorr
+                              << ", tgt_body = " << to_string(tgt_body) << "\n";
+                    print_array("cspice_pos", {cspice_pos[0], cspice_pos[1], cspice_pos[2]});
+                    print_array("jpl_ephem_pos", jpl_ephem.position);
+                    std::cout << "err = " << err << "\n\n";
+                }
+            }
+        }
+
+        mjdj2k_tdb += step;
+    }
+
+    std::cout << "Apparent positions: max error = " << max_err << " km, max light time error = " << max_lt_err
+              << " sec\n\n";
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void record_apparent_reference(const std::string& reference_file) {
+    // Record spkpos_c results for the offline apparent-position test, which runs without CSPICE
+    const std::array<double, 8> epochs{0.0, 1000.25, 5000.5, 9131.75, 12345.125, 18262.5, 27393.75, 36000.0};
+
+    std::ofstream out(reference_file);
+    if (!out) {
+        throw std::invalid_argument("record_apparent_reference() - Unable to open " + reference_file);
+    }
+    out << "Apparent positions of the Sun and Moon from the Earth in the J2000 frame, recorded with spkpos_c from\n"
+        << "de430_1850-2150.bsp by the cspice_comparison example (" << tkvrsn_c("TOOLKIT") << ").\n"
+        << "Columns: mjdj2k_tdb target abcorr x [km] y [km] z [km] lt [sec]\n"
+        << "EOT\n";
+    out << std::setprecision(17);
+    for (double mjdj2k_tdb : epochs) {
+        for (const char* target : {"SUN", "MOON"}) {
+            for (const char* abcorr : {"LT", "LT+S"}) {
+                SpiceDouble pos[3];
+                SpiceDouble lt;
+                spkpos_c(target, mjdj2k_tdb * 86400.0, "J2000", abcorr, "EARTH", pos, &lt);
+                out << mjdj2k_tdb << " " << target << " " << abcorr << " " << pos[0] << " " << pos[1] << " " << pos[2]
+                    << " " << lt << "\n";
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
 void compute_runtimes(double mjdj2k_tdb_0, double step, const std::array<CentralBody, 3>& target_bodies, 
                    const std::array<CentralBody, 4>& central_bodies, double err_tol = 1e-6) {
 
@@ -302,10 +375,17 @@ void compute_sun_position_runtime() {
 
 //--------------------------------------------------------------------------------------------------------------------------
 
-int main() {
+int main(int argc, char** argv) {
     // Load in the SPK kernel from https://ssd.jpl.nasa.gov/ftp/eph/planets/bsp/
     furnsh_c("src/de430_1850-2150.bsp");
 
+    // Only record the reference values of the apparent-position test, e.g.
+    // --record ../../jpl_ephemeris_data/de_430/apparent.430
+    if (argc == 3 && std::string(argv[1]) == "--record") {
+        record_apparent_reference(argv[2]);
+        return 0;
+    }
+
     // Set inputs
     double mjdj2k_tdb = 0.0;
     double step = 1000; 
@@ -314,6 +394,7 @@ int main() {
 
     // Run the accuracy test
     accuracy_test(mjdj2k_tdb, step, target_bodies, central_bodies);
+    apparent_accuracy_test(mjdj2k_tdb, step);
 
     // Now compute runtimes
     compute_runtimes(mjdj2k_tdb, 100, target_bodies, central_bodies);
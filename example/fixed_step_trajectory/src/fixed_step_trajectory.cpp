@@ -0,0 +1,61 @@
+// Standard Library Includes
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// jpl_ephemeris includes
+#include <jpl_ephemeris.hpp>
+using namespace jpl_ephemeris;
+
+// Compares the 30 second Moon loop of the moon_position example against a FixedStepTrajectory over the same epochs, and
+// reports the drift of the incremental evaluation against direct evaluation.
+
+const unsigned int NUM_STEPS = 1000000;
+const double STEP_SEC        = 30.0;
+
+void time_direct() {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    double sum = 0.;
+    for (unsigned int k = 0; k < NUM_STEPS; k++) {
+        double mjdj2k_tdb = k * STEP_SEC / 86400.0;
+        std::array<double, 3> pos = Moon::get_position(mjdj2k_tdb);
+        std::array<double, 3> vel = Moon::get_velocity(mjdj2k_tdb);
+        sum += pos[0] + vel[0];
+    }
+
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() * 1e-9;
+    std::cout << std::setprecision(5) << "direct Moon::get_position/get_velocity (sec) = " << duration << " (" << sum
+              << ")\n";
+}
+
+void time_trajectory() {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    double sum = 0.;
+    FixedStepTrajectory trajectory(CentralBody::Moon, 0.0, STEP_SEC, NUM_STEPS);
+    for (const TrajectoryPoint& point : trajectory) {
+        sum += point.state[0] + point.state[3];
+    }
+
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() * 1e-9;
+    std::cout << std::setprecision(5) << "FixedStepTrajectory (sec) = " << duration << " (" << sum << "), "
+              << trajectory.get_num_resets() << " granule resets\n";
+}
+
+int main() {
+    time_direct();
+    time_trajectory();
+
+    for (CentralBody target : {CentralBody::Moon, CentralBody::Sun}) {
+        FixedStepTrajectory trajectory(target, 0.0, STEP_SEC, NUM_STEPS);
+        TrajectoryDrift drift = trajectory.measure_drift();
+        std::cout << (target == CentralBody::Moon ? "Moon" : "Sun") << " drift over " << drift.num_samples
+                  << " steps: max position = " << drift.max_position_error << " km, rms position = "
+                  << drift.rms_position_error << " km, max velocity = " << drift.max_velocity_error << " km/s\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Standard Library Includes
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+// jpl_ephemeris includes
+#include <jpl_ephemeris.hpp>
+using namespace jpl_ephemeris;
+
+// Tail latency of random-epoch Moon queries for each residency mode. Every mode runs in a freshly forked child, before
+// any table has been touched in that process, so first-touch page faults show up in the modes that do not prefault.
+//
+// Usage: ./residency_latency.exe [num_queries] [lock (0 or 1)]
+
+struct Mode {
+    const char* name;
+    bool copy;
+    ResidencyOptions options;
+};
+
+// Keeps the compiler from discarding the queries
+volatile double sink = 0.;
+
+void run_mode(const Mode& mode, size_t num_queries) {
+    std::unique_ptr<ResidentTables> resident;
+    ResidencyReport report;
+    if (mode.copy) {
+        resident = std::make_unique<ResidentTables>(mode.options);
+        report   = resident->get_report();
+    } else if (mode.options.prefault || mode.options.lock) {
+        report = make_compiled_tables_resident(mode.options);
+    }
+
+    EphemerisContext context = resident ? EphemerisContext(resident->get_tables()) : EphemerisContext();
+
+    // Spread the epochs over the whole Moon table, so the queries land on pages that have not been touched yet
+    const EphemerisTableView moon = EphemerisTableSet::get_compiled_in().moon;
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(moon.start_mjdj2k, moon.stop_mjdj2k);
+
+    std::vector<int64_t> latency(num_queries);
+    for (size_t k = 0; k < num_queries; k++) {
+        double t   = dist(rng);
+        auto start = std::chrono::steady_clock::now();
+        std::array<double, 6> state = context.get_state(CentralBody::Moon, t);
+        auto stop  = std::chrono::steady_clock::now();
+        sink = state[0];
+        latency[k] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    }
+    std::sort(latency.begin(), latency.end());
+
+    auto percentile = [&](double p) { return latency[static_cast<size_t>(p * (num_queries - 1))]; };
+    std::cout << std::setw(22) << mode.name << std::setw(10) << percentile(0.5) << std::setw(10) << percentile(0.99)
+              << std::setw(10) << percentile(0.999) << std::setw(12) << latency.back() << "   "
+              << (mode.options.prefault || mode.options.lock || mode.copy ? report.to_string() : "-") << "\n";
+}
+
+int main(int argc, char** argv) {
+    size_t num_queries = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    bool lock          = argc > 2 && std::atoi(argv[2]) != 0;
+
+    const Mode modes[] = {
+        {"baseline", false, ResidencyOptions{HugePageMode::None, true, false, false}},
+        {"in-place prefault", false, ResidencyOptions{HugePageMode::None, true, true, lock}},
+        {"copy, regular pages", true, ResidencyOptions{HugePageMode::None, true, true, lock}},
+        {"copy, transparent", true, ResidencyOptions{HugePageMode::Transparent, true, true, lock}},
+        {"copy, explicit", true, ResidencyOptions{HugePageMode::Explicit, true, true, lock}},
+    };
+
+    std::cout << "Moon state latency over " << num_queries << " random epochs [ns]\n";
+    std::cout << std::setw(22) << "mode" << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(12) << "max" << "   residency\n";
+    std::cout << std::flush;
+
+    for (const Mode& mode : modes) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            run_mode(mode, num_queries);
+            std::cout << std::flush;
+            _exit(0);
+        }
+        waitpid(pid, nullptr, 0);
+    }
+
+    return 0;
+}
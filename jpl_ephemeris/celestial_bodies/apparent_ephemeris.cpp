@@ -0,0 +1,157 @@
+#include "apparent_ephemeris.hpp"
+
+// standard library includes
+#include <cmath>
+#include <stdexcept>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Speed of light [km/s]
+constexpr double speed_of_light = DEConstants::clight;
+
+//! Number of seconds per day
+constexpr double sec_per_day = 86400.0;
+
+//! Return the Euclidean norm of vec
+double norm(const std::array<double, 3>& vec) {
+    return std::sqrt(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]);
+}
+
+}  // End anonymous namespace
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+
+std::array<double, 3> apply_stellar_aberration(const std::array<double, 3>& position,
+                                               const std::array<double, 3>& observer_velocity) {
+    double dist = norm(position);
+    if (dist == 0.) {
+        return position;
+    }
+
+    std::array<double, 3> u{position[0] / dist, position[1] / dist, position[2] / dist};
+    std::array<double, 3> v{observer_velocity[0] / speed_of_light, observer_velocity[1] / speed_of_light,
+                            observer_velocity[2] / speed_of_light};
+
+    // The rotation axis is u x v, and its length is the sine of the aberration angle
+    std::array<double, 3> axis{u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+    double sin_phi = norm(axis);
+    if (sin_phi == 0.) {
+        return position;
+    }
+
+    for (double& val : axis) {
+        val /= sin_phi;
+    }
+
+    // Rotate the position about the axis by phi (Rodrigues' formula)
+    double phi     = std::asin(sin_phi);
+    double cos_phi = std::cos(phi);
+    double dot     = axis[0] * position[0] + axis[1] * position[1] + axis[2] * position[2];
+    std::array<double, 3> cross{axis[1] * position[2] - axis[2] * position[1],
+                                axis[2] * position[0] - axis[0] * position[2],
+                                axis[0] * position[1] - axis[1] * position[0]};
+
+    std::array<double, 3> apparent{0., 0., 0.};
+    for (int k = 0; k < 3; k++) {
+        apparent[k] = position[k] * cos_phi + cross[k] * sin_phi + axis[k] * dot * (1. - cos_phi);
+    }
+    return apparent;
+}
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+ApparentEphemeris::ApparentEphemeris() : context_() {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ApparentEphemeris::ApparentEphemeris(const EphemerisTableSet& tables) : context_(tables) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+ApparentPosition ApparentEphemeris::get_position(CentralBody target, double mjdj2k_tdb, CentralBody observer,
+                                                 AberrationCorrection correction) {
+    return get_position(target, mjdj2k_tdb, observer, std::array<double, 6>{0., 0., 0., 0., 0., 0.}, correction);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ApparentPosition ApparentEphemeris::get_position(CentralBody target, double mjdj2k_tdb, CentralBody observer,
+                                                 const std::array<double, 6>& observer_offset,
+                                                 AberrationCorrection correction) {
+    int num_iterations = 0;
+    bool stellar       = false;
+    switch (correction) {
+        case AberrationCorrection::None: {
+            break;
+        }
+        case AberrationCorrection::LT: {
+            num_iterations = 1;
+            break;
+        }
+        case AberrationCorrection::LT_S: {
+            num_iterations = 1;
+            stellar        = true;
+            break;
+        }
+        case AberrationCorrection::CN: {
+            num_iterations = max_converged_iterations_;
+            break;
+        }
+        case AberrationCorrection::CN_S: {
+            num_iterations = max_converged_iterations_;
+            stellar        = true;
+            break;
+        }
+        default: {
+            throw std::invalid_argument(
+                "ApparentEphemeris::get_position() - Unexpected input provided for AberrationCorrection");
+        }
+    }
+
+    // State of the observer relative to the SSB at the epoch of observation
+    std::array<double, 6> observer_ssb = context_.get_state(observer, mjdj2k_tdb, CentralBody::SSB);
+    for (int k = 0; k < 6; k++) {
+        observer_ssb[k] += observer_offset[k];
+    }
+
+    auto position_at = [&](double emission_mjdj2k_tdb) {
+        std::array<double, 3> target_ssb = context_.get_position(target, emission_mjdj2k_tdb, CentralBody::SSB);
+        return std::array<double, 3>{target_ssb[0] - observer_ssb[0], target_ssb[1] - observer_ssb[1],
+                                     target_ssb[2] - observer_ssb[2]};
+    };
+
+    ApparentPosition apparent;
+    apparent.position   = position_at(mjdj2k_tdb);
+    apparent.light_time = norm(apparent.position) / speed_of_light;
+
+    // Each iteration moves the target back to the emission epoch implied by the previous light time
+    for (int iter = 0; iter < num_iterations; iter++) {
+        double prev_light_time = apparent.light_time;
+        apparent.position      = position_at(mjdj2k_tdb - prev_light_time / sec_per_day);
+        apparent.light_time    = norm(apparent.position) / speed_of_light;
+
+        if (apparent.light_time == prev_light_time) {
+            break;
+        }
+    }
+
+    if (stellar) {
+        apparent.position =
+            apply_stellar_aberration(apparent.position, {observer_ssb[3], observer_ssb[4], observer_ssb[5]});
+    }
+
+    return apparent;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,138 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_APPARENT_EPHEMERIS_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_APPARENT_EPHEMERIS_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/apparent_ephemeris.hpp
+ * \brief Defines a class for computing light-time and stellar aberration corrected (apparent) positions
+ */
+
+// standard library includes
+#include <array>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies the aberration correction applied to a position, following the abcorr values of CSPICE (reception case)
+enum class AberrationCorrection : int {
+    None = 0,  //!< Geometric position, equivalent to "NONE"
+    LT = 1,    //!< One-way light time from a single iteration, equivalent to "LT"
+    LT_S = 2,  //!< Light time from a single iteration and stellar aberration, equivalent to "LT+S"
+    CN = 3,    //!< Converged Newtonian light time, equivalent to "CN"
+    CN_S = 4,  //!< Converged Newtonian light time and stellar aberration, equivalent to "CN+S"
+};
+
+//! Position of a target as seen by an observer, along with the one-way light time
+struct ApparentPosition {
+    //! Position of the target relative to the observer in the GCRF frame [km]
+    std::array<double, 3> position{0., 0., 0.};
+
+    //! One-way light time from the target to the observer [sec]
+    double light_time = 0.;
+};
+
+/*!
+ * \brief Correct a light-time corrected position for the stellar aberration due to the velocity of the observer
+ *
+ * \details The position is rotated toward the observer velocity by the angle asin(|u x v / c|), where u is the unit
+ * vector along the position, which matches stelab_c in CSPICE.
+ *
+ * \param position Light-time corrected position of the target relative to the observer [km]
+ * \param observer_velocity Velocity of the observer relative to the SSB [km/s]
+ *
+ * \return Apparent position of the target relative to the observer [km]
+ */
+std::array<double, 3> apply_stellar_aberration(const std::array<double, 3>& position,
+                                               const std::array<double, 3>& observer_velocity);
+
+/*!
+ * \brief Defines a class for computing light-time and stellar aberration corrected (apparent) positions
+ *
+ * \details The observer state is evaluated once with the fused position/velocity evaluation, and each light-time
+ * iteration re-evaluates only the position of the target, which lands in the granules cached by the first evaluation, so
+ * an iteration costs one Clenshaw pass per table. Like EphemerisContext, every query updates the cache, so each thread
+ * needs its own instance, e.g.
+ *
+ *     ApparentEphemeris apparent;
+ *     ApparentPosition sun = apparent.get_position(CentralBody::Sun, mjdj2k_tdb, CentralBody::Earth,
+ *                                                  AberrationCorrection::LT_S);
+ */
+class ApparentEphemeris {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an instance that evaluates the compiled-in tables
+        ApparentEphemeris();
+
+        /*!
+         * \brief Create an instance that evaluates the specified tables
+         *
+         * \param tables Views of the tables. The coefficients must remain valid for the lifetime of this object.
+         */
+        explicit ApparentEphemeris(const EphemerisTableSet& tables);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position of the target as seen from the center of the observer body
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch of the observation, in the TDB Time System
+         * \param observer Body at whose center the observation is made
+         * \param correction Aberration correction to apply
+         *
+         * \return Position of the target relative to the observer in the GCRF frame [km], and the one-way light time [sec]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target, observer, or correction
+         * \throws std::out_of_range If mjdj2k_tdb, or the epoch of emission, is outside of the range covered by the tables
+         */
+        ApparentPosition get_position(CentralBody target, double mjdj2k_tdb, CentralBody observer = CentralBody::Earth,
+                                      AberrationCorrection correction = AberrationCorrection::LT_S);
+
+        /*!
+         * \brief Return the position of the target as seen from an observer offset from the center of a body, e.g. a sensor
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch of the observation, in the TDB Time System
+         * \param observer Body that the observer offset is measured relative to
+         * \param observer_offset Position [km] and velocity [km/s] of the observer relative to the observer body in the GCRF
+         *     frame, stacked as [x, y, z, vx, vy, vz]
+         * \param correction Aberration correction to apply
+         *
+         * \return Position of the target relative to the observer in the GCRF frame [km], and the one-way light time [sec]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target, observer, or correction
+         * \throws std::out_of_range If mjdj2k_tdb, or the epoch of emission, is outside of the range covered by the tables
+         */
+        ApparentPosition get_position(CentralBody target, double mjdj2k_tdb, CentralBody observer,
+                                      const std::array<double, 6>& observer_offset, AberrationCorrection correction);
+
+        //! Return the context used to evaluate the tables, e.g. to read its hit and miss counters
+        const EphemerisContext& get_context() const {
+            return context_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Maximum number of light-time iterations for the converged Newtonian corrections, as used by CSPICE
+        static constexpr int max_converged_iterations_ = 3;
+
+        //! Cache of the last granule of each table
+        EphemerisContext context_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,222 @@
+#include "batch_ephemeris.hpp"
+
+// standard library includes
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Default minimum number of epochs per chunk
+const size_t DEFAULT_MIN_CHUNK_SIZE = 1024;
+
+//! Number of chunks created per thread, so that stealing can balance uneven chunks
+const size_t CHUNKS_PER_THREAD = 8;
+
+//! Number of chunks targeted when running on a caller-supplied executor, whose concurrency is unknown
+const size_t EXECUTOR_NUM_CHUNKS = 256;
+
+//! Range of epoch indices [begin, end), in time order, evaluated by one task
+struct Chunk {
+    //! First position in time order
+    size_t begin = 0;
+
+    //! One past the last position in time order
+    size_t end = 0;
+};
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+BatchEphemeris::BatchEphemeris(unsigned int num_threads) :
+    pool_(std::make_shared<ThreadPool>(num_threads)), executor_(), min_chunk_size_(DEFAULT_MIN_CHUNK_SIZE) {
+    std::shared_ptr<ThreadPool> pool = pool_;
+    executor_ = [pool](size_t num_tasks, const std::function<void(size_t)>& task) { pool->run(num_tasks, task); };
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+BatchEphemeris::BatchEphemeris(BatchExecutor executor) :
+    pool_(), executor_(std::move(executor)), min_chunk_size_(DEFAULT_MIN_CHUNK_SIZE) {
+    if (!executor_) {
+        throw std::invalid_argument("BatchEphemeris() - The provided executor is empty.");
+    }
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void BatchEphemeris::get_positions(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                                   std::array<double, 3>* positions, CentralBody central_body) {
+    run_batch(
+        mjdj2k_tdb, num_epochs, positions,
+        [&](EphemerisContext& context, double t) { return context.get_position(target, t, central_body); },
+        "BatchEphemeris::get_positions()");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void BatchEphemeris::get_velocities(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                                    std::array<double, 3>* velocities, CentralBody central_body) {
+    run_batch(
+        mjdj2k_tdb, num_epochs, velocities,
+        [&](EphemerisContext& context, double t) { return context.get_velocity(target, t, central_body); },
+        "BatchEphemeris::get_velocities()");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void BatchEphemeris::get_states(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                                std::array<double, 6>* states, CentralBody central_body) {
+    run_batch(
+        mjdj2k_tdb, num_epochs, states,
+        [&](EphemerisContext& context, double t) { return context.get_state(target, t, central_body); },
+        "BatchEphemeris::get_states()");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 3>> BatchEphemeris::get_positions(CentralBody target,
+                                                                 const std::vector<double>& mjdj2k_tdb,
+                                                                 CentralBody central_body) {
+    std::vector<std::array<double, 3>> positions(mjdj2k_tdb.size());
+    get_positions(target, mjdj2k_tdb.data(), mjdj2k_tdb.size(), positions.data(), central_body);
+    return positions;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 3>> BatchEphemeris::get_velocities(CentralBody target,
+                                                                  const std::vector<double>& mjdj2k_tdb,
+                                                                  CentralBody central_body) {
+    std::vector<std::array<double, 3>> velocities(mjdj2k_tdb.size());
+    get_velocities(target, mjdj2k_tdb.data(), mjdj2k_tdb.size(), velocities.data(), central_body);
+    return velocities;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 6>> BatchEphemeris::get_states(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                              CentralBody central_body) {
+    std::vector<std::array<double, 6>> states(mjdj2k_tdb.size());
+    get_states(target, mjdj2k_tdb.data(), mjdj2k_tdb.size(), states.data(), central_body);
+    return states;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void BatchEphemeris::set_min_chunk_size(size_t min_chunk_size) {
+    if (min_chunk_size == 0) {
+        throw std::invalid_argument("BatchEphemeris::set_min_chunk_size() - Minimum chunk size must be greater than "
+                                    "zero.");
+    }
+    min_chunk_size_ = min_chunk_size;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+template<class Vector, class Evaluate>
+void BatchEphemeris::run_batch(const double* mjdj2k_tdb, size_t num_epochs, Vector* out, const Evaluate& evaluate,
+                               const char* caller) {
+    if (num_epochs == 0) {
+        return;
+    }
+
+    // Check every epoch up front, so the chunks cannot fail part way through. The negated comparison also rejects NaN.
+    const EphemerisTableView moon = MoonGCRFTable::get_table_view();
+    double start_mjdj2k = std::max({moon.start_mjdj2k, SunFromSSBGCRFTable::get_table_view().start_mjdj2k,
+                                    EMBFromSSBGCRFTable::get_table_view().start_mjdj2k,
+                                    EarthFromEMBGCRFTable::get_table_view().start_mjdj2k});
+    double stop_mjdj2k = std::min({moon.stop_mjdj2k, SunFromSSBGCRFTable::get_table_view().stop_mjdj2k,
+                                   EMBFromSSBGCRFTable::get_table_view().stop_mjdj2k,
+                                   EarthFromEMBGCRFTable::get_table_view().stop_mjdj2k});
+    for (size_t i = 0; i < num_epochs; i++) {
+        if (!(mjdj2k_tdb[i] >= start_mjdj2k && mjdj2k_tdb[i] <= stop_mjdj2k)) {
+            JPL_EPHEMERIS_RECORD(record_event(InstrumentedEvent::BatchOutOfRange));
+            throw std::out_of_range(std::string(caller) + " - Value provided for mjdj2k is outside of the valid range "
+                                    "for the Chebyshev polynomial coefficients.");
+        }
+    }
+
+    JPL_EPHEMERIS_RECORD(record_batch(num_epochs));
+
+    // Evaluate the first epoch on the calling thread, which throws for an unexpected CentralBody
+    {
+        EphemerisContext context;
+        out[0] = evaluate(context, mjdj2k_tdb[0]);
+    }
+
+    // Visit the epochs in time order, only building a permutation when the input is not already sorted
+    std::vector<size_t> order;
+    if (!std::is_sorted(mjdj2k_tdb, mjdj2k_tdb + num_epochs)) {
+        order.resize(num_epochs);
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(),
+                         [&](size_t a, size_t b) { return mjdj2k_tdb[a] < mjdj2k_tdb[b]; });
+    }
+    auto epoch_index = [&](size_t pos) { return order.empty() ? pos : order[pos]; };
+
+    // Split the epochs into chunks that end on a Moon granule boundary, when one is close enough
+    size_t num_chunks_target = pool_ ? CHUNKS_PER_THREAD * pool_->get_num_threads() : EXECUTOR_NUM_CHUNKS;
+    size_t chunk_size        = std::max(min_chunk_size_, (num_epochs + num_chunks_target - 1) / num_chunks_target);
+
+    std::vector<Chunk> chunks;
+    size_t begin = 0;
+    while (begin < num_epochs) {
+        size_t end = std::min(begin + chunk_size, num_epochs);
+        size_t max_end = std::min(begin + 2 * chunk_size, num_epochs);
+
+        unsigned int granule = moon.get_index(mjdj2k_tdb[epoch_index(end - 1)]);
+        size_t boundary      = end;
+        while (boundary < max_end && moon.get_index(mjdj2k_tdb[epoch_index(boundary)]) == granule) {
+            boundary++;
+        }
+        if (boundary < max_end || boundary == num_epochs) {
+            end = boundary;
+        }
+
+        chunks.push_back(Chunk{begin, end});
+        begin = end;
+    }
+
+    // Evaluate each chunk with its own granule cache
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    executor_(chunks.size(), [&](size_t ind) {
+        try {
+            EphemerisContext context;
+            for (size_t pos = chunks[ind].begin; pos < chunks[ind].end; pos++) {
+                size_t i = epoch_index(pos);
+                out[i]   = evaluate(context, mjdj2k_tdb[i]);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace jpl_ephemeris
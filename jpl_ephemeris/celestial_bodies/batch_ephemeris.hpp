@@ -0,0 +1,175 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_BATCH_EPHEMERIS_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_BATCH_EPHEMERIS_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/batch_ephemeris.hpp
+ * \brief Defines a class for evaluating the position/velocity of the Sun, Earth, and Moon at many epochs in parallel
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/parallel/thread_pool.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Caller-supplied executor, which must call task(0), ..., task(num_tasks - 1) exactly once each, in any order and on
+ * any threads, and return once all of them have completed
+ */
+using BatchExecutor = std::function<void(size_t num_tasks, const std::function<void(size_t)>& task)>;
+
+/*!
+ * \brief Defines a class for evaluating the position/velocity of the Sun, Earth, and Moon at many epochs in parallel
+ *
+ * \details The epochs are visited in time order (they are sorted internally when the input is not already sorted) and
+ * split into chunks whose boundaries fall on the 4-day Moon granules, which are also boundaries of the 16-day Sun and EMB
+ * granules. Each chunk is evaluated with its own EphemerisContext, so a chunk only looks up each granule once. Results
+ * are always written to the position of their epoch in the input, and every result is computed by the same arithmetic
+ * however the chunks are scheduled, so the output is identical for any number of threads.
+ *
+ * Work is run on an internal work-stealing ThreadPool, or on a caller-supplied BatchExecutor (e.g. wrapping an existing
+ * task scheduler).
+ */
+class BatchEphemeris {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create a batch engine with its own thread pool
+         *
+         * \param num_threads Total number of threads, including the calling thread. Zero uses the number of hardware
+         *     threads.
+         */
+        explicit BatchEphemeris(unsigned int num_threads = 0);
+
+        /*!
+         * \brief Create a batch engine that runs its chunks on a caller-supplied executor
+         *
+         * \param executor Executor used to run the chunks
+         *
+         * \throws std::invalid_argument If executor is empty
+         */
+        explicit BatchEphemeris(BatchExecutor executor);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute the position of the target body relative to the specified CentralBody at each epoch
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param positions Output positions in the GCRF frame [km], one per epoch in the same order
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         */
+        void get_positions(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                           std::array<double, 3>* positions, CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Compute the velocity of the target body relative to the specified CentralBody at each epoch
+         *
+         * \param target Body whose velocity is computed
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param velocities Output velocities in the GCRF frame [km/s], one per epoch in the same order
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         */
+        void get_velocities(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                            std::array<double, 3>* velocities, CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Compute the position and velocity of the target body relative to the specified CentralBody at each epoch
+         *
+         * \param target Body whose state is computed
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param states Output states in the GCRF frame, stacked as [x, y, z, vx, vy, vz] in [km] and [km/s], one per
+         *     epoch in the same order
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         */
+        void get_states(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs, std::array<double, 6>* states,
+                        CentralBody central_body = CentralBody::Earth);
+
+        //! \copydoc get_positions(CentralBody, const double*, size_t, std::array<double, 3>*, CentralBody)
+        std::vector<std::array<double, 3>> get_positions(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                         CentralBody central_body = CentralBody::Earth);
+
+        //! \copydoc get_velocities(CentralBody, const double*, size_t, std::array<double, 3>*, CentralBody)
+        std::vector<std::array<double, 3>> get_velocities(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                          CentralBody central_body = CentralBody::Earth);
+
+        //! \copydoc get_states(CentralBody, const double*, size_t, std::array<double, 6>*, CentralBody)
+        std::vector<std::array<double, 6>> get_states(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                      CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Set the minimum number of epochs per chunk
+         *
+         * \param min_chunk_size Minimum number of epochs per chunk, which must be greater than zero
+         *
+         * \throws std::invalid_argument If min_chunk_size is zero
+         */
+        void set_min_chunk_size(size_t min_chunk_size);
+
+        //! Return the minimum number of epochs per chunk
+        size_t get_min_chunk_size() const {
+            return min_chunk_size_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Split the epochs into chunks, evaluate each chunk on the executor, and scatter the results
+         *
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param out Output values, one per epoch
+         * \param evaluate Callable evaluating one epoch with an EphemerisContext
+         * \param caller Name of the calling method, used in exception messages
+         */
+        template<class Vector, class Evaluate>
+        void run_batch(const double* mjdj2k_tdb, size_t num_epochs, Vector* out, const Evaluate& evaluate,
+                       const char* caller);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Thread pool owned by this object, when no executor was supplied
+        std::shared_ptr<ThreadPool> pool_;
+
+        //! Executor used to run the chunks
+        BatchExecutor executor_;
+
+        //! Minimum number of epochs per chunk
+        size_t min_chunk_size_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
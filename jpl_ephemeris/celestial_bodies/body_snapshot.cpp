@@ -0,0 +1,72 @@
+#include "body_snapshot.hpp"
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/shared_basis_evaluator.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Index of each compiled-in table passed to the SharedBasisEvaluator
+enum TableIndex : unsigned int {
+    SUN_FROM_SSB   = 0,
+    EMB_FROM_SSB   = 1,
+    EARTH_FROM_EMB = 2,
+    MOON           = 3,
+    NUM_TABLES     = 4,
+};
+
+//! Return the evaluator over the compiled-in tables, which is constructed on first use
+const SharedBasisEvaluator& get_evaluator() {
+    static const SharedBasisEvaluator evaluator({SunFromSSBGCRFTable::get_table_view(),
+                                                 EMBFromSSBGCRFTable::get_table_view(),
+                                                 EarthFromEMBGCRFTable::get_table_view(),
+                                                 MoonGCRFTable::get_table_view()});
+    return evaluator;
+}
+
+//! Assemble a snapshot from the per-table results
+BodySnapshot to_snapshot(const std::array<std::array<double, 3>, NUM_TABLES>& tables) {
+    BodySnapshot snapshot;
+    snapshot.sun_from_ssb    = tables[SUN_FROM_SSB];
+    snapshot.moon_from_earth = tables[MOON];
+    for (int k = 0; k < 3; k++) {
+        snapshot.earth_from_ssb[k] = tables[EARTH_FROM_EMB][k] + tables[EMB_FROM_SSB][k];
+    }
+    return snapshot;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> BodySnapshot::get_relative(CentralBody target, CentralBody central_body) const {
+    return compute_relative_vector(
+        target, central_body, [&]() { return sun_from_ssb; }, [&]() { return earth_from_ssb; },
+        [&]() { return moon_from_earth; }, "BodySnapshot::get_relative() - Unexpected input provided for CentralBody");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+BodySnapshot MultiBody::get_positions(double mjdj2k_tdb) {
+    std::array<std::array<double, 3>, NUM_TABLES> tables;
+    get_evaluator().get_positions(mjdj2k_tdb, tables.data());
+    return to_snapshot(tables);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+BodySnapshot MultiBody::get_velocities(double mjdj2k_tdb) {
+    std::array<std::array<double, 3>, NUM_TABLES> tables;
+    get_evaluator().get_velocities(mjdj2k_tdb, tables.data());
+    return to_snapshot(tables);
+}
+
+}  // namespace jpl_ephemeris
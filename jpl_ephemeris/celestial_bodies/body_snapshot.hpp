@@ -0,0 +1,91 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_BODY_SNAPSHOT_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_BODY_SNAPSHOT_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/body_snapshot.hpp
+ * \brief Defines a snapshot of the Sun, Earth, and Moon at a single epoch, and a static class for computing it with a
+ * shared Chebyshev basis
+ */
+
+// standard library includes
+#include <array>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+
+namespace jpl_ephemeris {
+
+//! Position [km] or velocity [km/s] of the Sun, Earth, and Moon at a single epoch, in the GCRF frame
+struct BodySnapshot {
+
+    /*!
+     * \brief Return the position/velocity of the target relative to the specified CentralBody
+     *
+     * \param target Body whose position/velocity is returned
+     * \param central_body Central body that the target is measured relative to
+     *
+     * \return Position [km] or velocity [km/s] of the target relative to the central body
+     *
+     * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+     */
+    std::array<double, 3> get_relative(CentralBody target, CentralBody central_body = CentralBody::Earth) const;
+
+    //! Sun relative to the Solar System Barycenter (SSB)
+    std::array<double, 3> sun_from_ssb{0., 0., 0.};
+
+    //! Earth relative to the Solar System Barycenter (SSB)
+    std::array<double, 3> earth_from_ssb{0., 0., 0.};
+
+    //! Moon relative to the Earth
+    std::array<double, 3> moon_from_earth{0., 0., 0.};
+};
+
+/*!
+ * \brief Defines a static class for computing the Sun, Earth, and Moon at a single epoch
+ *
+ * \details The Sun and EMB tables share 16-day granules, and the Moon and Earth-from-EMB tables share 4-day granules. The
+ * Chebyshev basis is generated once for each of the two granule geometries, and the coefficients of every table are then
+ * applied to it as a matrix-vector product, rather than running a separate Clenshaw loop per table and component.
+ */
+class MultiBody {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Delete the default constructor
+        MultiBody() = delete;
+
+        //! Delete the copy constructor
+        MultiBody(const MultiBody&) = delete;
+
+        //! Delete the copy assignment operator
+        MultiBody& operator=(const MultiBody&) = delete;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the positions of the Sun, Earth, and Moon
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Positions of the Sun, Earth, and Moon [km]
+         */
+        static BodySnapshot get_positions(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the velocities of the Sun, Earth, and Moon
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Velocities of the Sun, Earth, and Moon [km/s]
+         */
+        static BodySnapshot get_velocities(double mjdj2k_tdb);
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -7,9 +7,25 @@
  */
 
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_includes.hpp"
+#include "jpl_ephemeris/celestial_bodies/apparent_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/batch_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/body_snapshot.hpp"
 #include "jpl_ephemeris/celestial_bodies/central_body.hpp"
 #include "jpl_ephemeris/celestial_bodies/earth.hpp"
+#include "jpl_ephemeris/celestial_bodies/earth_moon_rotating_frame.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/event_finder.hpp"
+#include "jpl_ephemeris/celestial_bodies/fixed_step_trajectory.hpp"
+#include "jpl_ephemeris/celestial_bodies/frame_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/lunar_libration.hpp"
 #include "jpl_ephemeris/celestial_bodies/moon.hpp"
+#include "jpl_ephemeris/celestial_bodies/occultation_finder.hpp"
+#include "jpl_ephemeris/celestial_bodies/power_basis_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+#include "jpl_ephemeris/celestial_bodies/shadow_function.hpp"
 #include "jpl_ephemeris/celestial_bodies/sun.hpp"
+#include "jpl_ephemeris/celestial_bodies/third_body_acceleration.hpp"
+#include "jpl_ephemeris/celestial_bodies/topocentric.hpp"
+#include "jpl_ephemeris/celestial_bodies/velocity_ephemeris.hpp"
 
 #endif
@@ -0,0 +1,211 @@
+#include "earth_moon_rotating_frame.hpp"
+
+// standard library includes
+#include <cmath>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Return the dot product of a and b
+double dot(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the cross product of a and b
+std::array<double, 3> cross(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return std::array<double, 3>{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the matrix of the cross product with w, such that skew(w) * v = w x v
+RotationMatrix skew(const std::array<double, 3>& w) {
+    return RotationMatrix{{{0., -w[2], w[1]}, {w[2], 0., -w[0]}, {-w[1], w[0], 0.}}};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the product of the transpose of rot with vec
+std::array<double, 3> rotate_transpose(const RotationMatrix& rot, const std::array<double, 3>& vec) {
+    std::array<double, 3> out{};
+    for (unsigned int i = 0; i < 3; i++) {
+        out[i] = rot[0][i] * vec[0] + rot[1][i] * vec[1] + rot[2][i] * vec[2];
+    }
+    return out;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+EarthMoonRotatingFrame::EarthMoonRotatingFrame(RotatingFrameOrigin origin) :
+    origin_(origin), moon_(MoonGCRFTable::get_table_view()) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+RotatingFrame EarthMoonRotatingFrame::get_frame(double mjdj2k_tdb) {
+    // Position, velocity, acceleration, and jerk of the Moon relative to the Earth
+    const std::array<std::array<double, 3>, 4> moon = moon_.get_derivatives<3>(mjdj2k_tdb);
+    const std::array<double, 3>& r = moon[0];
+    const std::array<double, 3>& v = moon[1];
+    const std::array<double, 3>& a = moon[2];
+    const std::array<double, 3>& j = moon[3];
+
+    const std::array<double, 3> h = cross(r, v);
+    const double r_mag            = std::sqrt(dot(r, r));
+    const double h_mag            = std::sqrt(dot(h, h));
+
+    RotatingFrame frame;
+    frame.mjdj2k_tdb = mjdj2k_tdb;
+
+    std::array<double, 3>& x_hat = frame.rotation[0];
+    std::array<double, 3>& y_hat = frame.rotation[1];
+    std::array<double, 3>& z_hat = frame.rotation[2];
+    for (unsigned int k = 0; k < 3; k++) {
+        x_hat[k] = r[k] / r_mag;
+        z_hat[k] = h[k] / h_mag;
+    }
+    y_hat = cross(z_hat, x_hat);
+
+    // The velocity lies in the x-y plane, so the x axis only turns about z, and the z axis turns about x as the
+    // acceleration leaves the plane: w = (|r| a_z / |h|) x + (|h| / |r|^2) z
+    const double r_dot_v = dot(r, v);
+    const double a_y     = dot(a, y_hat);
+    const double a_z     = dot(a, z_hat);
+    const double w_x     = r_mag * a_z / h_mag;
+    const double w_z     = h_mag / (r_mag * r_mag);
+
+    // d|h|/dt = (r x a).z = |r| a_y, and d(a.z)/dt = j.z + a.(w x z) = j.z - w_x a_y
+    const double h_mag_dot = r_mag * a_y;
+    const double w_x_dot   = (r_dot_v / r_mag * a_z + r_mag * (dot(j, z_hat) - w_x * a_y) - w_x * h_mag_dot) / h_mag;
+    const double w_z_dot   = (h_mag_dot - 2. * h_mag * r_dot_v / (r_mag * r_mag)) / (r_mag * r_mag);
+
+    frame.angular_velocity     = {w_x, 0., w_z};
+    frame.angular_acceleration = {w_x_dot, 0., w_z_dot};
+
+    // A vector fixed in the GCRF frame turns by -w in the rotating frame, so C' = -[w]x C and C'' = ([w]x [w]x - [w']x) C
+    const RotationMatrix w_cross     = skew(frame.angular_velocity);
+    const RotationMatrix w_dot_cross = skew(frame.angular_acceleration);
+    const RotationMatrix w_cross_sq  = multiply(w_cross, w_cross);
+
+    RotationMatrix rate_factor{}, acceleration_factor{};
+    for (unsigned int row = 0; row < 3; row++) {
+        for (unsigned int col = 0; col < 3; col++) {
+            rate_factor[row][col]         = -w_cross[row][col];
+            acceleration_factor[row][col] = w_cross_sq[row][col] - w_dot_cross[row][col];
+        }
+    }
+    frame.rotation_rate         = multiply(rate_factor, frame.rotation);
+    frame.rotation_acceleration = multiply(acceleration_factor, frame.rotation);
+
+    // The barycenter sits at mu r from the Earth
+    const double origin_fraction = origin_ == RotatingFrameOrigin::EarthMoonBarycenter ? MASS_PARAMETER : 0.;
+    for (unsigned int k = 0; k < 3; k++) {
+        frame.origin_position[k]     = origin_fraction * r[k];
+        frame.origin_velocity[k]     = origin_fraction * v[k];
+        frame.origin_acceleration[k] = origin_fraction * a[k];
+        frame.moon_position[k]       = r[k] - frame.origin_position[k];
+        frame.moon_velocity[k]       = v[k] - frame.origin_velocity[k];
+        frame.moon_acceleration[k]   = a[k] - frame.origin_acceleration[k];
+    }
+    return frame;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EarthMoonRotatingFrame::get_frames(const double* mjdj2k_tdb, size_t num_epochs, RotatingFrame* frames) {
+    for (size_t i = 0; i < num_epochs; i++) {
+        frames[i] = get_frame(mjdj2k_tdb[i]);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EarthMoonRotatingFrame::to_rotating(const double* mjdj2k_tdb, const double* states_gcrf, size_t num_states,
+                                         double* states_rotating) {
+    for (size_t i = 0; i < num_states; i++) {
+        to_rotating(get_cached_frame(mjdj2k_tdb[i]), states_gcrf + 6 * i, 1, states_rotating + 6 * i);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EarthMoonRotatingFrame::to_gcrf(const double* mjdj2k_tdb, const double* states_rotating, size_t num_states,
+                                     double* states_gcrf) {
+    for (size_t i = 0; i < num_states; i++) {
+        to_gcrf(get_cached_frame(mjdj2k_tdb[i]), states_rotating + 6 * i, 1, states_gcrf + 6 * i);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EarthMoonRotatingFrame::to_rotating(const RotatingFrame& frame, const double* states_gcrf, size_t num_states,
+                                         double* states_rotating) {
+    for (size_t i = 0; i < num_states; i++) {
+        const double* in = states_gcrf + 6 * i;
+        double* out      = states_rotating + 6 * i;
+
+        std::array<double, 3> dr{}, dv{};
+        for (unsigned int k = 0; k < 3; k++) {
+            dr[k] = in[k] - frame.origin_position[k];
+            dv[k] = in[k + 3] - frame.origin_velocity[k];
+        }
+
+        // rho = C (r - r_o), rho' = C (v - v_o) + C' (r - r_o)
+        const std::array<double, 3> rho     = rotate(frame.rotation, dr);
+        const std::array<double, 3> rho_dot = rotate(frame.rotation, dv);
+        const std::array<double, 3> turn    = rotate(frame.rotation_rate, dr);
+        for (unsigned int k = 0; k < 3; k++) {
+            out[k]     = rho[k];
+            out[k + 3] = rho_dot[k] + turn[k];
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EarthMoonRotatingFrame::to_gcrf(const RotatingFrame& frame, const double* states_rotating, size_t num_states,
+                                     double* states_gcrf) {
+    for (size_t i = 0; i < num_states; i++) {
+        const double* in = states_rotating + 6 * i;
+        double* out      = states_gcrf + 6 * i;
+
+        // r - r_o = C^T rho, v - v_o = C^T (rho' - C' (r - r_o))
+        const std::array<double, 3> dr   = rotate_transpose(frame.rotation, {in[0], in[1], in[2]});
+        const std::array<double, 3> turn = rotate(frame.rotation_rate, dr);
+        const std::array<double, 3> dv =
+            rotate_transpose(frame.rotation, {in[3] - turn[0], in[4] - turn[1], in[5] - turn[2]});
+        for (unsigned int k = 0; k < 3; k++) {
+            out[k]     = dr[k] + frame.origin_position[k];
+            out[k + 3] = dv[k] + frame.origin_velocity[k];
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotatingFrameOrigin EarthMoonRotatingFrame::get_origin() const {
+    return origin_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const RotatingFrame& EarthMoonRotatingFrame::get_cached_frame(double mjdj2k_tdb) {
+    if (!has_frame_ || mjdj2k_tdb != frame_.mjdj2k_tdb) {
+        frame_     = get_frame(mjdj2k_tdb);
+        has_frame_ = true;
+    }
+    return frame_;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,215 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EARTH_MOON_ROTATING_FRAME_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EARTH_MOON_ROTATING_FRAME_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/earth_moon_rotating_frame.hpp
+ * \brief Defines a class for evaluating the Earth-Moon rotating frame, its angular velocity and acceleration, and for
+ * transforming spacecraft states between the GCRF frame and the rotating frame
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies the origin of the Earth-Moon rotating frame
+enum class RotatingFrameOrigin : int {
+    Earth = 0,                //!< Center of the Earth
+    EarthMoonBarycenter = 1,  //!< Earth-Moon barycenter, as in the circular restricted three-body problem
+};
+
+//! Earth-Moon rotating frame at one epoch, returned by EarthMoonRotatingFrame::get_frame()
+struct RotatingFrame {
+    //! Modified Julian Date from the J2000 Epoch, in the TDB Time System
+    double mjdj2k_tdb = 0.;
+
+    //! Rotation, C, from the GCRF frame to the rotating frame, whose rows are the x (Earth to Moon), y, and z (orbit
+    //! normal) unit vectors in the GCRF frame
+    RotationMatrix rotation{};
+
+    //! First time derivative of rotation [1/s]
+    RotationMatrix rotation_rate{};
+
+    //! Second time derivative of rotation [1/s^2]
+    RotationMatrix rotation_acceleration{};
+
+    //! Angular velocity of the rotating frame relative to the GCRF frame, in the rotating frame [rad/s]. The y component
+    //! is zero.
+    std::array<double, 3> angular_velocity{};
+
+    //! Angular acceleration of the rotating frame relative to the GCRF frame, in the rotating frame [rad/s^2]. The y
+    //! component is zero.
+    std::array<double, 3> angular_acceleration{};
+
+    //! Position of the origin relative to the Earth, in the GCRF frame [km]
+    std::array<double, 3> origin_position{};
+
+    //! Velocity of the origin relative to the Earth, in the GCRF frame [km/s]
+    std::array<double, 3> origin_velocity{};
+
+    //! Acceleration of the origin relative to the Earth, in the GCRF frame [km/s^2]
+    std::array<double, 3> origin_acceleration{};
+
+    //! Position of the Moon relative to the origin, in the GCRF frame [km]
+    std::array<double, 3> moon_position{};
+
+    //! Velocity of the Moon relative to the origin, in the GCRF frame [km/s]
+    std::array<double, 3> moon_velocity{};
+
+    //! Acceleration of the Moon relative to the origin, in the GCRF frame [km/s^2]
+    std::array<double, 3> moon_acceleration{};
+};
+
+/*!
+ * \brief Defines a class for evaluating the Earth-Moon rotating frame, its angular velocity and acceleration, and for
+ * transforming spacecraft states between the GCRF frame and the rotating frame
+ *
+ * \details The x axis points from the Earth to the Moon, the z axis along the angular momentum r x v of the Moon relative
+ * to the Earth, and the y axis completes the right-handed triad. The frame is driven by the actual DE orbit of the Moon,
+ * so its angular velocity w = (|r| a.z / |h|) x + (|h| / |r|^2) z tilts and varies along the orbit, and its angular
+ * acceleration needs the jerk of the Moon. The position of the Moon and its first three derivatives are evaluated in a
+ * single Clenshaw pass per component (see GranuleCache::get_derivatives), instead of separate position and velocity
+ * queries followed by numerical differentiation.
+ *
+ * A state r, v relative to the Earth in the GCRF frame maps to rho = C (r - r_o) and rho' = C (v - v_o) + C' (r - r_o)
+ * in the rotating frame, where r_o is the origin. The equations of motion in the rotating frame are then
+ * rho'' = C (a - a_o) - 2 w x rho' - w x (w x rho) - w' x rho, with w and w' from RotatingFrame. Every query updates the
+ * cache of the Moon table, so each thread needs its own instance, e.g.
+ *
+ *     EarthMoonRotatingFrame frame(RotatingFrameOrigin::EarthMoonBarycenter);
+ *     frame.to_rotating(mjdj2k_tdb.data(), states_gcrf.data(), num_states, states_rotating.data());
+ */
+class EarthMoonRotatingFrame {
+    public:
+
+        //! Mass parameter of the Earth-Moon system, m_moon / (m_earth + m_moon), from the DE header
+        static constexpr double MASS_PARAMETER = 1.0 / (1.0 + DEConstants::emrat);
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create an instance that evaluates the compiled-in Moon table
+         *
+         * \param origin Origin of the rotating frame
+         */
+        explicit EarthMoonRotatingFrame(RotatingFrameOrigin origin = RotatingFrameOrigin::EarthMoonBarycenter);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the rotating frame at the specified epoch
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Rotating frame
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the Moon table
+         */
+        RotatingFrame get_frame(double mjdj2k_tdb);
+
+        /*!
+         * \brief Evaluate the rotating frame at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param frames Output rotating frames, one per epoch
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the Moon table
+         */
+        void get_frames(const double* mjdj2k_tdb, size_t num_epochs, RotatingFrame* frames);
+
+        /*!
+         * \brief Transform a batch of states from the GCRF frame to the rotating frame
+         *
+         * \details The frame is only evaluated again when the epoch differs from that of the previous state, so states
+         * grouped by epoch (e.g. many spacecraft at each integration step) share one evaluation.
+         *
+         * \param mjdj2k_tdb Epoch of each state, in the TDB Time System
+         * \param states_gcrf States relative to the Earth in the GCRF frame, stacked as [x0, y0, z0, vx0, vy0, vz0, x1, ...]
+         *     [km, km/s]
+         * \param num_states Number of states
+         * \param states_rotating Output states relative to the origin in the rotating frame, stacked like states_gcrf
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the Moon table
+         */
+        void to_rotating(const double* mjdj2k_tdb, const double* states_gcrf, size_t num_states, double* states_rotating);
+
+        /*!
+         * \brief Transform a batch of states from the rotating frame to the GCRF frame
+         *
+         * \param mjdj2k_tdb Epoch of each state, in the TDB Time System
+         * \param states_rotating States relative to the origin in the rotating frame, stacked as [x0, y0, z0, vx0, vy0,
+         *     vz0, x1, ...] [km, km/s]
+         * \param num_states Number of states
+         * \param states_gcrf Output states relative to the Earth in the GCRF frame, stacked like states_rotating
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the Moon table
+         */
+        void to_gcrf(const double* mjdj2k_tdb, const double* states_rotating, size_t num_states, double* states_gcrf);
+
+        /*!
+         * \brief Transform a batch of states at the epoch of a frame from the GCRF frame to the rotating frame
+         *
+         * \param frame Rotating frame
+         * \param states_gcrf States relative to the Earth in the GCRF frame, stacked as [x0, y0, z0, vx0, vy0, vz0, x1, ...]
+         *     [km, km/s]
+         * \param num_states Number of states
+         * \param states_rotating Output states relative to the origin in the rotating frame, stacked like states_gcrf
+         */
+        static void to_rotating(const RotatingFrame& frame, const double* states_gcrf, size_t num_states,
+                                double* states_rotating);
+
+        /*!
+         * \brief Transform a batch of states at the epoch of a frame from the rotating frame to the GCRF frame
+         *
+         * \param frame Rotating frame
+         * \param states_rotating States relative to the origin in the rotating frame, stacked as [x0, y0, z0, vx0, vy0,
+         *     vz0, x1, ...] [km, km/s]
+         * \param num_states Number of states
+         * \param states_gcrf Output states relative to the Earth in the GCRF frame, stacked like states_rotating
+         */
+        static void to_gcrf(const RotatingFrame& frame, const double* states_rotating, size_t num_states,
+                            double* states_gcrf);
+
+        //! Return the origin of the rotating frame
+        RotatingFrameOrigin get_origin() const;
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return the cached frame, evaluating it first if mjdj2k_tdb differs from its epoch
+        const RotatingFrame& get_cached_frame(double mjdj2k_tdb);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Origin of the rotating frame
+        RotatingFrameOrigin origin_;
+
+        //! Cached granule of the Moon table
+        GranuleCache<15> moon_;
+
+        //! Frame of the last batch query
+        RotatingFrame frame_{};
+
+        //! True once frame_ holds an evaluated frame
+        bool has_frame_ = false;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
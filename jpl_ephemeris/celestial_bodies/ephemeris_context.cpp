@@ -0,0 +1,72 @@
+#include "ephemeris_context.hpp"
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+EphemerisContext::EphemerisContext() : EphemerisContext(EphemerisTableSet::get_compiled_in()) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EphemerisContext::EphemerisContext(const EphemerisTableSet& tables) :
+    sun_from_ssb_(tables.sun_from_ssb), emb_from_ssb_(tables.emb_from_ssb), earth_from_emb_(tables.earth_from_emb),
+    moon_(tables.moon) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> EphemerisContext::get_position(CentralBody target, double mjdj2k_tdb, CentralBody central_body) {
+    JPL_EPHEMERIS_RECORD(record_context_call(target, central_body));
+
+    return compute_table_relative_vector(
+        target, central_body, sun_from_ssb_, emb_from_ssb_, earth_from_emb_, moon_,
+        [&](auto& table) { return table.get_position(mjdj2k_tdb); },
+        "EphemerisContext::get_position() - Unexpected input provided for CentralBody");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> EphemerisContext::get_velocity(CentralBody target, double mjdj2k_tdb, CentralBody central_body) {
+    JPL_EPHEMERIS_RECORD(record_context_call(target, central_body));
+
+    return compute_table_relative_vector(
+        target, central_body, sun_from_ssb_, emb_from_ssb_, earth_from_emb_, moon_,
+        [&](auto& table) { return table.get_velocity(mjdj2k_tdb); },
+        "EphemerisContext::get_velocity() - Unexpected input provided for CentralBody");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 6> EphemerisContext::get_state(CentralBody target, double mjdj2k_tdb, CentralBody central_body) {
+    JPL_EPHEMERIS_RECORD(record_context_call(target, central_body));
+
+    return compute_table_relative_vector(
+        target, central_body, sun_from_ssb_, emb_from_ssb_, earth_from_emb_, moon_,
+        [&](auto& table) { return table.get_state(mjdj2k_tdb); },
+        "EphemerisContext::get_state() - Unexpected input provided for CentralBody");
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EphemerisContextCounters EphemerisContext::get_counters() const {
+    auto get = [](const auto& cache) { return GranuleCacheCounters{cache.get_hits(), cache.get_misses()}; };
+    return EphemerisContextCounters{get(sun_from_ssb_), get(emb_from_ssb_), get(earth_from_emb_), get(moon_)};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisContext::reset_counters() {
+    sun_from_ssb_.reset_counters();
+    emb_from_ssb_.reset_counters();
+    earth_from_emb_.reset_counters();
+    moon_.reset_counters();
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,161 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_CONTEXT_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_CONTEXT_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_context.hpp
+ * \brief Defines a class that caches the last granule of each table, for sequences of closely spaced queries
+ */
+
+// standard library includes
+#include <array>
+#include <cstdint>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
+
+namespace jpl_ephemeris {
+
+//! Number of table evaluations answered from the cached granule, and that required a granule lookup, for one table
+struct GranuleCacheCounters {
+    //! Number of evaluations answered from the cached granule
+    uint64_t hits = 0;
+
+    //! Number of evaluations that required a granule lookup
+    uint64_t misses = 0;
+};
+
+//! Hit and miss counters of each table of an EphemerisContext, named as in EphemerisTableSet
+struct EphemerisContextCounters {
+    //! Sun relative to the SSB
+    GranuleCacheCounters sun_from_ssb{};
+
+    //! EMB relative to the SSB
+    GranuleCacheCounters emb_from_ssb{};
+
+    //! Earth relative to the EMB
+    GranuleCacheCounters earth_from_emb{};
+
+    //! Moon relative to the Earth
+    GranuleCacheCounters moon{};
+};
+
+/*!
+ * \brief Defines a class that caches the last granule of each table, for sequences of closely spaced queries
+ *
+ * \details Each of the tables (Sun, EMB, Earth from EMB, and Moon; by default the compiled-in ones) keeps the last
+ * granule it was evaluated on, along with the normalization constants of that granule. A query inside the cached granules
+ * skips the index computation and bounds check done by the Sun, Earth, and Moon classes. A propagator stepping through a
+ * 4-day Moon granule therefore only misses once per granule.
+ *
+ * The context is small and cheap to construct, but every query updates the cache, so each thread needs its own instance,
+ * e.g.
+ *
+ *     thread_local EphemerisContext context;
+ *     std::array<double, 3> pos = context.get_position(CentralBody::Moon, mjdj2k_tdb);
+ */
+class EphemerisContext {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create a context with an empty cache for each of the compiled-in tables
+        EphemerisContext();
+
+        /*!
+         * \brief Create a context with an empty cache for each of the specified tables
+         *
+         * \param tables Views of the tables. The coefficients must remain valid for the lifetime of this object.
+         *
+         * \throws std::invalid_argument If the row size of a table does not match the compiled-in tables
+         */
+        explicit EphemerisContext(const EphemerisTableSet& tables);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Position of the target relative to the specified CentralBody in the GCRF frame [km]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        std::array<double, 3> get_position(CentralBody target, double mjdj2k_tdb,
+                                           CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Return the velocity of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose velocity is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Velocity of the target relative to the specified CentralBody in the GCRF frame [km/s]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        std::array<double, 3> get_velocity(CentralBody target, double mjdj2k_tdb,
+                                           CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Return the position and velocity of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose state is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Position [km] and velocity [km/s] of the target relative to the specified CentralBody in the GCRF frame,
+         *     stacked as [x, y, z, vx, vy, vz]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        std::array<double, 6> get_state(CentralBody target, double mjdj2k_tdb,
+                                        CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Return the hit and miss counters of each table
+         *
+         * \details A query relative to the Sun or SSB evaluates the EMB and Earth tables as well, so the counters of each
+         * table show which body keeps missing its cached granule.
+         *
+         * \return Counters of the Sun, EMB, Earth, and Moon tables
+         */
+        EphemerisContextCounters get_counters() const;
+
+        //! Reset the hit and miss counters of every table, keeping the cached granules
+        void reset_counters();
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Cache for the Sun relative to the SSB
+        GranuleCache<13> sun_from_ssb_;
+
+        //! Cache for the EMB relative to the SSB
+        GranuleCache<15> emb_from_ssb_;
+
+        //! Cache for the Earth relative to the EMB
+        GranuleCache<15> earth_from_emb_;
+
+        //! Cache for the Moon relative to the Earth
+        GranuleCache<15> moon_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,187 @@
+#include "de_ascii_table.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Julian Date of the J2000 Epoch
+constexpr double JD_J2000 = 2451545.0;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Parse a value written with a Fortran exponent (e.g. 0.1D+01)
+double parse_fortran_double(std::string word) {
+    std::replace(word.begin(), word.end(), 'D', 'E');
+    return std::strtod(word.c_str(), nullptr);
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+DEAsciiTable DEAsciiTable::load(const std::string& header_file, const std::vector<std::string>& data_files,
+                                unsigned int column, unsigned int num_components) {
+    if (num_components < 1 || num_components > 3) {
+        throw std::invalid_argument("DEAsciiTable::load() - num_components must be 1, 2, or 3.");
+    }
+
+    // Pull the three rows of GROUP 1050 out of the header
+    std::ifstream header(header_file);
+    if (!header) {
+        throw std::invalid_argument("DEAsciiTable::load() - Unable to open " + header_file);
+    }
+
+    std::vector<std::vector<int>> layout;
+    bool in_group = false;
+    std::string line;
+    while (layout.size() < 3 && std::getline(header, line)) {
+        if (line.find("GROUP") != std::string::npos) {
+            in_group = line.find("1050") != std::string::npos;
+            continue;
+        }
+
+        std::istringstream words(line);
+        std::vector<int> row;
+        int val = 0;
+        while (words >> val) {
+            row.push_back(val);
+        }
+
+        if (in_group && !row.empty()) {
+            layout.push_back(row);
+        }
+    }
+
+    if (layout.size() < 3 || layout[0].size() <= column || layout[1].size() <= column || layout[2].size() <= column
+        || layout[1][column] <= 0 || layout[2][column] <= 0) {
+        throw std::invalid_argument("DEAsciiTable::load() - Column " + std::to_string(column) + " of GROUP 1050 in "
+                                    + header_file + " has no coefficients.");
+    }
+
+    const size_t first_coeff = static_cast<size_t>(layout[0][column] - 1);
+    const size_t num_coeff   = static_cast<size_t>(layout[1][column]);
+    const size_t num_sub     = static_cast<size_t>(layout[2][column]);
+    const size_t row_size    = num_coeff + 2;
+
+    DEAsciiTable table;
+    table.num_components_ = num_components;
+
+    std::vector<double>& first_rows = table.rows_[0];
+    auto add_block = [&](const std::vector<double>& block) {
+        if (block.size() < first_coeff + num_coeff * num_sub * num_components) {
+            throw std::invalid_argument("DEAsciiTable::load() - A block is shorter than the header specifies.");
+        }
+
+        // Within a block, each subinterval stores the coefficients of its components one after the other
+        const double block_start = block[0] - JD_J2000;
+        const double days        = (block[1] - block[0]) / static_cast<double>(num_sub);
+        for (size_t k = 0; k < num_sub; k++) {
+            const double lb = block_start + days * static_cast<double>(k);
+            if (!first_rows.empty()) {
+                const double prev_ub = first_rows[first_rows.size() - row_size + 1];
+                if (lb < prev_ub - 1e-9) {
+                    continue;
+                }
+                if (lb > prev_ub + 1e-9) {
+                    throw std::invalid_argument("DEAsciiTable::load() - The blocks are not contiguous.");
+                }
+            }
+
+            for (size_t c = 0; c < num_components; c++) {
+                std::vector<double>& rows = table.rows_[c];
+                rows.push_back(lb);
+                rows.push_back(lb + days);
+                const double* coeff = block.data() + first_coeff + (k * num_components + c) * num_coeff;
+                rows.insert(rows.end(), coeff, coeff + num_coeff);
+            }
+        }
+    };
+
+    // Each block starts with a line holding the block number and the number of values, followed by three values per line
+    for (const std::string& file_name : data_files) {
+        std::ifstream data(file_name);
+        if (!data) {
+            throw std::invalid_argument("DEAsciiTable::load() - Unable to open " + file_name);
+        }
+
+        std::vector<double> block;
+        while (std::getline(data, line)) {
+            std::istringstream words(line);
+            std::vector<std::string> split_line;
+            std::string word;
+            while (words >> word) {
+                split_line.push_back(word);
+            }
+
+            if (split_line.size() == 2) {
+                if (!block.empty()) {
+                    add_block(block);
+                }
+                block.clear();
+            } else {
+                for (const std::string& val : split_line) {
+                    block.push_back(parse_fortran_double(val));
+                }
+            }
+        }
+
+        if (!block.empty()) {
+            add_block(block);
+        }
+    }
+
+    if (first_rows.empty()) {
+        throw std::invalid_argument("DEAsciiTable::load() - The data files do not contain any blocks.");
+    }
+
+    EphemerisTableView& view = table.view_;
+    for (size_t c = 0; c < num_components; c++) {
+        view.interp[c] = table.rows_[c].data();
+    }
+    view.row_size      = static_cast<unsigned int>(row_size);
+    view.num_granules  = static_cast<unsigned int>(first_rows.size() / row_size);
+    view.start_mjdj2k  = first_rows[0];
+    view.stop_mjdj2k   = first_rows[first_rows.size() - row_size + 1];
+    view.days_per_poly = first_rows[1] - first_rows[0];
+
+    table.registration_ = TableRegistration(TableLayout{"de_ascii column " + std::to_string(column), TableStorage::Heap,
+                                                        view, num_components});
+    return table;
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+const EphemerisTableView& DEAsciiTable::get_view() const {
+    return view_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+unsigned int DEAsciiTable::get_num_components() const {
+    return num_components_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+DEAsciiTable&& DEAsciiTable::expect_row_size(unsigned int num_components, unsigned int row_size) && {
+    if (num_components_ != num_components || view_.row_size != row_size) {
+        throw std::invalid_argument("DEAsciiTable::expect_row_size() - The table must hold "
+                                    + std::to_string(num_components) + " components of " + std::to_string(row_size - 2)
+                                    + " coefficients.");
+    }
+    return std::move(*this);
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,121 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_DE_ASCII_TABLE_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_DE_ASCII_TABLE_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/de_ascii_table.hpp
+ * \brief Table of Chebyshev polynomial coefficients read at runtime from one column of the ASCII DE files
+ */
+
+// Standard Library Includes
+#include <array>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/memory/footprint.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Table of Chebyshev polynomial coefficients read at runtime from one column of the ASCII DE files
+ *
+ * \details The compiled-in tables only hold the columns that jpl_ephemeris_parser.py extracts. This class reads any other
+ * column of GROUP 1050 (e.g. the nutations, librations, or TT - TDB) from the header and data files distributed by JPL,
+ * and stores it in the same [lb, ub, c_0, ...] rows, so that it can be evaluated through an EphemerisTableView with the
+ * same kernels as the compiled-in tables.
+ *
+ * The view points into the coefficients owned by this object, so the table can be moved but not copied.
+ */
+class DEAsciiTable {
+    public:
+
+        //! Column of the nutations (dpsi, deps) in GROUP 1050 of a DE header, counting from zero
+        static constexpr unsigned int NUTATION_COLUMN = 11;
+
+        //! Column of the lunar mantle librations (phi, theta, psi) in GROUP 1050 of a DE header, counting from zero
+        static constexpr unsigned int LIBRATION_COLUMN = 12;
+
+        //! Column of TT - TDB in GROUP 1050 of a DE header (DE430t and later), counting from zero
+        static constexpr unsigned int TT_MINUS_TDB_COLUMN = 14;
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        DEAsciiTable(const DEAsciiTable&) = delete;
+
+        DEAsciiTable& operator=(const DEAsciiTable&) = delete;
+
+        DEAsciiTable(DEAsciiTable&&) = default;
+
+        DEAsciiTable& operator=(DEAsciiTable&&) = default;
+
+        /*!
+         * \brief Read one column of the ASCII DE files
+         *
+         * \param header_file Path to the header file (e.g. header.430_572)
+         * \param data_files Paths to the data files (e.g. ascp1950.430, ascp2050.430), in increasing order of time. Blocks
+         *     repeated at the end of one file and the start of the next are skipped.
+         * \param column Column of GROUP 1050, counting from zero
+         * \param num_components Number of components stored in the column (1, 2, or 3)
+         *
+         * \return Table covering the data files
+         *
+         * \throws std::invalid_argument If a file cannot be read, num_components is not 1, 2, or 3, the column has no
+         *     coefficients, or the blocks are shorter than the header specifies or not contiguous
+         */
+        static DEAsciiTable load(const std::string& header_file, const std::vector<std::string>& data_files,
+                                 unsigned int column, unsigned int num_components);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return the view of the table. The pointers of the components beyond get_num_components() are null.
+        const EphemerisTableView& get_view() const;
+
+        //! Return the number of components stored in the table
+        unsigned int get_num_components() const;
+
+        /*!
+         * \brief Check the shape of the table, before a fixed-size evaluator is built on top of it
+         *
+         * \details Returns the table itself, so that it can be checked and moved into a member in one expression, e.g.
+         *
+         *     table_(std::move(table).expect_row_size(2, ROW_SIZE))
+         *
+         * \param num_components Expected number of components
+         * \param row_size Expected number of values per row, including the lb and ub values
+         *
+         * \return This table
+         *
+         * \throws std::invalid_argument If the table holds another number of components or rows of another size
+         */
+        DEAsciiTable&& expect_row_size(unsigned int num_components, unsigned int row_size) &&;
+
+    private:
+
+        //! Create an empty table
+        DEAsciiTable() = default;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Rows of [lb, ub, c_0, ...] for each component
+        std::array<std::vector<double>, 3> rows_{};
+
+        //! View of rows_
+        EphemerisTableView view_{};
+
+        //! Number of components stored in the table
+        unsigned int num_components_ = 0;
+
+        //! Registration of rows_ with get_memory_footprint()
+        TableRegistration registration_{};
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_DE_CONSTANTS_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_DE_CONSTANTS_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp
+ * \brief Static class containing the constants of the DE ephemeris that the tables were generated from
+ */
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Static class containing the constants of the DE ephemeris that the tables were generated from
+ *
+ * \details The values in the DE units are taken from GROUP 1040/1041 of the header file, as written to de_constants.txt
+ * by jpl_ephemeris_parser.py. The gravitational parameters in km^3/s^2 are derived from them.
+ *
+ * \attention This uses the DE430 JPL Ephemeris header (header.430_572)
+ */
+struct DEConstants {
+
+    //! Delete Default constructor
+    DEConstants() = delete;
+
+    //---------------------------------------
+    // Values from the DE header
+    //---------------------------------------
+
+    //! Astronomical unit [km]
+    static constexpr double au = 149597870.7;
+
+    //! Speed of light [km/s]
+    static constexpr double clight = 299792.458;
+
+    //! Earth/Moon mass ratio
+    static constexpr double emrat = 81.30056907419062;
+
+    //! Gravitational parameter of the Sun [AU^3/day^2]
+    static constexpr double gms = 0.0002959122082855911;
+
+    //! Gravitational parameter of the Earth-Moon system [AU^3/day^2]
+    static constexpr double gmb = 8.997011390199871e-10;
+
+    //! Radius of the Sun [km]
+    static constexpr double asun = 696000.0;
+
+    //! Equatorial radius of the Earth [km]
+    static constexpr double re = 6378.1363;
+
+    //! Radius of the Moon [km]
+    static constexpr double am = 1738.0;
+
+    //---------------------------------------
+    // Derived values
+    //---------------------------------------
+
+    //! Conversion from AU^3/day^2 to km^3/s^2
+    static constexpr double au3_per_day2_to_km3_per_s2 = au * au * au / (86400.0 * 86400.0);
+
+    //! Gravitational parameter of the Sun [km^3/s^2]
+    static constexpr double gm_sun = gms * au3_per_day2_to_km3_per_s2;
+
+    //! Gravitational parameter of the Earth [km^3/s^2]
+    static constexpr double gm_earth = gmb * emrat / (1.0 + emrat) * au3_per_day2_to_km3_per_s2;
+
+    //! Gravitational parameter of the Moon [km^3/s^2]
+    static constexpr double gm_moon = gmb / (1.0 + emrat) * au3_per_day2_to_km3_per_s2;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
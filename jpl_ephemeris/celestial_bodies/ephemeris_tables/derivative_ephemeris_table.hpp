@@ -0,0 +1,144 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_DERIVATIVE_EPHEMERIS_TABLE_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_DERIVATIVE_EPHEMERIS_TABLE_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/derivative_ephemeris_table.hpp
+ * \brief Table of the Chebyshev coefficients of the velocity, derived once from a position table
+ */
+
+// Standard Library Includes
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+#include "jpl_ephemeris/memory/footprint.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Table of the Chebyshev coefficients of the velocity, derived once from a position table
+ *
+ * \details The derivative of a Chebyshev series of degree n is a Chebyshev series of degree n - 1. Its coefficients are
+ * computed for every granule when the table is constructed (chder), with the 2 / (ub - lb) / 86400 normalization already
+ * applied. A velocity query is then a single plain Clenshaw evaluation per component, rather than the coupled value and
+ * derivative recurrences of chebyshev_derivative_eval.
+ *
+ * \tparam N Number of values per row of the position table, including the lb and ub values
+ */
+template<size_t N>
+class DerivativeEphemerisTable {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Build the velocity coefficients from a position table
+         *
+         * \param table View of the position table [km]
+         * \param name Name of the table in get_memory_footprint()
+         *
+         * \throws std::invalid_argument If the row size of table does not match N
+         */
+        explicit DerivativeEphemerisTable(const EphemerisTableView& table, const std::string& name = "velocity") :
+            view_(table), x_interp_(table.num_granules), y_interp_(table.num_granules), z_interp_(table.num_granules),
+            registration_() {
+
+            if (table.row_size != N) {
+                throw std::invalid_argument("DerivativeEphemerisTable() - Row size of the provided table does not match the "
+                                            "template parameter N.");
+            }
+
+            // Define constant for number of seconds per day
+            static const double SEC_PER_DAY = 86400.0;
+
+            std::array<std::vector<std::array<double, N - 1>>*, 3> interp{&x_interp_, &y_interp_, &z_interp_};
+            for (unsigned int ind = 0; ind < table.num_granules; ind++) {
+                for (unsigned int comp = 0; comp < 3; comp++) {
+                    const double* row             = table.get_row(comp, ind);
+                    std::array<double, N - 1>& dr = (*interp[comp])[ind];
+                    dr[0]                         = row[0];
+                    dr[1]                         = row[1];
+                    chebyshev_derivative_coefficients(row + 2, N - 2, row[0], row[1], 1. / SEC_PER_DAY, dr.data() + 2);
+                }
+            }
+
+            // Point the view at the velocity coefficients
+            view_.interp   = {x_interp_[0].data(), y_interp_[0].data(), z_interp_[0].data()};
+            view_.row_size = static_cast<unsigned int>(N - 1);
+
+            registration_ = TableRegistration(TableLayout{name, TableStorage::Heap, view_, 3});
+        }
+
+        //! Delete the copy constructor, since the view points into the owned coefficients
+        DerivativeEphemerisTable(const DerivativeEphemerisTable&) = delete;
+
+        //! Delete the copy assignment operator, since the view points into the owned coefficients
+        DerivativeEphemerisTable& operator=(const DerivativeEphemerisTable&) = delete;
+
+        //! Move constructor, moving the coefficients leaves the view pointing at valid storage
+        DerivativeEphemerisTable(DerivativeEphemerisTable&&) = default;
+
+        //! Move assignment operator, moving the coefficients leaves the view pointing at valid storage
+        DerivativeEphemerisTable& operator=(DerivativeEphemerisTable&&) = default;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the velocity
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Velocity [km/s]
+         */
+        std::array<double, 3> get_velocity(double mjdj2k_tdb) const {
+            // Compute coefficient lookup index
+            unsigned int ind = view_.get_index(mjdj2k_tdb);
+
+            // Compute velocity
+            double coeff_0_factor = 1.0;
+            double vx = chebyshev_eval(mjdj2k_tdb, x_interp_[ind], coeff_0_factor);
+            double vy = chebyshev_eval(mjdj2k_tdb, y_interp_[ind], coeff_0_factor);
+            double vz = chebyshev_eval(mjdj2k_tdb, z_interp_[ind], coeff_0_factor);
+
+            return std::array<double, 3>{vx, vy, vz};
+        }
+
+        //! Return a view of the velocity coefficients [km/s], which can be used with the other table evaluators
+        const EphemerisTableView& get_table_view() const {
+            return view_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! View of the velocity coefficients
+        EphemerisTableView view_;
+
+        //! Chebyshev polynomial coefficients for the x-component of velocity [km/s]
+        std::vector<std::array<double, N - 1>> x_interp_;
+
+        //! Chebyshev polynomial coefficients for the y-component of velocity [km/s]
+        std::vector<std::array<double, N - 1>> y_interp_;
+
+        //! Chebyshev polynomial coefficients for the z-component of velocity [km/s]
+        std::vector<std::array<double, N - 1>> z_interp_;
+
+        //! Registration of the velocity coefficients with get_memory_footprint()
+        TableRegistration registration_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -7,8 +7,18 @@
  */
 
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/jpl_ephemeris_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/derivative_ephemeris_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_ascii_table.hpp"
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/fixed_step_stepper.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/frame_ephemeris_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/power_basis_ephemeris_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/shared_basis_evaluator.hpp"
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
 
 #endif
@@ -0,0 +1,24 @@
+#include "ephemeris_table_set.hpp"
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+EphemerisTableSet EphemerisTableSet::get_compiled_in() {
+    EphemerisTableSet tables;
+    tables.sun_from_ssb   = SunFromSSBGCRFTable::get_table_view();
+    tables.emb_from_ssb   = EMBFromSSBGCRFTable::get_table_view();
+    tables.earth_from_emb = EarthFromEMBGCRFTable::get_table_view();
+    tables.moon           = MoonGCRFTable::get_table_view();
+    return tables;
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,66 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_EPHEMERIS_TABLE_SET_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_EPHEMERIS_TABLE_SET_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp
+ * \brief Views of the four tables needed to compose the Sun, Earth, and Moon relative to one another
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Views of the four tables needed to compose the Sun, Earth, and Moon relative to one another
+ *
+ * \details Instance-based evaluators, such as EphemerisContext, take a table set so that they can run on the compiled-in
+ * tables or on a copy of them held elsewhere (e.g. in a ResidentTables region).
+ */
+struct EphemerisTableSet {
+
+    //---------------------------------------
+    // Class Methods
+    //---------------------------------------
+
+    //! Return the views of the compiled-in tables
+    static EphemerisTableSet get_compiled_in();
+
+    //! Return the four views, in the order sun_from_ssb, emb_from_ssb, earth_from_emb, moon
+    std::array<EphemerisTableView, 4> get_views() const {
+        return std::array<EphemerisTableView, 4>{sun_from_ssb, emb_from_ssb, earth_from_emb, moon};
+    }
+
+    //! Return the number of bytes of coefficients referenced by the four views
+    size_t get_num_bytes() const {
+        size_t num_bytes = 0;
+        for (const EphemerisTableView& view : get_views()) {
+            num_bytes += 3 * static_cast<size_t>(view.num_granules) * view.row_size * sizeof(double);
+        }
+        return num_bytes;
+    }
+
+    //---------------------------------------
+    // Class Attributes
+    //---------------------------------------
+
+    //! Sun relative to the SSB
+    EphemerisTableView sun_from_ssb{};
+
+    //! EMB relative to the SSB
+    EphemerisTableView emb_from_ssb{};
+
+    //! Earth relative to the EMB
+    EphemerisTableView earth_from_emb{};
+
+    //! Moon relative to the Earth
+    EphemerisTableView moon{};
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_EPHEMERIS_TABLE_VIEW_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_EPHEMERIS_TABLE_VIEW_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp
+ * \brief Non-owning view of the Chebyshev polynomial coefficients stored in an ephemeris table
+ */
+
+// Standard Library Includes
+#include <array>
+#include <stdexcept>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Non-owning view of the Chebyshev polynomial coefficients stored in an ephemeris table
+ *
+ * \details Each component (x, y, z) points to num_granules contiguous rows of row_size values. Every row follows the
+ * layout written by jpl_ephemeris_parser.py: [lb, ub, c_0, c_1, ..., c_{row_size - 3}], where lb and ub are the bounds of
+ * the granule in MJD J2K TDB [days], and c_0 has already been multiplied by 0.5 (CSpice convention).
+ */
+struct EphemerisTableView {
+
+    //---------------------------------------
+    // Class Methods
+    //---------------------------------------
+
+    //! Number of Chebyshev coefficients per row
+    unsigned int num_coeff() const {
+        return row_size - 2;
+    }
+
+    /*!
+     * \brief Get the index of the granule containing the specified epoch
+     *
+     * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch in the TDB TimeSystem
+     *
+     * \return Granule index, clamped so that the final bound of the table maps onto the last granule
+     *
+     * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+     */
+    unsigned int get_index(double mjdj2k_tdb) const {
+        // The negated comparison also rejects NaN, which would otherwise produce an undefined index
+        if (!(mjdj2k_tdb >= start_mjdj2k && mjdj2k_tdb <= stop_mjdj2k)) {
+            JPL_EPHEMERIS_RECORD(record_event(InstrumentedEvent::ViewOutOfRange));
+            throw std::out_of_range("EphemerisTableView::get_index() - Value provided for mjdj2k is outside of the valid "
+                                    "range for the Chebyshev polynomial coefficients.");
+        }
+
+        unsigned int ind = static_cast<unsigned int>((mjdj2k_tdb - start_mjdj2k) / days_per_poly);
+        return ind < num_granules ? ind : num_granules - 1;
+    }
+
+    /*!
+     * \brief Return a pointer to the row of the specified component and granule
+     *
+     * \param component Component index (0 = x, 1 = y, 2 = z)
+     * \param ind Granule index
+     *
+     * \return Pointer to [lb, ub, c_0, ..., c_n] for the requested granule
+     */
+    const double* get_row(unsigned int component, unsigned int ind) const {
+        return interp[component] + static_cast<size_t>(ind) * row_size;
+    }
+
+    //---------------------------------------
+    // Class Attributes
+    //---------------------------------------
+
+    //! Pointer to the first row of the Chebyshev polynomial coefficients for each of the x, y, z components
+    std::array<const double*, 3> interp{nullptr, nullptr, nullptr};
+
+    //! Number of granules (rows) per component
+    unsigned int num_granules = 0;
+
+    //! Number of values per row, including the lb and ub values
+    unsigned int row_size = 0;
+
+    //! Lower bound on MJD J2K in the TDB time system [days]
+    double start_mjdj2k = 0.;
+
+    //! Upper bound on MJD J2K in the TDB time system [days]
+    double stop_mjdj2k = 0.;
+
+    //! Number of days covered by each set of polynomial coefficients
+    double days_per_poly = 0.;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_FIXED_STEP_STEPPER_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_FIXED_STEP_STEPPER_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/fixed_step_stepper.hpp
+ * \brief Evaluator of an ephemeris table at the epochs of a fixed-step grid, using forward differences inside a granule
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+#include "jpl_ephemeris/chebyshev/forward_difference.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Evaluator of an ephemeris table at the epochs of a fixed-step grid, using forward differences inside a granule
+ *
+ * \details The grid epochs are t_i = start + i * step. On the first step inside a granule, the forward difference tables
+ * of the position and velocity polynomials are built for that granule (see chebyshev_forward_differences). Every
+ * further step inside the granule only adds the differences together. Any step that is not the successor of the
+ * previous one, or that crosses into the next granule, rebuilds the tables.
+ *
+ * \tparam N Number of values per row of the table, including the lb and ub values
+ */
+template<size_t N>
+class FixedStepStepper {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create a stepper for the grid t_i = start + i * step
+         *
+         * \param table View of the table. The coefficients must remain valid for the lifetime of this object.
+         * \param start_mjdj2k_tdb First epoch of the grid, MJD J2K TDB [days]
+         * \param step_days Step of the grid, which must be positive [days]
+         *
+         * \throws std::invalid_argument If the row size of table does not match N, or step_days is not positive
+         */
+        FixedStepStepper(const EphemerisTableView& table, double start_mjdj2k_tdb, double step_days) :
+            view_(table), start_(start_mjdj2k_tdb), step_(step_days) {
+            if (table.row_size != N) {
+                throw std::invalid_argument("FixedStepStepper() - Row size of the provided table does not match the "
+                                            "template parameter N.");
+            }
+            if (!(step_days > 0.)) {
+                throw std::invalid_argument("FixedStepStepper() - Step must be greater than zero.");
+            }
+        }
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return the epoch of step i of the grid, MJD J2K TDB [days]
+        double get_epoch(size_t step_index) const {
+            return start_ + static_cast<double>(step_index) * step_;
+        }
+
+        /*!
+         * \brief Return the position and velocity at step i of the grid
+         *
+         * \param step_index Index of the step
+         *
+         * \return Position [km] and velocity [km/s], stacked as [x, y, z, vx, vy, vz]
+         *
+         * \throws std::out_of_range If the epoch of the step is outside of the range covered by the table
+         */
+        std::array<double, 6> get_state(size_t step_index) {
+            if (valid_ && step_index == index_ + 1 && step_index < end_index_) {
+                for (unsigned int comp = 0; comp < 3; comp++) {
+                    forward_difference_step<NC>(position_diff_[comp].data());
+                    forward_difference_step<NC - 1>(velocity_diff_[comp].data());
+                }
+                index_ = step_index;
+            } else if (!valid_ || step_index != index_) {
+                initialize(step_index);
+            }
+
+            return std::array<double, 6>{position_diff_[0][0],
+                                         position_diff_[1][0],
+                                         position_diff_[2][0],
+                                         velocity_factor_ * velocity_diff_[0][0],
+                                         velocity_factor_ * velocity_diff_[1][0],
+                                         velocity_factor_ * velocity_diff_[2][0]};
+        }
+
+        //! Return the number of times the difference tables were built
+        size_t get_num_resets() const {
+            return num_resets_;
+        }
+
+    private:
+
+        //! Number of Chebyshev coefficients per row
+        static constexpr size_t NC = N - 2;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Build the difference tables of the granule containing step i
+         *
+         * \throws std::out_of_range If the epoch of the step is outside of the range covered by the table
+         */
+        void initialize(size_t step_index) {
+            // Define constant for number of seconds per day
+            static const double SEC_PER_DAY = 86400.0;
+
+            double epoch     = get_epoch(step_index);
+            unsigned int ind = view_.get_index(epoch);
+
+            const double* row     = view_.get_row(0, ind);
+            double lb             = row[0];
+            double ub             = row[1];
+            double inv_half_width = 2. / (ub - lb);
+            double y0             = (epoch - 0.5 * (lb + ub)) * inv_half_width;
+            double h              = step_ * inv_half_width;
+            velocity_factor_      = inv_half_width / SEC_PER_DAY;
+
+            std::array<double, NC - 1> derivative_coeff{};
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                const double* coeff = view_.get_row(comp, ind) + 2;
+                chebyshev_forward_differences<NC>(coeff, y0, h, position_diff_[comp].data());
+                chebyshev_derivative_coefficients(coeff, NC, -1., 1., 1., derivative_coeff.data());
+                chebyshev_forward_differences<NC - 1>(derivative_coeff.data(), y0, h, velocity_diff_[comp].data());
+            }
+
+            // Find the first step of the grid past this granule, which is half-open except for the last granule, whose
+            // end is the end of the table. A step past the end of the table rebuilds, and get_index() throws.
+            const bool last_granule = ind + 1 == view_.num_granules;
+            auto is_past            = [&](size_t i) { return last_granule ? get_epoch(i) > ub : get_epoch(i) >= ub; };
+
+            size_t end = step_index + 1;
+            if (ub - epoch > step_) {
+                end = step_index + static_cast<size_t>((ub - epoch) / step_);
+            }
+            while (!is_past(end)) {
+                end++;
+            }
+            while (end > step_index + 1 && is_past(end - 1)) {
+                end--;
+            }
+            end_index_ = end;
+
+            index_ = step_index;
+            valid_ = true;
+            num_resets_++;
+        }
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! View of the table
+        EphemerisTableView view_;
+
+        //! First epoch of the grid [days]
+        double start_;
+
+        //! Step of the grid [days]
+        double step_;
+
+        //! True once a granule has been initialized
+        bool valid_ = false;
+
+        //! Index of the current step
+        size_t index_ = 0;
+
+        //! Index of the first step past the current granule
+        size_t end_index_ = 0;
+
+        //! Factor converting a derivative with respect to the Chebyshev variable into a rate per second [1/s]
+        double velocity_factor_ = 0.;
+
+        //! Number of times the difference tables were built
+        size_t num_resets_ = 0;
+
+        //! Forward difference tables of the position, for each of the x, y, z components [km]
+        std::array<std::array<double, NC>, 3> position_diff_{};
+
+        //! Forward difference tables of the derivative with respect to the Chebyshev variable, for each component
+        std::array<std::array<double, NC - 1>, 3> velocity_diff_{};
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
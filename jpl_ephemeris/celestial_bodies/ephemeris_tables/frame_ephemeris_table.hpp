@@ -0,0 +1,214 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_FRAME_EPHEMERIS_TABLE_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_FRAME_EPHEMERIS_TABLE_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/frame_ephemeris_table.hpp
+ * \brief Ephemeris table whose Chebyshev polynomial coefficients have been rotated from GCRF into another inertial frame
+ */
+
+// Standard Library Includes
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_derivative_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_eval.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+#include "jpl_ephemeris/memory/footprint.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Ephemeris table whose Chebyshev polynomial coefficients have been rotated from GCRF into another inertial frame
+ *
+ * \details A constant rotation commutes with the Chebyshev expansion, so the rotation is applied once to every (x, y, z)
+ * coefficient triplet when the table is constructed. Queries then run the exact same Clenshaw evaluation as the GCRF
+ * tables, so they cost the same as a GCRF query.
+ *
+ * \tparam N Number of values per row, including the lb and ub values
+ */
+template<size_t N>
+class FrameEphemerisTable {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Rotate a GCRF table into one of the predefined inertial frames
+         *
+         * \param gcrf_table View of the GCRF table to rotate
+         * \param frame Inertial frame to rotate into
+         * \param name Name of the table in get_memory_footprint()
+         *
+         * \throws std::invalid_argument If the row size of gcrf_table does not match N, or frame is UserDefined
+         */
+        FrameEphemerisTable(const EphemerisTableView& gcrf_table, InertialFrame frame,
+                            const std::string& name = "rotated") :
+            FrameEphemerisTable(gcrf_table, jpl_ephemeris::get_rotation_from_gcrf(frame), frame, name) {}
+
+        /*!
+         * \brief Rotate a GCRF table by a user-supplied constant rotation
+         *
+         * \param gcrf_table View of the GCRF table to rotate
+         * \param rot_from_gcrf Rotation matrix, R, such that r_frame = R * r_gcrf
+         * \param name Name of the table in get_memory_footprint()
+         *
+         * \throws std::invalid_argument If the row size of gcrf_table does not match N
+         */
+        FrameEphemerisTable(const EphemerisTableView& gcrf_table, const RotationMatrix& rot_from_gcrf,
+                            const std::string& name = "rotated") :
+            FrameEphemerisTable(gcrf_table, rot_from_gcrf, InertialFrame::UserDefined, name) {}
+
+        //! Delete the copy constructor, since the view points into the owned coefficients
+        FrameEphemerisTable(const FrameEphemerisTable&) = delete;
+
+        //! Delete the copy assignment operator, since the view points into the owned coefficients
+        FrameEphemerisTable& operator=(const FrameEphemerisTable&) = delete;
+
+        //! Move constructor, moving the coefficients leaves the view pointing at valid storage
+        FrameEphemerisTable(FrameEphemerisTable&&) = default;
+
+        //! Move assignment operator, moving the coefficients leaves the view pointing at valid storage
+        FrameEphemerisTable& operator=(FrameEphemerisTable&&) = default;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position in the frame of this table
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Position in the frame of this table [km]
+         */
+        std::array<double, 3> get_position(double mjdj2k_tdb) const {
+            // Compute coefficient lookup index
+            unsigned int ind = view_.get_index(mjdj2k_tdb);
+
+            // Compute position
+            double coeff_0_factor = 1.0;
+            double x = chebyshev_eval(mjdj2k_tdb, x_interp_[ind], coeff_0_factor);
+            double y = chebyshev_eval(mjdj2k_tdb, y_interp_[ind], coeff_0_factor);
+            double z = chebyshev_eval(mjdj2k_tdb, z_interp_[ind], coeff_0_factor);
+
+            return std::array<double, 3>{x, y, z};
+        }
+
+        /*!
+         * \brief Return the velocity in the frame of this table
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Velocity in the frame of this table [km/s]
+         */
+        std::array<double, 3> get_velocity(double mjdj2k_tdb) const {
+            // Compute coefficient lookup index
+            unsigned int ind = view_.get_index(mjdj2k_tdb);
+
+            // Define constant for number of seconds per day
+            static const double SEC_PER_DAY = 86400.0;
+
+            // Compute velocity
+            double vx = chebyshev_derivative_eval(mjdj2k_tdb, x_interp_[ind]) / SEC_PER_DAY;
+            double vy = chebyshev_derivative_eval(mjdj2k_tdb, y_interp_[ind]) / SEC_PER_DAY;
+            double vz = chebyshev_derivative_eval(mjdj2k_tdb, z_interp_[ind]) / SEC_PER_DAY;
+
+            return std::array<double, 3>{vx, vy, vz};
+        }
+
+        //! Return the inertial frame this table is expressed in
+        InertialFrame get_frame() const {
+            return frame_;
+        }
+
+        //! Return the rotation matrix from GCRF that was applied to the coefficients
+        const RotationMatrix& get_rotation_from_gcrf() const {
+            return rot_from_gcrf_;
+        }
+
+        //! Return a view of the rotated Chebyshev polynomial coefficients stored in this table
+        const EphemerisTableView& get_table_view() const {
+            return view_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Rotate every coefficient triplet of gcrf_table by rot_from_gcrf
+        FrameEphemerisTable(const EphemerisTableView& gcrf_table, const RotationMatrix& rot_from_gcrf,
+                            InertialFrame frame, const std::string& name) :
+            frame_(frame), rot_from_gcrf_(rot_from_gcrf), view_(gcrf_table), x_interp_(gcrf_table.num_granules),
+            y_interp_(gcrf_table.num_granules), z_interp_(gcrf_table.num_granules), registration_() {
+
+            if (gcrf_table.row_size != N) {
+                throw std::invalid_argument("FrameEphemerisTable() - Row size of the provided table does not match the "
+                                            "template parameter N.");
+            }
+
+            for (unsigned int ind = 0; ind < gcrf_table.num_granules; ind++) {
+                const double* x_row = gcrf_table.get_row(0, ind);
+                const double* y_row = gcrf_table.get_row(1, ind);
+                const double* z_row = gcrf_table.get_row(2, ind);
+
+                // Copy the lb and ub values
+                for (unsigned int k = 0; k < 2; k++) {
+                    x_interp_[ind][k] = x_row[k];
+                    y_interp_[ind][k] = y_row[k];
+                    z_interp_[ind][k] = z_row[k];
+                }
+
+                // Rotate each coefficient triplet
+                for (unsigned int k = 2; k < N; k++) {
+                    x_interp_[ind][k] = rot_from_gcrf[0][0] * x_row[k] + rot_from_gcrf[0][1] * y_row[k]
+                                        + rot_from_gcrf[0][2] * z_row[k];
+                    y_interp_[ind][k] = rot_from_gcrf[1][0] * x_row[k] + rot_from_gcrf[1][1] * y_row[k]
+                                        + rot_from_gcrf[1][2] * z_row[k];
+                    z_interp_[ind][k] = rot_from_gcrf[2][0] * x_row[k] + rot_from_gcrf[2][1] * y_row[k]
+                                        + rot_from_gcrf[2][2] * z_row[k];
+                }
+            }
+
+            // Point the view at the rotated coefficients
+            view_.interp = {x_interp_[0].data(), y_interp_[0].data(), z_interp_[0].data()};
+
+            registration_ = TableRegistration(TableLayout{name, TableStorage::Heap, view_, 3});
+        }
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Inertial frame the coefficients are expressed in
+        InertialFrame frame_;
+
+        //! Rotation matrix from GCRF applied to the coefficients
+        RotationMatrix rot_from_gcrf_;
+
+        //! View of the rotated coefficients
+        EphemerisTableView view_;
+
+        //! Chebyshev polynomial coefficients for the x-coordinate [km]
+        std::vector<std::array<double, N>> x_interp_;
+
+        //! Chebyshev polynomial coefficients for the y-coordinate [km]
+        std::vector<std::array<double, N>> y_interp_;
+
+        //! Chebyshev polynomial coefficients for the z-coordinate [km]
+        std::vector<std::array<double, N>> z_interp_;
+
+        //! Registration of the rotated coefficients with get_memory_footprint()
+        TableRegistration registration_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,295 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_GRANULE_CACHE_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_GRANULE_CACHE_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp
+ * \brief Evaluator of an ephemeris table that remembers the last granule used, along with its normalization constants
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp"
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Evaluator of an ephemeris table that remembers the last granule used, along with its normalization constants
+ *
+ * \details A query whose epoch falls within the cached granule [lb, ub), or [lb, ub] for the last granule of the table,
+ * only pays for the change of variables and the Clenshaw recurrences; the granule index, the bounds check, and the row
+ * lookup are skipped entirely. Any other epoch is a miss, which looks up the granule in the table (throwing if it is out
+ * of range) and replaces the cached one.
+ *
+ * \note The cache is mutated by every query, so an instance must not be shared between threads.
+ *
+ * \tparam N Number of values per row of the table, including the lb and ub values
+ * \tparam NCOMP Number of components evaluated, starting from the first (e.g. 2 for the nutations in longitude and
+ *     obliquity)
+ */
+template<size_t N, size_t NCOMP = 3>
+class GranuleCache {
+    static_assert(NCOMP >= 1 && NCOMP <= 3, "GranuleCache - NCOMP must be 1, 2, or 3.");
+
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create an empty cache for the specified table
+         *
+         * \param table View of the table. The coefficients must remain valid for the lifetime of this object.
+         *
+         * \throws std::invalid_argument If the row size of table does not match N, or the table is missing one of the
+         *     first NCOMP components
+         */
+        explicit GranuleCache(const EphemerisTableView& table) : view_(table) {
+            if (table.row_size != N) {
+                throw std::invalid_argument("GranuleCache() - Row size of the provided table does not match the template "
+                                            "parameter N.");
+            }
+
+            for (unsigned int comp = 0; comp < NCOMP; comp++) {
+                if (table.interp[comp] == nullptr) {
+                    throw std::invalid_argument("GranuleCache() - The provided table does not have NCOMP components.");
+                }
+            }
+        }
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Position [km]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb misses the cache and is outside of the range covered by the table
+         */
+        std::array<double, NCOMP> get_position(double mjdj2k_tdb) {
+            double y = lookup(mjdj2k_tdb);
+
+            std::array<double, NCOMP> position{};
+            for (unsigned int comp = 0; comp < NCOMP; comp++) {
+                position[comp] = chebyshev_eval_normalized<NC>(y, rows_[comp]);
+            }
+            return position;
+        }
+
+        /*!
+         * \brief Return the velocity
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Velocity [km/s]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb misses the cache and is outside of the range covered by the table
+         */
+        std::array<double, NCOMP> get_velocity(double mjdj2k_tdb) {
+            double y = lookup(mjdj2k_tdb);
+
+            std::array<double, NCOMP> velocity{};
+            for (unsigned int comp = 0; comp < NCOMP; comp++) {
+                velocity[comp] = chebyshev_derivative_eval_normalized<NC>(y, rows_[comp]) * velocity_factor_;
+            }
+            return velocity;
+        }
+
+        /*!
+         * \brief Return the position and velocity, sharing a single recurrence per component
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Position [km] and velocity [km/s], stacked as [x, y, z, vx, vy, vz] (or the first NCOMP of each)
+         *
+         * \throws std::out_of_range If mjdj2k_tdb misses the cache and is outside of the range covered by the table
+         */
+        std::array<double, 2 * NCOMP> get_state(double mjdj2k_tdb) {
+            double y = lookup(mjdj2k_tdb);
+
+            std::array<double, 2 * NCOMP> state{};
+            for (unsigned int comp = 0; comp < NCOMP; comp++) {
+                chebyshev_state_eval_normalized<NC>(y, rows_[comp], state[comp], state[comp + NCOMP]);
+                state[comp + NCOMP] *= velocity_factor_;
+            }
+            return state;
+        }
+
+        /*!
+         * \brief Return the position and its first K time derivatives, sharing a single recurrence per component
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Position [km] followed by its derivatives of order 1..K [km/s^m], one array of NCOMP values per order
+         *
+         * \throws std::out_of_range If mjdj2k_tdb misses the cache and is outside of the range covered by the table
+         *
+         * \tparam K Highest order of derivative (e.g. 3 for the velocity, acceleration, and jerk)
+         */
+        template<size_t K>
+        std::array<std::array<double, NCOMP>, K + 1> get_derivatives(double mjdj2k_tdb) {
+            double y = lookup(mjdj2k_tdb);
+
+            std::array<std::array<double, NCOMP>, K + 1> derivatives{};
+            for (unsigned int comp = 0; comp < NCOMP; comp++) {
+                std::array<double, K + 1> values{};
+                chebyshev_derivatives_eval_normalized<NC, K>(y, rows_[comp], values);
+
+                double factor = 1.;
+                for (size_t m = 0; m <= K; m++) {
+                    derivatives[m][comp] = values[m] * factor;
+                    factor *= velocity_factor_;
+                }
+            }
+            return derivatives;
+        }
+
+        /*!
+         * \brief Evaluate the positions at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param positions Output positions, NCOMP per epoch
+         *
+         * \throws std::out_of_range If an epoch misses the cache and is outside of the range covered by the table
+         */
+        void get_positions(const double* mjdj2k_tdb, size_t num_epochs, double* positions) {
+            for (size_t i = 0; i < num_epochs; i++) {
+                const std::array<double, NCOMP> position = get_position(mjdj2k_tdb[i]);
+                for (size_t comp = 0; comp < NCOMP; comp++) {
+                    positions[NCOMP * i + comp] = position[comp];
+                }
+            }
+        }
+
+        /*!
+         * \brief Evaluate the states at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param states Output states, 2 * NCOMP per epoch, stacked as in get_state()
+         *
+         * \throws std::out_of_range If an epoch misses the cache and is outside of the range covered by the table
+         */
+        void get_states(const double* mjdj2k_tdb, size_t num_epochs, double* states) {
+            for (size_t i = 0; i < num_epochs; i++) {
+                const std::array<double, 2 * NCOMP> state = get_state(mjdj2k_tdb[i]);
+                for (size_t k = 0; k < 2 * NCOMP; k++) {
+                    states[2 * NCOMP * i + k] = state[k];
+                }
+            }
+        }
+
+        //! Return the number of queries that were answered from the cached granule
+        uint64_t get_hits() const {
+            return hits_;
+        }
+
+        //! Return the number of queries that required a granule lookup
+        uint64_t get_misses() const {
+            return misses_;
+        }
+
+        //! Reset the hit and miss counters, keeping the cached granule
+        void reset_counters() {
+            hits_   = 0;
+            misses_ = 0;
+        }
+
+    private:
+
+        //! Number of Chebyshev coefficients per row
+        static constexpr size_t NC = N - 2;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Make sure the granule containing the epoch is cached, and transform the epoch to the Chebyshev range
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Epoch transformed to [-1, 1] over the cached granule
+         */
+        double lookup(double mjdj2k_tdb) {
+            if (mjdj2k_tdb >= lb_ && mjdj2k_tdb < hit_ub_) {
+                hits_++;
+                JPL_EPHEMERIS_RECORD(record_event(InstrumentedEvent::CacheHit));
+            } else {
+                misses_++;
+                JPL_EPHEMERIS_RECORD(record_event(InstrumentedEvent::CacheMiss));
+                unsigned int ind = view_.get_index(mjdj2k_tdb);
+                for (unsigned int comp = 0; comp < NCOMP; comp++) {
+                    rows_[comp] = view_.get_row(comp, ind) + 2;
+                }
+
+                // Define constant for number of seconds per day
+                static const double SEC_PER_DAY = 86400.0;
+
+                const double* row = view_.get_row(0, ind);
+                lb_               = row[0];
+                ub_               = row[1];
+                mid_              = 0.5 * (lb_ + ub_);
+                inv_half_width_   = 2. / (ub_ - lb_);
+                velocity_factor_  = inv_half_width_ / SEC_PER_DAY;
+
+                // The end of the table belongs to the last granule, so it must hit as well
+                hit_ub_ = ind + 1 == view_.num_granules
+                              ? std::nextafter(view_.stop_mjdj2k, std::numeric_limits<double>::infinity())
+                              : ub_;
+            }
+            return (mjdj2k_tdb - mid_) * inv_half_width_;
+        }
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! View of the table
+        EphemerisTableView view_;
+
+        //! Pointer to the coefficients c_0..c_{NC-1} of the cached granule, for each of the evaluated components
+        std::array<const double*, NCOMP> rows_{};
+
+        //! Lower bound of the cached granule [days], equal to hit_ub_ while nothing is cached so every query misses
+        double lb_ = 0.;
+
+        //! Upper bound of the cached granule [days]
+        double ub_ = 0.;
+
+        //! Exclusive upper bound of the epochs answered from the cached granule [days]
+        double hit_ub_ = 0.;
+
+        //! Midpoint of the cached granule [days]
+        double mid_ = 0.;
+
+        //! Inverse of half the width of the cached granule [1/days]
+        double inv_half_width_ = 0.;
+
+        //! Factor converting a derivative with respect to the Chebyshev variable into a rate per second [1/s]
+        double velocity_factor_ = 0.;
+
+        //! Number of queries answered from the cached granule
+        uint64_t hits_ = 0;
+
+        //! Number of queries that required a granule lookup
+        uint64_t misses_ = 0;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
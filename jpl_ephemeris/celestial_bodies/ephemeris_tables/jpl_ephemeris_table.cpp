@@ -3,10 +3,16 @@
 // Standard Library Includes
 #include <stdexcept>
 
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
+
 namespace jpl_ephemeris {
 
 unsigned int JPLEphemerisTable::get_index(double mjdj2k_tdb, double days_per_poly) {
+    JPL_EPHEMERIS_RECORD(record_event(InstrumentedEvent::TableLookup));
+
     if (mjdj2k_tdb < start_mjdj2k_ || mjdj2k_tdb > stop_mjdj2k_) {
+        JPL_EPHEMERIS_RECORD(record_event(InstrumentedEvent::TableOutOfRange));
         throw std::out_of_range("JPLEphemerisTable::get_index() - Value provided for mjdj2k is outside of the valid range "
                                 "for the Chebyshev polynomial coefficients. Valid range: 1/1/2000 12:00:00 to 1/1/2100 "
                                 "12:00:00.");
@@ -8,6 +8,12 @@
  * \note Resource: https://www.celestialprogramming.com/jpl-ephemeris-format/jpl-ephemeris-format.html
  */
 
+// Standard Library Includes
+#include <array>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+
 namespace jpl_ephemeris {
 
 //! Base class for any JPL Celestial-Body (CB) table
@@ -39,6 +45,34 @@ class JPLEphemerisTable {
          */
         static unsigned int get_index(double mjdj2k_tdb, double days_per_poly);
 
+        /*!
+         * \brief Build a view of the x, y, z Chebyshev polynomial coefficients of a derived table
+         *
+         * \param x_interp Chebyshev polynomial coefficients for the x-coordinate
+         * \param y_interp Chebyshev polynomial coefficients for the y-coordinate
+         * \param z_interp Chebyshev polynomial coefficients for the z-coordinate
+         * \param days_per_poly Number of days covered by each set of polynomial coefficients
+         *
+         * \return View of the coefficients
+         *
+         * \tparam N Number of values per row, including the lb and ub values
+         * \tparam M Number of rows
+         */
+        template<size_t N, size_t M>
+        static EphemerisTableView make_table_view(const std::array<std::array<double, N>, M>& x_interp,
+                                                  const std::array<std::array<double, N>, M>& y_interp,
+                                                  const std::array<std::array<double, N>, M>& z_interp,
+                                                  double days_per_poly) {
+            EphemerisTableView view;
+            view.interp        = {x_interp[0].data(), y_interp[0].data(), z_interp[0].data()};
+            view.num_granules  = static_cast<unsigned int>(M);
+            view.row_size      = static_cast<unsigned int>(N);
+            view.start_mjdj2k  = start_mjdj2k_;
+            view.stop_mjdj2k   = stop_mjdj2k_;
+            view.days_per_poly = days_per_poly;
+            return view;
+        }
+
         //---------------------------------------
         // Class Attributes
         //---------------------------------------
@@ -0,0 +1,293 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_POWER_BASIS_EPHEMERIS_TABLE_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_POWER_BASIS_EPHEMERIS_TABLE_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/power_basis_ephemeris_table.hpp
+ * \brief Ephemeris table that is evaluated with Estrin's scheme in the power basis, when accurate enough, and with
+ * Clenshaw's recurrence otherwise
+ */
+
+// Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_derivative_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+#include "jpl_ephemeris/chebyshev/power_basis.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies how the polynomial of each granule is evaluated
+enum class EvaluationMode : int {
+    Clenshaw = 0,  //!< Clenshaw's recurrence on the Chebyshev coefficients
+    Estrin = 1,    //!< Estrin's scheme on the power basis coefficients
+};
+
+//! Difference between Estrin and Clenshaw evaluation, measured across every granule of a table
+struct EvaluationAccuracy {
+    //! Maximum position difference over all components and samples [km]
+    double max_position_error = 0.;
+
+    //! Maximum velocity difference over all components and samples [km/s]
+    double max_velocity_error = 0.;
+
+    //! Root-mean-square position difference over all components and samples [km]
+    double rms_position_error = 0.;
+
+    //! Number of epochs sampled
+    unsigned int num_samples = 0;
+};
+
+/*!
+ * \brief Ephemeris table that is evaluated with Estrin's scheme in the power basis, when accurate enough, and with
+ * Clenshaw's recurrence otherwise
+ *
+ * \details At construction every granule is converted to the power basis in the normalized variable y in [-1, 1], along
+ * with the power series of its derivative. The difference from Clenshaw is then measured at evenly spaced epochs across
+ * every granule of the table, and the evaluation mode is chosen from the measured position and velocity errors.
+ *
+ * \tparam N Number of values per row of the source table, including the lb and ub values
+ */
+template<size_t N>
+class PowerBasisEphemerisTable {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Convert a table to the power basis and choose the evaluation mode from the measured error
+         *
+         * \param table View of the table to convert. The view must remain valid for the lifetime of this object, since it
+         *     is used whenever Clenshaw's recurrence is selected.
+         * \param position_tol Maximum position difference from Clenshaw for Estrin to be selected [km]
+         * \param velocity_tol Maximum velocity difference from Clenshaw for Estrin to be selected [km/s]
+         * \param samples_per_granule Number of evenly spaced epochs sampled per granule when measuring the error
+         *
+         * \throws std::invalid_argument If the row size of table does not match N
+         */
+        PowerBasisEphemerisTable(const EphemerisTableView& table, double position_tol = 1e-6, double velocity_tol = 1e-11,
+                                 unsigned int samples_per_granule = 16) :
+            view_(table), mode_(EvaluationMode::Clenshaw), accuracy_(), x_power_(table.num_granules),
+            y_power_(table.num_granules), z_power_(table.num_granules) {
+
+            if (table.row_size != N) {
+                throw std::invalid_argument("PowerBasisEphemerisTable() - Row size of the provided table does not match the "
+                                            "template parameter N.");
+            }
+
+            std::array<std::vector<PowerGranule>*, 3> power{&x_power_, &y_power_, &z_power_};
+            for (unsigned int ind = 0; ind < table.num_granules; ind++) {
+                for (unsigned int comp = 0; comp < 3; comp++) {
+                    const double* row   = table.get_row(comp, ind);
+                    PowerGranule& gran  = (*power[comp])[ind];
+                    gran.lb             = row[0];
+                    gran.ub             = row[1];
+                    chebyshev_to_power_basis<NC>(row + 2, NC, gran.coeff.data());
+                    for (size_t k = 1; k < NC; k++) {
+                        gran.derivative_coeff[k - 1] = static_cast<double>(k) * gran.coeff[k];
+                    }
+                }
+            }
+
+            accuracy_ = measure_accuracy(samples_per_granule);
+            if (accuracy_.max_position_error <= position_tol && accuracy_.max_velocity_error <= velocity_tol) {
+                mode_ = EvaluationMode::Estrin;
+            }
+        }
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position using the selected evaluation mode
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Position [km]
+         */
+        std::array<double, 3> get_position(double mjdj2k_tdb) const {
+            unsigned int ind = view_.get_index(mjdj2k_tdb);
+            return mode_ == EvaluationMode::Estrin ? estrin_position(mjdj2k_tdb, ind) : clenshaw_position(mjdj2k_tdb, ind);
+        }
+
+        /*!
+         * \brief Return the velocity using the selected evaluation mode
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Velocity [km/s]
+         */
+        std::array<double, 3> get_velocity(double mjdj2k_tdb) const {
+            unsigned int ind = view_.get_index(mjdj2k_tdb);
+            return mode_ == EvaluationMode::Estrin ? estrin_velocity(mjdj2k_tdb, ind) : clenshaw_velocity(mjdj2k_tdb, ind);
+        }
+
+        //! Return the evaluation mode selected from the measured error
+        EvaluationMode get_mode() const {
+            return mode_;
+        }
+
+        /*!
+         * \brief Override the evaluation mode selected from the measured error
+         *
+         * \param mode Evaluation mode to use
+         */
+        void set_mode(EvaluationMode mode) {
+            mode_ = mode;
+        }
+
+        //! Return the measured difference between Estrin and Clenshaw evaluation
+        const EvaluationAccuracy& get_accuracy() const {
+            return accuracy_;
+        }
+
+    private:
+
+        //! Number of Chebyshev coefficients per row
+        static constexpr size_t NC = N - 2;
+
+        //! Power series of one component over one granule
+        struct PowerGranule {
+            //! Lower bound of the granule [days]
+            double lb = 0.;
+
+            //! Upper bound of the granule [days]
+            double ub = 0.;
+
+            //! Power series coefficients in the normalized variable y
+            std::array<double, NC> coeff{};
+
+            //! Power series coefficients of the derivative with respect to y
+            std::array<double, NC - 1> derivative_coeff{};
+        };
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Evaluate the position with Estrin's scheme
+        std::array<double, 3> estrin_position(double mjdj2k_tdb, unsigned int ind) const {
+            const PowerGranule& x = x_power_[ind];
+            double y              = transform_to_chebyshev_range(mjdj2k_tdb, x.lb, x.ub);
+            return std::array<double, 3>{estrin_eval<NC>(y, x.coeff.data()), estrin_eval<NC>(y, y_power_[ind].coeff.data()),
+                                         estrin_eval<NC>(y, z_power_[ind].coeff.data())};
+        }
+
+        //! Evaluate the velocity with Estrin's scheme
+        std::array<double, 3> estrin_velocity(double mjdj2k_tdb, unsigned int ind) const {
+            // Define constant for number of seconds per day
+            static const double SEC_PER_DAY = 86400.0;
+
+            const PowerGranule& x = x_power_[ind];
+            double y              = transform_to_chebyshev_range(mjdj2k_tdb, x.lb, x.ub);
+            double factor         = 2. / (x.ub - x.lb) / SEC_PER_DAY;
+            return std::array<double, 3>{factor * estrin_eval<NC - 1>(y, x.derivative_coeff.data()),
+                                         factor * estrin_eval<NC - 1>(y, y_power_[ind].derivative_coeff.data()),
+                                         factor * estrin_eval<NC - 1>(y, z_power_[ind].derivative_coeff.data())};
+        }
+
+        //! Evaluate the position with Clenshaw's recurrence
+        std::array<double, 3> clenshaw_position(double mjdj2k_tdb, unsigned int ind) const {
+            std::array<double, 3> pos{0., 0., 0.};
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                const double* row = view_.get_row(comp, ind);
+                pos[comp]         = chebyshev_eval(mjdj2k_tdb, row[0], row[1], to_coeff(row), 1.0);
+            }
+            return pos;
+        }
+
+        //! Evaluate the velocity with Clenshaw's recurrence
+        std::array<double, 3> clenshaw_velocity(double mjdj2k_tdb, unsigned int ind) const {
+            // Define constant for number of seconds per day
+            static const double SEC_PER_DAY = 86400.0;
+
+            std::array<double, 3> vel{0., 0., 0.};
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                const double* row = view_.get_row(comp, ind);
+                vel[comp]         = chebyshev_derivative_eval(mjdj2k_tdb, row[0], row[1], to_coeff(row)) / SEC_PER_DAY;
+            }
+            return vel;
+        }
+
+        //! Copy the Chebyshev coefficients out of a row
+        static std::array<double, NC> to_coeff(const double* row) {
+            std::array<double, NC> coeff;
+            std::copy(row + 2, row + N, coeff.begin());
+            return coeff;
+        }
+
+        /*!
+         * \brief Measure the difference between Estrin and Clenshaw evaluation across every granule
+         *
+         * \param samples_per_granule Number of evenly spaced epochs sampled per granule, including both bounds
+         *
+         * \return Measured accuracy
+         */
+        EvaluationAccuracy measure_accuracy(unsigned int samples_per_granule) const {
+            EvaluationAccuracy accuracy;
+            double sum_sq = 0.;
+            unsigned int num_samples = std::max(samples_per_granule, 2u);
+
+            for (unsigned int ind = 0; ind < view_.num_granules; ind++) {
+                double lb = x_power_[ind].lb;
+                double ub = x_power_[ind].ub;
+                for (unsigned int k = 0; k < num_samples; k++) {
+                    double mjdj2k_tdb = lb + (ub - lb) * k / (num_samples - 1);
+
+                    std::array<double, 3> pos_estrin   = estrin_position(mjdj2k_tdb, ind);
+                    std::array<double, 3> pos_clenshaw = clenshaw_position(mjdj2k_tdb, ind);
+                    std::array<double, 3> vel_estrin   = estrin_velocity(mjdj2k_tdb, ind);
+                    std::array<double, 3> vel_clenshaw = clenshaw_velocity(mjdj2k_tdb, ind);
+
+                    for (unsigned int comp = 0; comp < 3; comp++) {
+                        double pos_err = std::abs(pos_estrin[comp] - pos_clenshaw[comp]);
+                        double vel_err = std::abs(vel_estrin[comp] - vel_clenshaw[comp]);
+                        accuracy.max_position_error = std::max(accuracy.max_position_error, pos_err);
+                        accuracy.max_velocity_error = std::max(accuracy.max_velocity_error, vel_err);
+                        sum_sq += pos_err * pos_err;
+                    }
+                    accuracy.num_samples++;
+                }
+            }
+
+            if (accuracy.num_samples > 0) {
+                accuracy.rms_position_error = std::sqrt(sum_sq / (3. * accuracy.num_samples));
+            }
+            return accuracy;
+        }
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! View of the source Chebyshev table, used for Clenshaw evaluation
+        EphemerisTableView view_;
+
+        //! Selected evaluation mode
+        EvaluationMode mode_;
+
+        //! Measured difference between Estrin and Clenshaw evaluation
+        EvaluationAccuracy accuracy_;
+
+        //! Power series for the x-coordinate
+        std::vector<PowerGranule> x_power_;
+
+        //! Power series for the y-coordinate
+        std::vector<PowerGranule> y_power_;
+
+        //! Power series for the z-coordinate
+        std::vector<PowerGranule> z_power_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,138 @@
+#include "shared_basis_evaluator.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <stdexcept>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/chebyshev/chebyshev_basis.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+/*!
+ * \brief Check whether two tables have identical granule boundaries
+ *
+ * \param a First table
+ * \param b Second table
+ *
+ * \return True if every granule of a has the same lb and ub as the corresponding granule of b
+ */
+bool same_granules(const EphemerisTableView& a, const EphemerisTableView& b) {
+    if (a.num_granules != b.num_granules || a.days_per_poly != b.days_per_poly || a.start_mjdj2k != b.start_mjdj2k
+        || a.stop_mjdj2k != b.stop_mjdj2k) {
+        return false;
+    }
+
+    for (unsigned int ind = 0; ind < a.num_granules; ind++) {
+        const double* a_row = a.get_row(0, ind);
+        const double* b_row = b.get_row(0, ind);
+        if (a_row[0] != b_row[0] || a_row[1] != b_row[1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+SharedBasisEvaluator::SharedBasisEvaluator(const std::vector<EphemerisTableView>& tables) : tables_(tables), groups_() {
+    for (unsigned int k = 0; k < tables_.size(); k++) {
+        if (tables_[k].num_coeff() > MAX_CHEBYSHEV_COEFF) {
+            throw std::invalid_argument("SharedBasisEvaluator() - Number of coefficients exceeds MAX_CHEBYSHEV_COEFF.");
+        }
+
+        // Add the table to an existing group if the granule boundaries match
+        bool grouped = false;
+        for (GranuleGroup& group : groups_) {
+            if (same_granules(tables_[group.tables[0]], tables_[k])) {
+                group.tables.push_back(k);
+                group.num_coeff = std::max(group.num_coeff, tables_[k].num_coeff());
+                grouped         = true;
+                break;
+            }
+        }
+
+        if (!grouped) {
+            GranuleGroup group;
+            group.tables.push_back(k);
+            group.num_coeff = tables_[k].num_coeff();
+            groups_.push_back(group);
+        }
+    }
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void SharedBasisEvaluator::get_positions(double mjdj2k_tdb, std::array<double, 3>* positions) const {
+    double basis[MAX_CHEBYSHEV_COEFF];
+
+    for (const GranuleGroup& group : groups_) {
+        // Every table in the group shares the same granule, so use the first to normalize the epoch
+        const EphemerisTableView& first = tables_[group.tables[0]];
+        unsigned int ind                = first.get_index(mjdj2k_tdb);
+        const double* bounds            = first.get_row(0, ind);
+        double y                        = transform_to_chebyshev_range(mjdj2k_tdb, bounds[0], bounds[1]);
+
+        chebyshev_basis(y, group.num_coeff, basis);
+
+        // Apply the coefficients of each table to the shared basis
+        for (unsigned int table_ind : group.tables) {
+            const EphemerisTableView& table = tables_[table_ind];
+            unsigned int num_coeff          = table.num_coeff();
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                const double* coeff = table.get_row(comp, ind) + 2;
+                double sum          = 0.;
+                for (unsigned int k = 0; k < num_coeff; k++) {
+                    sum += coeff[k] * basis[k];
+                }
+                positions[table_ind][comp] = sum;
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void SharedBasisEvaluator::get_velocities(double mjdj2k_tdb, std::array<double, 3>* velocities) const {
+    // Define constant for number of seconds per day
+    static const double SEC_PER_DAY = 86400.0;
+
+    double basis[MAX_CHEBYSHEV_COEFF];
+    double derivative_basis[MAX_CHEBYSHEV_COEFF];
+
+    for (const GranuleGroup& group : groups_) {
+        // Every table in the group shares the same granule, so use the first to normalize the epoch
+        const EphemerisTableView& first = tables_[group.tables[0]];
+        unsigned int ind                = first.get_index(mjdj2k_tdb);
+        const double* bounds            = first.get_row(0, ind);
+        double y                        = transform_to_chebyshev_range(mjdj2k_tdb, bounds[0], bounds[1]);
+        double factor                   = 2. / (bounds[1] - bounds[0]) / SEC_PER_DAY;
+
+        chebyshev_derivative_basis(y, group.num_coeff, basis, derivative_basis);
+
+        // Apply the coefficients of each table to the shared derivative basis
+        for (unsigned int table_ind : group.tables) {
+            const EphemerisTableView& table = tables_[table_ind];
+            unsigned int num_coeff          = table.num_coeff();
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                const double* coeff = table.get_row(comp, ind) + 2;
+                double sum          = 0.;
+                for (unsigned int k = 1; k < num_coeff; k++) {
+                    sum += coeff[k] * derivative_basis[k];
+                }
+                velocities[table_ind][comp] = factor * sum;
+            }
+        }
+    }
+}
+
+}  // End namespace jpl_ephemeris
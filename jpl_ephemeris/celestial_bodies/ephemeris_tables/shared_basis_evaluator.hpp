@@ -0,0 +1,104 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_SHARED_BASIS_EVALUATOR_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EPHEMERIS_TABLES_SHARED_BASIS_EVALUATOR_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/ephemeris_tables/shared_basis_evaluator.hpp
+ * \brief Evaluates several ephemeris tables at one epoch, sharing the Chebyshev basis between tables with identical
+ * granule boundaries
+ */
+
+// Standard Library Includes
+#include <array>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Evaluates several ephemeris tables at one epoch, sharing the Chebyshev basis between tables with identical
+ * granule boundaries
+ *
+ * \details Tables are grouped by granule geometry when the evaluator is constructed (e.g. the 16-day Sun and EMB
+ * granules, or the 4-day Moon and Earth-from-EMB granules). At query time the basis T_0(y)..T_n(y) is generated once per
+ * group, and every component of every table in the group is a dot product against that basis. The coefficient rows of a
+ * group therefore behave as a small dense matrix multiplied by the basis vector.
+ */
+class SharedBasisEvaluator {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Group the tables by granule geometry
+         *
+         * \param tables Views of the tables to evaluate. The views must remain valid for the lifetime of the evaluator.
+         *
+         * \throws std::invalid_argument If a table has more than MAX_CHEBYSHEV_COEFF coefficients
+         */
+        explicit SharedBasisEvaluator(const std::vector<EphemerisTableView>& tables);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Evaluate the position of every table
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param positions Output position of each table, in the order the tables were provided [km]. Must hold one entry
+         *     per table.
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by a table
+         */
+        void get_positions(double mjdj2k_tdb, std::array<double, 3>* positions) const;
+
+        /*!
+         * \brief Evaluate the velocity of every table
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param velocities Output velocity of each table, in the order the tables were provided [km/s]. Must hold one
+         *     entry per table.
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by a table
+         */
+        void get_velocities(double mjdj2k_tdb, std::array<double, 3>* velocities) const;
+
+        //! Return the number of tables being evaluated
+        size_t get_num_tables() const {
+            return tables_.size();
+        }
+
+        //! Return the number of distinct granule geometries, i.e. basis generations per query
+        size_t get_num_groups() const {
+            return groups_.size();
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Set of tables sharing the same granule boundaries
+        struct GranuleGroup {
+            //! Index into tables_ of each table in the group
+            std::vector<unsigned int> tables{};
+
+            //! Largest number of coefficients of any table in the group
+            unsigned int num_coeff = 0;
+        };
+
+        //! Views of the tables being evaluated
+        std::vector<EphemerisTableView> tables_;
+
+        //! Tables grouped by granule geometry
+        std::vector<GranuleGroup> groups_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -58,6 +58,15 @@ class SunFromSSBGCRFTable : public JPLEphemerisTable {
          */
         static std::array<double, 3> get_velocity(double mjdj2k_tdb);
 
+        /*!
+         * \brief Return a view of the Chebyshev polynomial coefficients stored in this table
+         *
+         * \return View of the x, y, z Chebyshev polynomial coefficients
+         */
+        static EphemerisTableView get_table_view() {
+            return make_table_view(x_interp_, y_interp_, z_interp_, days_per_poly_);
+        }
+
     private:
 
         //---------------------------------------
@@ -0,0 +1,295 @@
+#include "event_finder.hpp"
+
+// standard library includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_roots.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of Chebyshev-Lobatto points each event function is interpolated at, per segment
+constexpr size_t NUM_NODES = 33;
+
+//! Obliquity of the ecliptic at J2000 (IAU 2006) [rad]
+constexpr double OBLIQUITY_J2000 = 84381.406 / 3600.0 * std::numbers::pi / 180.0;
+
+//! States of the Sun and Moon relative to the Earth at one epoch
+struct Geometry {
+    //! State of the Moon relative to the Earth [km, km/s]
+    std::array<double, 6> moon{};
+
+    //! State of the Sun relative to the Earth [km, km/s], only filled in when an event type needs it
+    std::array<double, 6> sun{};
+};
+
+//! Range of epochs [begin, end] searched by one task
+struct Segment {
+    //! Start of the segment [days]
+    double begin = 0.;
+
+    //! End of the segment [days]
+    double end = 0.;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return +1 if the events of the specified type are sign changes from negative to positive, and -1 otherwise
+int get_direction(EventType type) {
+    switch (type) {
+        case EventType::LunarPerigee:
+        case EventType::NewMoon:
+        case EventType::FirstQuarter:
+        case EventType::FullMoon:
+        case EventType::LastQuarter:
+        case EventType::SunMoonAngleMax: {
+            return 1;
+        }
+        case EventType::LunarApogee:
+        case EventType::SunMoonAngleMin: {
+            return -1;
+        }
+        default: {
+            throw std::invalid_argument("EventFinder::find() - Unexpected input provided for EventType");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return true if the event function of the specified type depends on the Sun
+bool needs_sun(EventType type) {
+    return type != EventType::LunarPerigee && type != EventType::LunarApogee;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the geocentric angle between the Sun and the Moon [rad]
+double get_sun_moon_angle(const Geometry& geometry) {
+    const std::array<double, 6>& s = geometry.sun;
+    const std::array<double, 6>& m = geometry.moon;
+
+    std::array<double, 3> cross{s[1] * m[2] - s[2] * m[1], s[2] * m[0] - s[0] * m[2], s[0] * m[1] - s[1] * m[0]};
+    double dot = s[0] * m[0] + s[1] * m[1] + s[2] * m[2];
+    return std::atan2(std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]), dot);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the function whose sign changes, in the direction given by get_direction(), are the events of the specified type
+double get_event_function(EventType type, const Geometry& geometry) {
+    const std::array<double, 6>& s = geometry.sun;
+    const std::array<double, 6>& m = geometry.moon;
+
+    switch (type) {
+        case EventType::LunarPerigee:
+        case EventType::LunarApogee: {
+            // Proportional to the range rate of the Moon
+            return m[0] * m[3] + m[1] * m[4] + m[2] * m[5];
+        }
+        case EventType::NewMoon:
+        case EventType::FirstQuarter:
+        case EventType::FullMoon:
+        case EventType::LastQuarter: {
+            // sin(dlambda - phase), from the projections of the Sun and Moon onto the ecliptic plane
+            const double cos_eps = std::cos(OBLIQUITY_J2000);
+            const double sin_eps = std::sin(OBLIQUITY_J2000);
+
+            const double xs = s[0];
+            const double ys = cos_eps * s[1] + sin_eps * s[2];
+            const double xm = m[0];
+            const double ym = cos_eps * m[1] + sin_eps * m[2];
+
+            const double norm      = std::sqrt((xs * xs + ys * ys) * (xm * xm + ym * ym));
+            const double sin_delta = (xs * ym - ys * xm) / norm;
+            const double cos_delta = (xs * xm + ys * ym) / norm;
+
+            const double phase = 0.5 * std::numbers::pi * static_cast<double>(static_cast<int>(type)
+                                                                             - static_cast<int>(EventType::NewMoon));
+            return sin_delta * std::cos(phase) - cos_delta * std::sin(phase);
+        }
+        case EventType::SunMoonAngleMin:
+        case EventType::SunMoonAngleMax: {
+            // Rate of the cosine of the Sun-Moon angle, d(u.w)/dt with u and w the unit vectors to the Sun and Moon
+            const double s_norm = std::sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+            const double m_norm = std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+
+            std::array<double, 3> u{s[0] / s_norm, s[1] / s_norm, s[2] / s_norm};
+            std::array<double, 3> w{m[0] / m_norm, m[1] / m_norm, m[2] / m_norm};
+
+            const double u_dot_vs = u[0] * s[3] + u[1] * s[4] + u[2] * s[5];
+            const double w_dot_vm = w[0] * m[3] + w[1] * m[4] + w[2] * m[5];
+            const double u_dot_w  = u[0] * w[0] + u[1] * w[1] + u[2] * w[2];
+
+            // u' = (v_s - u (u.v_s)) / |s|, and likewise for w
+            const double u_rate = (w[0] * s[3] + w[1] * s[4] + w[2] * s[5] - u_dot_w * u_dot_vs) / s_norm;
+            const double w_rate = (u[0] * m[3] + u[1] * m[4] + u[2] * m[5] - u_dot_w * w_dot_vm) / m_norm;
+            return u_rate + w_rate;
+        }
+        default: {
+            throw std::invalid_argument("EventFinder::find() - Unexpected input provided for EventType");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the value reported with an event of the specified type
+double get_event_value(EventType type, const Geometry& geometry) {
+    if (type == EventType::LunarPerigee || type == EventType::LunarApogee) {
+        const std::array<double, 6>& m = geometry.moon;
+        return std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+    }
+    return get_sun_moon_angle(geometry);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Evaluate the states needed by the event functions at the specified epoch
+Geometry get_geometry(EphemerisContext& context, double mjdj2k_tdb, bool with_sun) {
+    Geometry geometry;
+    geometry.moon = context.get_state(CentralBody::Moon, mjdj2k_tdb);
+    if (with_sun) {
+        geometry.sun = context.get_state(CentralBody::Sun, mjdj2k_tdb);
+    }
+    return geometry;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Find the events of the specified types inside one segment, in increasing order of time
+std::vector<Event> find_segment_events(const EphemerisTableSet& tables, const std::vector<EventType>& types,
+                                       const Segment& segment) {
+    EphemerisContext context(tables);
+    bool with_sun = std::any_of(types.begin(), types.end(), needs_sun);
+
+    // The states at the interpolation points are shared by every event type
+    std::array<Geometry, NUM_NODES> nodes;
+    for (size_t j = 0; j < NUM_NODES; j++) {
+        double t = transform_from_chebyshev_range(chebyshev_lobatto_point<NUM_NODES>(j), segment.begin, segment.end);
+        nodes[j] = get_geometry(context, t, with_sun);
+    }
+
+    std::vector<Event> events;
+    for (EventType type : types) {
+        const int direction = get_direction(type);
+
+        std::array<double, NUM_NODES> values{};
+        for (size_t j = 0; j < NUM_NODES; j++) {
+            values[j] = get_event_function(type, nodes[j]);
+        }
+
+        std::array<double, NUM_NODES> coeff{};
+        chebyshev_lobatto_coefficients<NUM_NODES>(values, coeff);
+
+        for (double y : chebyshev_sign_changes<NUM_NODES>(coeff)) {
+            double value      = 0.;
+            double derivative = 0.;
+            chebyshev_state_eval_normalized<NUM_NODES>(y, coeff.data(), value, derivative);
+            if (derivative * direction <= 0.) {
+                continue;
+            }
+
+            // Polish the root of the interpolant with one Newton step on the function evaluated from the tables
+            double t          = transform_from_chebyshev_range(y, segment.begin, segment.end);
+            Geometry geometry = get_geometry(context, t, with_sun);
+            double rate       = derivative * 2. / (segment.end - segment.begin);
+            t                 = std::clamp(t - get_event_function(type, geometry) / rate, segment.begin, segment.end);
+
+            events.push_back(Event{t, type, get_event_value(type, geometry)});
+        }
+    }
+
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event& lhs, const Event& rhs) { return lhs.mjdj2k_tdb < rhs.mjdj2k_tdb; });
+    return events;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+EventFinder::EventFinder(unsigned int num_threads) :
+    pool_(std::make_shared<ThreadPool>(num_threads)), executor_(), tables_(EphemerisTableSet::get_compiled_in()) {
+    std::shared_ptr<ThreadPool> pool = pool_;
+    executor_ = [pool](size_t num_tasks, const std::function<void(size_t)>& task) { pool->run(num_tasks, task); };
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EventFinder::EventFinder(BatchExecutor executor) :
+    pool_(), executor_(std::move(executor)), tables_(EphemerisTableSet::get_compiled_in()) {
+    if (!executor_) {
+        throw std::invalid_argument("EventFinder() - The provided executor is empty.");
+    }
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::vector<Event> EventFinder::find(EventType type, double start_mjdj2k_tdb, double stop_mjdj2k_tdb) {
+    return find(std::vector<EventType>{type}, start_mjdj2k_tdb, stop_mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<Event> EventFinder::find(const std::vector<EventType>& types, double start_mjdj2k_tdb,
+                                     double stop_mjdj2k_tdb) {
+    // Validate everything up front, so no exception is raised from inside the executor
+    for (EventType type : types) {
+        get_direction(type);
+    }
+
+    if (!(start_mjdj2k_tdb < stop_mjdj2k_tdb)) {
+        throw std::invalid_argument("EventFinder::find() - The start of the search interval must be before its end.");
+    }
+
+    for (const EphemerisTableView& view : tables_.get_views()) {
+        view.get_index(start_mjdj2k_tdb);
+        view.get_index(stop_mjdj2k_tdb);
+    }
+
+    if (types.empty()) {
+        return {};
+    }
+
+    // Split the interval on the Moon granules, which also bound the granules of the other tables
+    const EphemerisTableView& moon = tables_.moon;
+    std::vector<Segment> segments;
+    double begin = start_mjdj2k_tdb;
+    while (begin < stop_mjdj2k_tdb) {
+        double ind = std::floor((begin - moon.start_mjdj2k) / moon.days_per_poly) + 1.;
+        double end = moon.start_mjdj2k + ind * moon.days_per_poly;
+        if (end <= begin) {
+            end += moon.days_per_poly;
+        }
+        end = std::min(end, stop_mjdj2k_tdb);
+
+        segments.push_back(Segment{begin, end});
+        begin = end;
+    }
+
+    std::vector<std::vector<Event>> segment_events(segments.size());
+    executor_(segments.size(),
+              [&](size_t k) { segment_events[k] = find_segment_events(tables_, types, segments[k]); });
+
+    std::vector<Event> events;
+    for (const std::vector<Event>& segment : segment_events) {
+        events.insert(events.end(), segment.begin(), segment.end());
+    }
+    return events;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,134 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_EVENT_FINDER_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_EVENT_FINDER_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/event_finder.hpp
+ * \brief Defines a class for finding lunar apsides, lunar phases, and Sun-Moon angular extrema
+ */
+
+// standard library includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/batch_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/parallel/thread_pool.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies a type of event found by the EventFinder
+enum class EventType : int {
+    LunarPerigee = 0,     //!< Minimum of the Earth-Moon distance
+    LunarApogee = 1,      //!< Maximum of the Earth-Moon distance
+    NewMoon = 2,          //!< Geocentric ecliptic longitude of the Moon equals that of the Sun
+    FirstQuarter = 3,     //!< Geocentric ecliptic longitude of the Moon is 90 deg past that of the Sun
+    FullMoon = 4,         //!< Geocentric ecliptic longitude of the Moon is 180 deg past that of the Sun
+    LastQuarter = 5,      //!< Geocentric ecliptic longitude of the Moon is 270 deg past that of the Sun
+    SunMoonAngleMin = 6,  //!< Minimum of the geocentric angle between the Sun and the Moon
+    SunMoonAngleMax = 7,  //!< Maximum of the geocentric angle between the Sun and the Moon
+};
+
+//! Event found by the EventFinder
+struct Event {
+    //! Modified Julian Date from the J2000 Epoch of the event, in the TDB Time System
+    double mjdj2k_tdb = 0.;
+
+    //! Type of the event
+    EventType type = EventType::LunarPerigee;
+
+    //! Earth-Moon distance [km] for the apsides, and the geocentric Sun-Moon angle [rad] otherwise
+    double value = 0.;
+};
+
+/*!
+ * \brief Defines a class for finding lunar apsides, lunar phases, and Sun-Moon angular extrema
+ *
+ * \details Each event is a sign change of a smooth function of the geometric Sun and Moon states relative to the Earth:
+ * the range rate for the apsides, sin(dlambda - phase) for the phases, where dlambda is the difference of the ecliptic
+ * longitudes, and the rate of the cosine of the Sun-Moon angle for the angular extrema.
+ *
+ * The search interval is split on the Moon granules, which also lie inside single granules of the other tables, so each
+ * function is smooth on a segment. On each segment the function is interpolated at 33 Chebyshev-Lobatto points, its sign
+ * changes are bracketed with the derivative bound of the interpolant (see chebyshev_sign_changes), and each root is
+ * refined on the interpolant and then polished with one Newton step on the tables. The segments are searched in parallel,
+ * each with its own EphemerisContext, and the results do not depend on the number of threads.
+ *
+ * The functions use geometric positions in the mean ecliptic of J2000, without light time or aberration, so the phase
+ * times differ from almanac (apparent, ecliptic of date) values by up to about a minute.
+ */
+class EventFinder {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create an event finder with its own thread pool
+         *
+         * \param num_threads Number of threads used, including the calling thread. Zero uses the hardware concurrency.
+         */
+        explicit EventFinder(unsigned int num_threads = 0);
+
+        /*!
+         * \brief Create an event finder that runs its segments on a caller-supplied executor
+         *
+         * \param executor Executor used to run the segments
+         *
+         * \throws std::invalid_argument If executor is empty
+         */
+        explicit EventFinder(BatchExecutor executor);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Find every event of the specified type in [start, stop]
+         *
+         * \param type Type of event to find
+         * \param start_mjdj2k_tdb Start of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param stop_mjdj2k_tdb End of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         *
+         * \return Events in increasing order of time
+         *
+         * \throws std::invalid_argument If the interval is empty, or an unexpected value is provided for type
+         * \throws std::out_of_range If the interval is outside of the range covered by the tables
+         */
+        std::vector<Event> find(EventType type, double start_mjdj2k_tdb, double stop_mjdj2k_tdb);
+
+        /*!
+         * \brief Find every event of the specified types in [start, stop], sharing the table evaluations between types
+         *
+         * \param types Types of event to find
+         * \param start_mjdj2k_tdb Start of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param stop_mjdj2k_tdb End of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         *
+         * \return Events in increasing order of time
+         *
+         * \throws std::invalid_argument If the interval is empty, or an unexpected value is provided in types
+         * \throws std::out_of_range If the interval is outside of the range covered by the tables
+         */
+        std::vector<Event> find(const std::vector<EventType>& types, double start_mjdj2k_tdb, double stop_mjdj2k_tdb);
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Thread pool owned by this object, when no executor was supplied
+        std::shared_ptr<ThreadPool> pool_;
+
+        //! Executor that runs the segments
+        BatchExecutor executor_;
+
+        //! Views of the tables
+        EphemerisTableSet tables_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
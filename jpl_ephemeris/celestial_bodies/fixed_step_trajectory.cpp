@@ -0,0 +1,119 @@
+#include "fixed_step_trajectory.hpp"
+
+// standard library includes
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+// Define constant for number of seconds per day
+const double SEC_PER_DAY = 86400.0;
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+FixedStepTrajectory::FixedStepTrajectory(CentralBody target, double start_mjdj2k_tdb, double step_sec,
+                                         size_t num_steps, CentralBody central_body) :
+    target_(target), central_body_(central_body), start_(start_mjdj2k_tdb), step_days_(step_sec / SEC_PER_DAY),
+    num_steps_(num_steps), sun_from_ssb_(SunFromSSBGCRFTable::get_table_view(), start_, step_days_),
+    emb_from_ssb_(EMBFromSSBGCRFTable::get_table_view(), start_, step_days_),
+    earth_from_emb_(EarthFromEMBGCRFTable::get_table_view(), start_, step_days_),
+    moon_(MoonGCRFTable::get_table_view(), start_, step_days_), current_() {
+
+    if (num_steps_ == 0) {
+        return;
+    }
+
+    // Every table covers the same range, so checking the last epoch against one of them covers the whole grid
+    const EphemerisTableView moon = MoonGCRFTable::get_table_view();
+    double last_epoch             = get_epoch(num_steps_ - 1);
+    if (!(start_ >= moon.start_mjdj2k && last_epoch <= moon.stop_mjdj2k)) {
+        throw std::out_of_range("FixedStepTrajectory() - Epochs of the trajectory are outside of the valid range for "
+                                "the Chebyshev polynomial coefficients.");
+    }
+
+    // Evaluate the first step, which throws for an unexpected CentralBody
+    get_point(0);
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+FixedStepTrajectory::Iterator FixedStepTrajectory::begin() {
+    if (num_steps_ > 0) {
+        get_point(0);
+    }
+    return Iterator(this, 0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const TrajectoryPoint& FixedStepTrajectory::get_point(size_t step_index) {
+    if (step_index >= num_steps_) {
+        throw std::out_of_range("FixedStepTrajectory::get_point() - Step index is past the end of the trajectory.");
+    }
+
+    current_.mjdj2k_tdb = get_epoch(step_index);
+    current_.state      = compute_table_relative_vector(
+        target_, central_body_, sun_from_ssb_, emb_from_ssb_, earth_from_emb_, moon_,
+        [&](auto& table) { return table.get_state(step_index); },
+        "FixedStepTrajectory::get_point() - Unexpected input provided for CentralBody");
+    return current_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+size_t FixedStepTrajectory::get_num_resets() const {
+    return sun_from_ssb_.get_num_resets() + emb_from_ssb_.get_num_resets() + earth_from_emb_.get_num_resets()
+           + moon_.get_num_resets();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TrajectoryDrift FixedStepTrajectory::measure_drift(size_t sample_stride) const {
+    sample_stride = std::max<size_t>(sample_stride, 1);
+
+    FixedStepTrajectory trajectory = *this;
+    EphemerisContext context;
+
+    TrajectoryDrift drift;
+    double sum_sq = 0.;
+    for (size_t ind = 0; ind < num_steps_; ind++) {
+        const TrajectoryPoint& point = trajectory.get_point(ind);
+        if (ind % sample_stride != 0) {
+            continue;
+        }
+
+        std::array<double, 6> direct = context.get_state(target_, point.mjdj2k_tdb, central_body_);
+        for (unsigned int comp = 0; comp < 3; comp++) {
+            double pos_err           = std::abs(point.state[comp] - direct[comp]);
+            double vel_err           = std::abs(point.state[comp + 3] - direct[comp + 3]);
+            drift.max_position_error = std::max(drift.max_position_error, pos_err);
+            drift.max_velocity_error = std::max(drift.max_velocity_error, vel_err);
+            sum_sq += pos_err * pos_err;
+        }
+        drift.num_samples++;
+    }
+
+    if (drift.num_samples > 0) {
+        drift.rms_position_error = std::sqrt(sum_sq / (3. * static_cast<double>(drift.num_samples)));
+    }
+    return drift;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,217 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_FIXED_STEP_TRAJECTORY_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_FIXED_STEP_TRAJECTORY_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/fixed_step_trajectory.hpp
+ * \brief Defines a range producing the state of a body at a fixed time step, updated incrementally inside each granule
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/fixed_step_stepper.hpp"
+
+namespace jpl_ephemeris {
+
+//! State of a body at one step of a FixedStepTrajectory
+struct TrajectoryPoint {
+    //! Epoch, MJD J2K TDB [days]
+    double mjdj2k_tdb = 0.;
+
+    //! Position [km] and velocity [km/s] in the GCRF frame, stacked as [x, y, z, vx, vy, vz]
+    std::array<double, 6> state{};
+};
+
+//! Difference between a FixedStepTrajectory and direct evaluation of the tables, measured over the trajectory
+struct TrajectoryDrift {
+    //! Maximum position difference over all components and samples [km]
+    double max_position_error = 0.;
+
+    //! Maximum velocity difference over all components and samples [km/s]
+    double max_velocity_error = 0.;
+
+    //! Root-mean-square position difference over all components and samples [km]
+    double rms_position_error = 0.;
+
+    //! Number of steps compared
+    size_t num_samples = 0;
+};
+
+/*!
+ * \brief Defines a range producing the state of a body at a fixed time step, updated incrementally inside each granule
+ *
+ * \details The epochs are t_i = start + i * step, for i = 0..num_steps-1. Each table involved keeps a forward difference
+ * table of its polynomials (see FixedStepStepper), which is rebuilt at the first step inside each granule, so a step
+ * inside a granule costs a few additions per coefficient rather than a granule lookup and a Clenshaw recurrence.
+ *
+ * \note The Chebyshev variable y is linear in time, so a fixed time step is a fixed step in y and the polynomials can be
+ * stepped exactly with forward differences. Only rounding error accumulates, which measure_drift() reports.
+ *
+ * The range is single-pass: iterating it, or calling get_point(), advances the shared difference tables.
+ *
+ *     FixedStepTrajectory trajectory(CentralBody::Moon, 0.0, 30.0, 1000000);
+ *     for (const TrajectoryPoint& point : trajectory) { ... }
+ */
+class FixedStepTrajectory {
+    public:
+
+        //! Input iterator over the steps of a FixedStepTrajectory
+        class Iterator {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type        = TrajectoryPoint;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const TrajectoryPoint*;
+                using reference         = const TrajectoryPoint&;
+
+                //! Create an iterator at the specified step
+                Iterator(FixedStepTrajectory* trajectory, size_t step_index) :
+                    trajectory_(trajectory), index_(step_index) {}
+
+                //! Return the state at the current step
+                reference operator*() const {
+                    return trajectory_->current_;
+                }
+
+                //! Access the state at the current step
+                pointer operator->() const {
+                    return &trajectory_->current_;
+                }
+
+                //! Advance to the next step
+                Iterator& operator++() {
+                    index_++;
+                    if (index_ < trajectory_->num_steps_) {
+                        trajectory_->get_point(index_);
+                    }
+                    return *this;
+                }
+
+                //! Compare the step of two iterators
+                bool operator==(const Iterator& other) const {
+                    return index_ == other.index_;
+                }
+
+            private:
+
+                //! Trajectory being iterated
+                FixedStepTrajectory* trajectory_;
+
+                //! Index of the current step
+                size_t index_;
+        };
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create a fixed-step trajectory of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose state is computed
+         * \param start_mjdj2k_tdb First epoch, MJD J2K TDB [days]
+         * \param step_sec Time step, which must be positive [sec]
+         * \param num_steps Number of steps
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If step_sec is not positive, or an unexpected value is provided for target or
+         *     central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         */
+        FixedStepTrajectory(CentralBody target, double start_mjdj2k_tdb, double step_sec, size_t num_steps,
+                            CentralBody central_body = CentralBody::Earth);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return an iterator at the first step, rewinding the trajectory
+        Iterator begin();
+
+        //! Return an iterator past the last step
+        Iterator end() {
+            return Iterator(this, num_steps_);
+        }
+
+        /*!
+         * \brief Return the state at the specified step
+         *
+         * \details Steps are cheapest in increasing order; any other access rebuilds the difference tables.
+         *
+         * \param step_index Index of the step, which must be less than size()
+         *
+         * \return State at the step
+         *
+         * \throws std::out_of_range If step_index is not less than size()
+         */
+        const TrajectoryPoint& get_point(size_t step_index);
+
+        //! Return the number of steps
+        size_t size() const {
+            return num_steps_;
+        }
+
+        //! Return the epoch of the specified step, MJD J2K TDB [days]
+        double get_epoch(size_t step_index) const {
+            return start_ + static_cast<double>(step_index) * step_days_;
+        }
+
+        //! Return the number of times a difference table was rebuilt, summed over all tables
+        size_t get_num_resets() const;
+
+        /*!
+         * \brief Measure the drift of the incremental evaluation against direct evaluation of the tables
+         *
+         * \details Runs a copy of this trajectory over every step, so the state of this trajectory is not affected, and
+         * compares every sample_stride-th step with a direct Clenshaw evaluation.
+         *
+         * \param sample_stride Number of steps between compared samples, zero is treated as one
+         *
+         * \return Measured drift
+         */
+        TrajectoryDrift measure_drift(size_t sample_stride = 1) const;
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Body whose state is computed
+        CentralBody target_;
+
+        //! Central body that the target is measured relative to
+        CentralBody central_body_;
+
+        //! First epoch [days]
+        double start_;
+
+        //! Time step [days]
+        double step_days_;
+
+        //! Number of steps
+        size_t num_steps_;
+
+        //! Stepper for the Sun relative to the SSB
+        FixedStepStepper<13> sun_from_ssb_;
+
+        //! Stepper for the EMB relative to the SSB
+        FixedStepStepper<15> emb_from_ssb_;
+
+        //! Stepper for the Earth relative to the EMB
+        FixedStepStepper<15> earth_from_emb_;
+
+        //! Stepper for the Moon relative to the Earth
+        FixedStepStepper<15> moon_;
+
+        //! State at the most recently evaluated step
+        TrajectoryPoint current_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,61 @@
+#include "frame_ephemeris.hpp"
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+FrameEphemeris::FrameEphemeris(InertialFrame frame) :
+    sun_from_ssb_(SunFromSSBGCRFTable::get_table_view(), frame, "sun_from_ssb rotated"),
+    emb_from_ssb_(EMBFromSSBGCRFTable::get_table_view(), frame, "emb_from_ssb rotated"),
+    earth_from_emb_(EarthFromEMBGCRFTable::get_table_view(), frame, "earth_from_emb rotated"),
+    moon_(MoonGCRFTable::get_table_view(), frame, "moon rotated") {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+FrameEphemeris::FrameEphemeris(const RotationMatrix& rot_from_gcrf) :
+    sun_from_ssb_(SunFromSSBGCRFTable::get_table_view(), rot_from_gcrf, "sun_from_ssb rotated"),
+    emb_from_ssb_(EMBFromSSBGCRFTable::get_table_view(), rot_from_gcrf, "emb_from_ssb rotated"),
+    earth_from_emb_(EarthFromEMBGCRFTable::get_table_view(), rot_from_gcrf, "earth_from_emb rotated"),
+    moon_(MoonGCRFTable::get_table_view(), rot_from_gcrf, "moon rotated") {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> FrameEphemeris::get_position(CentralBody target, double mjdj2k_tdb,
+                                                   CentralBody central_body) const {
+    return get_relative(target, mjdj2k_tdb, central_body, false);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> FrameEphemeris::get_velocity(CentralBody target, double mjdj2k_tdb,
+                                                   CentralBody central_body) const {
+    return get_relative(target, mjdj2k_tdb, central_body, true);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> FrameEphemeris::get_relative(CentralBody target, double mjdj2k_tdb, CentralBody central_body,
+                                                   bool velocity) const {
+    // Evaluate either the position or velocity of a table
+    auto eval = [&](const auto& table) {
+        return velocity ? table.get_velocity(mjdj2k_tdb) : table.get_position(mjdj2k_tdb);
+    };
+
+    return compute_table_relative_vector(
+        target, central_body, sun_from_ssb_, emb_from_ssb_, earth_from_emb_, moon_, eval,
+        velocity ? "FrameEphemeris::get_velocity() - Unexpected input provided for CentralBody"
+                 : "FrameEphemeris::get_position() - Unexpected input provided for CentralBody");
+}
+
+}  // namespace jpl_ephemeris
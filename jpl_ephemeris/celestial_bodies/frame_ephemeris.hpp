@@ -0,0 +1,131 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_FRAME_EPHEMERIS_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_FRAME_EPHEMERIS_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/frame_ephemeris.hpp
+ * \brief Defines a class for computing the position/velocity of the Sun, Earth, and Moon in an inertial frame other than
+ * GCRF
+ */
+
+// standard library includes
+#include <array>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/frame_ephemeris_table.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Defines a class for computing the position/velocity of the Sun, Earth, and Moon in an inertial frame other than
+ * GCRF
+ *
+ * \details All of the compiled-in tables are rotated into the requested frame when the object is constructed, so each
+ * query runs the same number of Clenshaw evaluations as the equivalent call on the Sun, Earth, or Moon classes. Each
+ * instance holds a rotated copy of every table (roughly 8 MB), so construct it once and reuse it.
+ */
+class FrameEphemeris {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Rotate the compiled-in tables into one of the predefined inertial frames
+         *
+         * \param frame Inertial frame to rotate into
+         *
+         * \throws std::invalid_argument If frame is InertialFrame::UserDefined
+         */
+        explicit FrameEphemeris(InertialFrame frame);
+
+        /*!
+         * \brief Rotate the compiled-in tables by a user-supplied constant rotation
+         *
+         * \param rot_from_gcrf Rotation matrix, R, such that r_frame = R * r_gcrf
+         */
+        explicit FrameEphemeris(const RotationMatrix& rot_from_gcrf);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Position of the target relative to the specified CentralBody, in the frame of this object [km]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         */
+        std::array<double, 3> get_position(CentralBody target, double mjdj2k_tdb,
+                                           CentralBody central_body = CentralBody::Earth) const;
+
+        /*!
+         * \brief Return the velocity of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose velocity is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Velocity of the target relative to the specified CentralBody, in the frame of this object [km/s]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         */
+        std::array<double, 3> get_velocity(CentralBody target, double mjdj2k_tdb,
+                                           CentralBody central_body = CentralBody::Earth) const;
+
+        //! Return the inertial frame the tables are expressed in
+        InertialFrame get_frame() const {
+            return moon_.get_frame();
+        }
+
+        //! Return the rotation matrix from GCRF that was applied to the tables
+        const RotationMatrix& get_rotation_from_gcrf() const {
+            return moon_.get_rotation_from_gcrf();
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute the position or velocity of the target relative to the central body
+         *
+         * \param target Body whose state is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         * \param velocity If true, compute velocity, otherwise compute position
+         *
+         * \return Position [km] or velocity [km/s] of the target relative to the central body
+         */
+        std::array<double, 3> get_relative(CentralBody target, double mjdj2k_tdb, CentralBody central_body,
+                                           bool velocity) const;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Sun relative to the SSB
+        FrameEphemerisTable<13> sun_from_ssb_;
+
+        //! EMB relative to the SSB
+        FrameEphemerisTable<15> emb_from_ssb_;
+
+        //! Earth relative to the EMB
+        FrameEphemerisTable<15> earth_from_emb_;
+
+        //! Moon relative to the Earth
+        FrameEphemerisTable<15> moon_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,107 @@
+#include "lunar_libration.hpp"
+
+// standard library includes
+#include <cmath>
+#include <utility>
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+LunarLibration::LunarLibration(DEAsciiTable table) :
+    table_(std::move(table).expect_row_size(3, ROW_SIZE)), cache_(table_.get_view()) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+LunarLibration LunarLibration::from_de_ascii(const std::string& header_file, const std::vector<std::string>& data_files) {
+    return LunarLibration(DEAsciiTable::load(header_file, data_files, DEAsciiTable::LIBRATION_COLUMN, 3));
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> LunarLibration::get_angles(double mjdj2k_tdb) {
+    return cache_.get_position(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> LunarLibration::get_rates(double mjdj2k_tdb) {
+    return cache_.get_velocity(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 6> LunarLibration::get_state(double mjdj2k_tdb) {
+    return cache_.get_state(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> LunarLibration::get_angular_velocity(double mjdj2k_tdb) {
+    const std::array<double, 6> state = cache_.get_state(mjdj2k_tdb);
+
+    const double st = std::sin(state[1]), ct = std::cos(state[1]);
+    const double sp = std::sin(state[2]), cp = std::cos(state[2]);
+    return std::array<double, 3>{state[3] * st * sp + state[4] * cp, state[3] * st * cp - state[4] * sp,
+                                 state[3] * ct + state[5]};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix LunarLibration::get_rotation_from_gcrf(double mjdj2k_tdb) {
+    const std::array<double, 3> angles = cache_.get_position(mjdj2k_tdb);
+    return get_rotation(angles.data());
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void LunarLibration::get_angles(const double* mjdj2k_tdb, size_t num_epochs, double* angles) {
+    cache_.get_positions(mjdj2k_tdb, num_epochs, angles);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void LunarLibration::get_states(const double* mjdj2k_tdb, size_t num_epochs, double* states) {
+    cache_.get_states(mjdj2k_tdb, num_epochs, states);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void LunarLibration::get_rotations_from_gcrf(const double* mjdj2k_tdb, size_t num_epochs, RotationMatrix* rotations) {
+    for (size_t i = 0; i < num_epochs; i++) {
+        const std::array<double, 3> angles = cache_.get_position(mjdj2k_tdb[i]);
+        rotations[i]                       = get_rotation(angles.data());
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double LunarLibration::get_start_mjdj2k() const {
+    return table_.get_view().start_mjdj2k;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double LunarLibration::get_stop_mjdj2k() const {
+    return table_.get_view().stop_mjdj2k;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix LunarLibration::get_rotation(const double* angles) {
+    const double sf = std::sin(angles[0]), cf = std::cos(angles[0]);
+    const double st = std::sin(angles[1]), ct = std::cos(angles[1]);
+    const double sp = std::sin(angles[2]), cp = std::cos(angles[2]);
+
+    RotationMatrix rot{};
+    rot[0] = {cp * cf - sp * ct * sf, cp * sf + sp * ct * cf, sp * st};
+    rot[1] = {-sp * cf - cp * ct * sf, -sp * sf + cp * ct * cf, cp * st};
+    rot[2] = {st * sf, -st * cf, ct};
+    return rot;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,188 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_LUNAR_LIBRATION_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_LUNAR_LIBRATION_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/lunar_libration.hpp
+ * \brief Defines a class for evaluating the orientation of the lunar mantle from the librations of the DE ephemeris
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_ascii_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Defines a class for evaluating the orientation of the lunar mantle from the librations of the DE ephemeris
+ *
+ * \details The DE ephemerides integrate the orientation of the lunar mantle as the 3-1-3 Euler angles (phi, theta, psi)
+ * from the ICRF to the mean-Earth/principal-axis frame of the Moon (Moon PA), stored in GROUP 1050 next to the bodies
+ * (899 10 4 in header.430_572). The angles are loaded from the ASCII DE files into a DEAsciiTable and evaluated with a
+ * GranuleCache, so an angle and its rate share one Clenshaw recurrence, exactly like a position and velocity.
+ *
+ * The rotation from the GCRF to the Moon PA frame is R3(psi) * R1(theta) * R3(phi), which reproduces the MOON_PA frame of
+ * the DE PCK files without going through CSpice. Every query updates the cache, so each thread needs its own instance,
+ * e.g.
+ *
+ *     LunarLibration libration = LunarLibration::from_de_ascii("header.430_572", {"ascp1950.430", "ascp2050.430"});
+ *     RotationMatrix rot = libration.get_rotation_from_gcrf(mjdj2k_tdb);
+ */
+class LunarLibration {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create an instance that evaluates the specified table
+         *
+         * \param table Table of the librations, with 3 components of 10 coefficients
+         *
+         * \throws std::invalid_argument If table does not have 3 components of 10 coefficients
+         */
+        explicit LunarLibration(DEAsciiTable table);
+
+        /*!
+         * \brief Create an instance from the librations column of the ASCII DE files
+         *
+         * \param header_file Path to the header file (e.g. header.430_572)
+         * \param data_files Paths to the data files (e.g. ascp1950.430, ascp2050.430), in increasing order of time
+         *
+         * \return Instance covering the data files
+         *
+         * \throws std::invalid_argument If a file cannot be read, or the header has no librations of 10 coefficients
+         */
+        static LunarLibration from_de_ascii(const std::string& header_file, const std::vector<std::string>& data_files);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the Euler angles of the lunar mantle
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Euler angles (phi, theta, psi) [rad]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 3> get_angles(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the rates of the Euler angles of the lunar mantle
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Rates of the Euler angles (phi, theta, psi) [rad/s]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 3> get_rates(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the Euler angles and their rates, sharing a single recurrence per angle
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Angles [rad] and rates [rad/s], stacked as [phi, theta, psi, dphi, dtheta, dpsi]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 6> get_state(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the angular velocity of the lunar mantle, expressed in the Moon PA frame
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Angular velocity [rad/s]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 3> get_angular_velocity(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the rotation from the GCRF frame to the Moon PA frame
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Rotation matrix, such that r_pa = R * r_gcrf
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        RotationMatrix get_rotation_from_gcrf(double mjdj2k_tdb);
+
+        /*!
+         * \brief Evaluate the Euler angles at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param angles Output angles [rad], 3 per epoch as (phi, theta, psi)
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_angles(const double* mjdj2k_tdb, size_t num_epochs, double* angles);
+
+        /*!
+         * \brief Evaluate the Euler angles and their rates at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param states Output states, 6 per epoch as [phi, theta, psi, dphi, dtheta, dpsi] [rad, rad/s]
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_states(const double* mjdj2k_tdb, size_t num_epochs, double* states);
+
+        /*!
+         * \brief Evaluate the rotation from the GCRF frame to the Moon PA frame at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param rotations Output rotation matrices, one per epoch
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_rotations_from_gcrf(const double* mjdj2k_tdb, size_t num_epochs, RotationMatrix* rotations);
+
+        //! Return the first epoch covered by the table, in the TDB Time System
+        double get_start_mjdj2k() const;
+
+        //! Return the last epoch covered by the table, in the TDB Time System
+        double get_stop_mjdj2k() const;
+
+    private:
+
+        //! Number of values per row of the librations table, including the lb and ub values
+        static constexpr size_t ROW_SIZE = 12;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return the rotation R3(psi) * R1(theta) * R3(phi)
+        static RotationMatrix get_rotation(const double* angles);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Table of the librations
+        DEAsciiTable table_;
+
+        //! Cache of the last granule of the table
+        GranuleCache<ROW_SIZE> cache_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,361 @@
+#include "occultation_finder.hpp"
+
+// standard library includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_basis.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_roots.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of seconds per day
+constexpr double SEC_PER_DAY = 86400.0;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return an upper bound on the speed [km/s] given by the granule of the view that contains mjdj2k_tdb
+double get_speed_bound(const EphemerisTableView& view, double mjdj2k_tdb) {
+    if (view.num_coeff() > MAX_CHEBYSHEV_COEFF) {
+        throw std::invalid_argument("OccultationFinder() - Number of coefficients exceeds MAX_CHEBYSHEV_COEFF.");
+    }
+    unsigned int ind = view.get_index(mjdj2k_tdb);
+
+    // |T_k| <= 1 on [-1, 1], so the sum of the magnitudes of the derivative coefficients bounds each component
+    std::array<double, MAX_CHEBYSHEV_COEFF - 1> derivative{};
+    double sum_sq = 0.;
+    for (unsigned int i = 0; i < 3; i++) {
+        const double* row = view.get_row(i, ind);
+        chebyshev_derivative_coefficients(row + 2, view.num_coeff(), row[0], row[1], 1. / SEC_PER_DAY, derivative.data());
+
+        double bound = 0.;
+        for (unsigned int k = 0; k + 1 < view.num_coeff(); k++) {
+            bound += std::abs(derivative[k]);
+        }
+        sum_sq += bound * bound;
+    }
+    return std::sqrt(sum_sq);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+/*!
+ * \brief Return an upper bound on the change [rad] of the direction plus the change of the apparent radius of a body, as
+ * seen from the observer, when the vector from the observer to the body moves by at most shift
+ *
+ * \param shift Upper bound on the displacement of the vector [km]
+ * \param dist Current distance from the observer to the body [km]
+ * \param radius Radius of the body [km]
+ */
+double get_angular_change_bound(double shift, double dist, double radius) {
+    // A vector of length dist displaced by shift turns by at most asin(shift / dist)
+    const double direction = shift < dist ? std::asin(shift / dist) : std::numbers::pi;
+
+    // The apparent radius asin(R / d) grows the most when the body comes straight towards the observer
+    const double closest = std::max(dist - shift, radius);
+    return direction + std::asin(std::min(radius / closest, 1.)) - std::asin(std::min(radius / dist, 1.));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the norm of a vector
+double get_norm(const std::array<double, 3>& vec) {
+    return std::sqrt(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]);
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+OccultationFinder::OccultationFinder() : OccultationFinder(EphemerisTableSet::get_compiled_in()) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+OccultationFinder::OccultationFinder(const EphemerisTableSet& tables) :
+    tables_(tables), context_(tables), sun_radius_(DEConstants::asun), earth_radius_(DEConstants::re),
+    moon_radius_(DEConstants::am) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::vector<OccultationWindow> OccultationFinder::find(OccultationType type, const ObserverFunction& observer,
+                                                       double max_observer_speed, double start_mjdj2k_tdb,
+                                                       double stop_mjdj2k_tdb, OccultationDepth depth) {
+    if (!observer) {
+        throw std::invalid_argument("OccultationFinder::find() - The provided observer is empty.");
+    }
+
+    if (!(max_observer_speed >= 0.)) {
+        throw std::invalid_argument("OccultationFinder::find() - The observer speed bound must be non-negative.");
+    }
+
+    return search(type, &observer, max_observer_speed, start_mjdj2k_tdb, stop_mjdj2k_tdb, depth);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<OccultationWindow> OccultationFinder::find_lunar_eclipses(double start_mjdj2k_tdb, double stop_mjdj2k_tdb,
+                                                                      OccultationDepth depth) {
+    return search(OccultationType::SunByEarth, nullptr, 0., start_mjdj2k_tdb, stop_mjdj2k_tdb, depth);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void OccultationFinder::set_tolerance(double tolerance) {
+    if (!(tolerance > 0.)) {
+        throw std::invalid_argument("OccultationFinder::set_tolerance() - The tolerance must be positive.");
+    }
+    tolerance_ = tolerance;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double OccultationFinder::get_tolerance() const {
+    return tolerance_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void OccultationFinder::set_min_step(double min_step) {
+    if (!(min_step > 0.)) {
+        throw std::invalid_argument("OccultationFinder::set_min_step() - The minimum step must be positive.");
+    }
+    min_step_ = min_step;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double OccultationFinder::get_min_step() const {
+    return min_step_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void OccultationFinder::set_radius(CentralBody body, double radius) {
+    if (!(radius > 0.)) {
+        throw std::invalid_argument("OccultationFinder::set_radius() - The radius must be positive.");
+    }
+
+    switch (body) {
+        case CentralBody::Sun: {
+            sun_radius_ = radius;
+            break;
+        }
+        case CentralBody::Earth: {
+            earth_radius_ = radius;
+            break;
+        }
+        case CentralBody::Moon: {
+            moon_radius_ = radius;
+            break;
+        }
+        default: {
+            throw std::invalid_argument("OccultationFinder::set_radius() - Only the Sun, Earth, and Moon are supported.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double OccultationFinder::get_radius(CentralBody body) const {
+    switch (body) {
+        case CentralBody::Sun: {
+            return sun_radius_;
+        }
+        case CentralBody::Earth: {
+            return earth_radius_;
+        }
+        case CentralBody::Moon: {
+            return moon_radius_;
+        }
+        default: {
+            throw std::invalid_argument("OccultationFinder::get_radius() - Only the Sun, Earth, and Moon are supported.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t OccultationFinder::get_num_evaluations() const {
+    return num_evaluations_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<OccultationWindow> OccultationFinder::search(OccultationType type, const ObserverFunction* observer,
+                                                         double max_observer_speed, double start_mjdj2k_tdb,
+                                                         double stop_mjdj2k_tdb, OccultationDepth depth) {
+    if (type != OccultationType::SunByEarth && type != OccultationType::SunByMoon && type != OccultationType::MoonByEarth) {
+        throw std::invalid_argument("OccultationFinder::find() - Unexpected input provided for OccultationType");
+    }
+
+    if (depth != OccultationDepth::Partial && depth != OccultationDepth::Total) {
+        throw std::invalid_argument("OccultationFinder::find() - Unexpected input provided for OccultationDepth");
+    }
+
+    if (!(start_mjdj2k_tdb < stop_mjdj2k_tdb)) {
+        throw std::invalid_argument("OccultationFinder::find() - The start of the search interval must be before its "
+                                    "end.");
+    }
+
+    for (const EphemerisTableView& view : tables_.get_views()) {
+        view.get_index(start_mjdj2k_tdb);
+        view.get_index(stop_mjdj2k_tdb);
+    }
+
+    num_evaluations_ = 0;
+
+    const double hidden_radius    = type == OccultationType::MoonByEarth ? moon_radius_ : sun_radius_;
+    const double occulting_radius = type == OccultationType::SunByMoon ? moon_radius_ : earth_radius_;
+
+    double hidden_dist    = 0.;
+    double occulting_dist = 0.;
+    double t              = start_mjdj2k_tdb;
+    double margin         = evaluate(type, observer, t, depth, hidden_dist, occulting_dist);
+
+    std::vector<OccultationWindow> windows;
+    bool inside         = margin < 0.;
+    double window_start = start_mjdj2k_tdb;
+
+    double granule_end     = t;
+    double hidden_speed    = 0.;
+    double occulting_speed = 0.;
+    while (t < stop_mjdj2k_tdb) {
+        // The speed bounds only change from one Moon granule to the next
+        if (t >= granule_end) {
+            double sun_speed  = 0.;
+            double moon_speed = 0.;
+            granule_end       = compute_speed_bounds(t, sun_speed, moon_speed);
+
+            const double observer_speed = observer ? max_observer_speed : moon_speed;
+            hidden_speed    = (type == OccultationType::MoonByEarth ? moon_speed : sun_speed) + observer_speed;
+            occulting_speed = (type == OccultationType::SunByMoon ? moon_speed : 0.) + observer_speed;
+        }
+
+        // Start from the step allowed by the angular rates at the current distances, then halve it until the bound on
+        // the change of the margin over the step is below the margin itself, so no boundary can be stepped over
+        const double end  = std::min(granule_end, stop_mjdj2k_tdb);
+        double step       = std::min(std::abs(margin) / (hidden_speed / hidden_dist + occulting_speed / occulting_dist),
+                                     (end - t) * SEC_PER_DAY);
+        while (step > min_step_
+               && get_angular_change_bound(hidden_speed * step, hidden_dist, hidden_radius)
+                          + get_angular_change_bound(occulting_speed * step, occulting_dist, occulting_radius)
+                      > std::abs(margin)) {
+            step *= 0.5;
+        }
+        step = std::max(step, min_step_);
+
+        double t_next      = std::min(t + step / SEC_PER_DAY, end);
+        double margin_next = evaluate(type, observer, t_next, depth, hidden_dist, occulting_dist);
+
+        if ((margin_next < 0.) != inside) {
+            const auto margin_at = [&](double mjdj2k) {
+                double dist_h = 0., dist_o = 0.;
+                return evaluate(type, observer, mjdj2k, depth, dist_h, dist_o);
+            };
+            const double boundary = detail::refine_bracketed_root(margin_at, t, t_next, margin, margin_next,
+                                                                  tolerance_ / SEC_PER_DAY);
+            if (inside) {
+                windows.push_back(OccultationWindow{window_start, boundary, type});
+            } else {
+                window_start = boundary;
+            }
+            inside = !inside;
+        }
+
+        t      = t_next;
+        margin = margin_next;
+    }
+
+    if (inside) {
+        windows.push_back(OccultationWindow{window_start, stop_mjdj2k_tdb, type});
+    }
+    return windows;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double OccultationFinder::evaluate(OccultationType type, const ObserverFunction* observer, double mjdj2k_tdb,
+                                   OccultationDepth depth, double& hidden_dist, double& occulting_dist) {
+    num_evaluations_++;
+
+    const std::array<double, 3> obs = observer ? (*observer)(mjdj2k_tdb)
+                                               : context_.get_position(CentralBody::Moon, mjdj2k_tdb);
+
+    std::array<double, 3> hidden{};
+    std::array<double, 3> occulting{};
+    double hidden_radius    = sun_radius_;
+    double occulting_radius = earth_radius_;
+    switch (type) {
+        case OccultationType::SunByEarth: {
+            hidden = context_.get_position(CentralBody::Sun, mjdj2k_tdb);
+            break;
+        }
+        case OccultationType::SunByMoon: {
+            hidden           = context_.get_position(CentralBody::Sun, mjdj2k_tdb);
+            occulting        = context_.get_position(CentralBody::Moon, mjdj2k_tdb);
+            occulting_radius = moon_radius_;
+            break;
+        }
+        case OccultationType::MoonByEarth:
+        default: {
+            hidden        = context_.get_position(CentralBody::Moon, mjdj2k_tdb);
+            hidden_radius = moon_radius_;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < 3; i++) {
+        hidden[i] -= obs[i];
+        occulting[i] -= obs[i];
+    }
+    hidden_dist    = get_norm(hidden);
+    occulting_dist = get_norm(occulting);
+
+    const std::array<double, 3> cross{hidden[1] * occulting[2] - hidden[2] * occulting[1],
+                                      hidden[2] * occulting[0] - hidden[0] * occulting[2],
+                                      hidden[0] * occulting[1] - hidden[1] * occulting[0]};
+    const double dot = hidden[0] * occulting[0] + hidden[1] * occulting[1] + hidden[2] * occulting[2];
+
+    const double separation = std::atan2(get_norm(cross), dot);
+    const double a          = std::asin(std::min(hidden_radius / hidden_dist, 1.));
+    const double b          = std::asin(std::min(occulting_radius / occulting_dist, 1.));
+
+    return depth == OccultationDepth::Total ? separation - (b - a) : separation - (a + b);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double OccultationFinder::compute_speed_bounds(double mjdj2k_tdb, double& sun_speed, double& moon_speed) const {
+    const EphemerisTableView& moon = tables_.moon;
+
+    unsigned int ind   = moon.get_index(mjdj2k_tdb);
+    double granule_end = moon.get_row(0, ind)[1];
+    if (granule_end <= mjdj2k_tdb && ind + 1 < moon.num_granules) {
+        granule_end = moon.get_row(0, ind + 1)[1];
+    }
+
+    // The Moon granules lie inside single granules of the other tables, so the midpoint selects the granule of each table
+    const double mid = 0.5 * (mjdj2k_tdb + std::min(granule_end, moon.stop_mjdj2k));
+
+    // Sun relative to the Earth = Sun relative to the SSB - EMB relative to the SSB - Earth relative to the EMB
+    sun_speed = get_speed_bound(tables_.sun_from_ssb, mid) + get_speed_bound(tables_.emb_from_ssb, mid)
+                + get_speed_bound(tables_.earth_from_emb, mid);
+    moon_speed = get_speed_bound(moon, mid);
+
+    return granule_end;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,233 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_OCCULTATION_FINDER_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_OCCULTATION_FINDER_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/occultation_finder.hpp
+ * \brief Defines a class for finding the eclipse and occultation windows of an observer over long intervals
+ */
+
+// standard library includes
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies which disk is hidden, and by which body, as seen from the observer
+enum class OccultationType : int {
+    SunByEarth = 0,   //!< The Earth hides the Sun, i.e. the observer is in the shadow of the Earth
+    SunByMoon = 1,    //!< The Moon hides the Sun, i.e. the observer is in the shadow of the Moon (solar eclipse)
+    MoonByEarth = 2,  //!< The Earth hides the Moon
+};
+
+//! Specifies how much of the hidden disk must be covered for the observer to be inside a window
+enum class OccultationDepth : int {
+    Partial = 0,  //!< Any part of the disk is covered (penumbra or umbra)
+    Total = 1,    //!< The whole disk is covered (umbra)
+};
+
+//! Interval during which a disk is hidden from the observer
+struct OccultationWindow {
+    //! Start of the window, as a Modified Julian Date from the J2000 Epoch in the TDB Time System
+    double start_mjdj2k_tdb = 0.;
+
+    //! End of the window, as a Modified Julian Date from the J2000 Epoch in the TDB Time System
+    double stop_mjdj2k_tdb = 0.;
+
+    //! Type of the occultation
+    OccultationType type = OccultationType::SunByEarth;
+};
+
+//! Returns the position of the observer relative to the Earth in the GCRF frame [km], at an epoch in TDB
+using ObserverFunction = std::function<std::array<double, 3>(double mjdj2k_tdb)>;
+
+/*!
+ * \brief Defines a class for finding the eclipse and occultation windows of an observer over long intervals
+ *
+ * \details The Sun, Earth, and Moon are spheres, and a window is an interval where the angular separation c of the hidden
+ * and occulting disks, as seen from the observer, is below a + b (OccultationDepth::Partial) or b - a
+ * (OccultationDepth::Total), where a and b are the apparent radii of the hidden and occulting bodies. Positions are
+ * geometric, without light time or aberration.
+ *
+ * Instead of sampling at a fixed step, the search steps over intervals that cannot contain a window boundary. The speeds of
+ * the bodies are bounded on each Moon granule from the derivatives of the Chebyshev coefficients, and the speed of the
+ * observer is bounded by the caller, which bounds the rate of c - (a + b). The next step is the current distance to the
+ * boundary over that rate, so the steps are long far from a window and shrink approaching one. Each sign change is then
+ * refined to the tolerance. A window shorter than the minimum step can be missed, but only if it lies between two steps.
+ *
+ * Lunar eclipses are found by placing the observer at the center of the Moon (see find_lunar_eclipses). Like
+ * EphemerisContext, every search updates the cache, so each thread needs its own instance, e.g.
+ *
+ *     OccultationFinder finder;
+ *     std::vector<OccultationWindow> eclipses = finder.find(OccultationType::SunByEarth, orbit, 7.8, start, stop);
+ */
+class OccultationFinder {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an instance that evaluates the compiled-in tables
+        OccultationFinder();
+
+        /*!
+         * \brief Create an instance that evaluates the specified tables
+         *
+         * \param tables Views of the tables. The coefficients must remain valid for the lifetime of this object.
+         */
+        explicit OccultationFinder(const EphemerisTableSet& tables);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Find every window in [start, stop] during which the observer sees the specified occultation
+         *
+         * \param type Type of the occultation
+         * \param observer Position of the observer relative to the Earth. It must stay outside of the occulting body.
+         * \param max_observer_speed Upper bound on the speed of the observer relative to the Earth [km/s], e.g. about 8
+         *     for a low Earth orbit, or 0.5 for a ground site
+         * \param start_mjdj2k_tdb Start of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param stop_mjdj2k_tdb End of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param depth Partial or total occultation
+         *
+         * \return Windows in increasing order of time. Windows in progress at start or stop are clipped to the interval.
+         *
+         * \throws std::invalid_argument If the interval is empty, observer is empty, max_observer_speed is negative, or an
+         *     unexpected value is provided for type or depth
+         * \throws std::out_of_range If the interval is outside of the range covered by the tables
+         */
+        std::vector<OccultationWindow> find(OccultationType type, const ObserverFunction& observer, double max_observer_speed,
+                                            double start_mjdj2k_tdb, double stop_mjdj2k_tdb,
+                                            OccultationDepth depth = OccultationDepth::Partial);
+
+        /*!
+         * \brief Find every lunar eclipse in [start, stop], i.e. every window during which the center of the Moon is in
+         * the shadow of the Earth
+         *
+         * \param start_mjdj2k_tdb Start of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param stop_mjdj2k_tdb End of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param depth OccultationDepth::Partial for the penumbra, and OccultationDepth::Total for the umbra
+         *
+         * \return Windows of type OccultationType::SunByEarth, in increasing order of time
+         *
+         * \throws std::invalid_argument If the interval is empty, or an unexpected value is provided for depth
+         * \throws std::out_of_range If the interval is outside of the range covered by the tables
+         */
+        std::vector<OccultationWindow> find_lunar_eclipses(double start_mjdj2k_tdb, double stop_mjdj2k_tdb,
+                                                           OccultationDepth depth = OccultationDepth::Partial);
+
+        /*!
+         * \brief Set the tolerance to which the start and end of each window are refined
+         *
+         * \param tolerance Tolerance [s]
+         *
+         * \throws std::invalid_argument If tolerance is not positive
+         */
+        void set_tolerance(double tolerance);
+
+        //! Return the tolerance to which the start and end of each window are refined [s]
+        double get_tolerance() const;
+
+        /*!
+         * \brief Set the minimum step of the search, which bounds the number of steps taken near a window boundary
+         *
+         * \param min_step Minimum step [s]
+         *
+         * \throws std::invalid_argument If min_step is not positive
+         */
+        void set_min_step(double min_step);
+
+        //! Return the minimum step of the search [s]
+        double get_min_step() const;
+
+        /*!
+         * \brief Set the radius used for the Sun, Earth, or Moon
+         *
+         * \param body CentralBody::Sun, CentralBody::Earth, or CentralBody::Moon
+         * \param radius Radius [km]
+         *
+         * \throws std::invalid_argument If body is the SSB, or radius is not positive
+         */
+        void set_radius(CentralBody body, double radius);
+
+        /*!
+         * \brief Return the radius used for the Sun, Earth, or Moon
+         *
+         * \param body CentralBody::Sun, CentralBody::Earth, or CentralBody::Moon
+         *
+         * \return Radius [km]
+         *
+         * \throws std::invalid_argument If body is the SSB
+         */
+        double get_radius(CentralBody body) const;
+
+        //! Return the number of geometry evaluations made by the last search, including the refinement of the boundaries
+        uint64_t get_num_evaluations() const;
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Search [start, stop], with the observer at the center of the Moon when observer is null
+        std::vector<OccultationWindow> search(OccultationType type, const ObserverFunction* observer,
+                                              double max_observer_speed, double start_mjdj2k_tdb, double stop_mjdj2k_tdb,
+                                              OccultationDepth depth);
+
+        /*!
+         * \brief Return the separation of the disks minus the sum (or difference) of their apparent radii [rad], which is
+         * negative inside a window, and output the distances from the observer to the hidden and occulting bodies [km]
+         */
+        double evaluate(OccultationType type, const ObserverFunction* observer, double mjdj2k_tdb, OccultationDepth depth,
+                        double& hidden_dist, double& occulting_dist);
+
+        /*!
+         * \brief Compute upper bounds on the speeds of the Sun and Moon relative to the Earth over the Moon granule that
+         * contains mjdj2k_tdb
+         *
+         * \return End of the granule
+         */
+        double compute_speed_bounds(double mjdj2k_tdb, double& sun_speed, double& moon_speed) const;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Views of the tables
+        EphemerisTableSet tables_;
+
+        //! Cache of the last granule of each table
+        EphemerisContext context_;
+
+        //! Radius of the Sun [km]
+        double sun_radius_;
+
+        //! Radius of the Earth [km]
+        double earth_radius_;
+
+        //! Radius of the Moon [km]
+        double moon_radius_;
+
+        //! Tolerance to which the window boundaries are refined [s]
+        double tolerance_ = 1e-3;
+
+        //! Minimum step of the search [s]
+        double min_step_ = 1.;
+
+        //! Number of geometry evaluations made by the last search
+        uint64_t num_evaluations_ = 0;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,53 @@
+#include "power_basis_ephemeris.hpp"
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+PowerBasisEphemeris::PowerBasisEphemeris(double position_tol, double velocity_tol) :
+    sun_from_ssb_(SunFromSSBGCRFTable::get_table_view(), position_tol, velocity_tol),
+    emb_from_ssb_(EMBFromSSBGCRFTable::get_table_view(), position_tol, velocity_tol),
+    earth_from_emb_(EarthFromEMBGCRFTable::get_table_view(), position_tol, velocity_tol),
+    moon_(MoonGCRFTable::get_table_view(), position_tol, velocity_tol) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> PowerBasisEphemeris::get_position(CentralBody target, double mjdj2k_tdb,
+                                                        CentralBody central_body) const {
+    return get_relative(target, mjdj2k_tdb, central_body, false);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> PowerBasisEphemeris::get_velocity(CentralBody target, double mjdj2k_tdb,
+                                                        CentralBody central_body) const {
+    return get_relative(target, mjdj2k_tdb, central_body, true);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> PowerBasisEphemeris::get_relative(CentralBody target, double mjdj2k_tdb, CentralBody central_body,
+                                                        bool velocity) const {
+    // Evaluate either the position or velocity of a table
+    auto eval = [&](const auto& table) {
+        return velocity ? table.get_velocity(mjdj2k_tdb) : table.get_position(mjdj2k_tdb);
+    };
+
+    return compute_table_relative_vector(
+        target, central_body, sun_from_ssb_, emb_from_ssb_, earth_from_emb_, moon_, eval,
+        velocity ? "PowerBasisEphemeris::get_velocity() - Unexpected input provided for CentralBody"
+                 : "PowerBasisEphemeris::get_position() - Unexpected input provided for CentralBody");
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,132 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_POWER_BASIS_EPHEMERIS_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_POWER_BASIS_EPHEMERIS_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/power_basis_ephemeris.hpp
+ * \brief Defines a class for computing the position/velocity of the Sun, Earth, and Moon with the evaluation mode of each
+ * table chosen from its measured error
+ */
+
+// standard library includes
+#include <array>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/power_basis_ephemeris_table.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Defines a class for computing the position/velocity of the Sun, Earth, and Moon with the evaluation mode of each
+ * table chosen from its measured error
+ *
+ * \details Each compiled-in table is converted to the power basis at construction, and Estrin's scheme is used for every
+ * table whose measured difference from Clenshaw's recurrence is within the requested tolerances. The remaining tables
+ * keep using Clenshaw's recurrence.
+ */
+class PowerBasisEphemeris {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Convert the compiled-in tables and choose the evaluation mode of each
+         *
+         * \param position_tol Maximum position difference from Clenshaw for Estrin to be selected [km]
+         * \param velocity_tol Maximum velocity difference from Clenshaw for Estrin to be selected [km/s]
+         */
+        explicit PowerBasisEphemeris(double position_tol = 1e-6, double velocity_tol = 1e-11);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Position of the target relative to the specified CentralBody in the GCRF frame [km]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         */
+        std::array<double, 3> get_position(CentralBody target, double mjdj2k_tdb,
+                                           CentralBody central_body = CentralBody::Earth) const;
+
+        /*!
+         * \brief Return the velocity of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose velocity is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Velocity of the target relative to the specified CentralBody in the GCRF frame [km/s]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         */
+        std::array<double, 3> get_velocity(CentralBody target, double mjdj2k_tdb,
+                                           CentralBody central_body = CentralBody::Earth) const;
+
+        //! Return the table of the Sun relative to the SSB, to inspect its mode and measured accuracy
+        const PowerBasisEphemerisTable<13>& get_sun_from_ssb_table() const {
+            return sun_from_ssb_;
+        }
+
+        //! Return the table of the EMB relative to the SSB, to inspect its mode and measured accuracy
+        const PowerBasisEphemerisTable<15>& get_emb_from_ssb_table() const {
+            return emb_from_ssb_;
+        }
+
+        //! Return the table of the Earth relative to the EMB, to inspect its mode and measured accuracy
+        const PowerBasisEphemerisTable<15>& get_earth_from_emb_table() const {
+            return earth_from_emb_;
+        }
+
+        //! Return the table of the Moon relative to the Earth, to inspect its mode and measured accuracy
+        const PowerBasisEphemerisTable<15>& get_moon_table() const {
+            return moon_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute the position or velocity of the target relative to the central body
+         *
+         * \param target Body whose state is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         * \param velocity If true, compute velocity, otherwise compute position
+         *
+         * \return Position [km] or velocity [km/s] of the target relative to the central body
+         */
+        std::array<double, 3> get_relative(CentralBody target, double mjdj2k_tdb, CentralBody central_body,
+                                           bool velocity) const;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Sun relative to the SSB
+        PowerBasisEphemerisTable<13> sun_from_ssb_;
+
+        //! EMB relative to the SSB
+        PowerBasisEphemerisTable<15> emb_from_ssb_;
+
+        //! Earth relative to the EMB
+        PowerBasisEphemerisTable<15> earth_from_emb_;
+
+        //! Moon relative to the Earth
+        PowerBasisEphemerisTable<15> moon_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
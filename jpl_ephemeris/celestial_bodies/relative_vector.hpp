@@ -0,0 +1,153 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_RELATIVE_VECTOR_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_RELATIVE_VECTOR_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/relative_vector.hpp
+ * \brief Function for composing the position/velocity of one body relative to another from the individual tables
+ */
+
+// standard library includes
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Compose the position/velocity of the target relative to the central body from the individual tables
+ *
+ * \details Each body is expressed relative to the Earth, so the Moon table is used directly whenever possible, and the
+ * Earth relative to the SSB is only evaluated (once) when the Sun or SSB are involved.
+ *
+ * \param target Body whose position/velocity is computed
+ * \param central_body Central body that the target is measured relative to
+ * \param sun_from_ssb Callable returning the Sun relative to the SSB
+ * \param earth_from_ssb Callable returning the Earth relative to the SSB
+ * \param moon_from_earth Callable returning the Moon relative to the Earth
+ * \param error_msg Message of the exception thrown for an unexpected CentralBody
+ *
+ * \return Position/velocity of the target relative to the central body
+ *
+ * \tparam SunFromSSB Callable type returning a std::array<double, M>, e.g. M = 3 for position and M = 6 for state
+ * \tparam EarthFromSSB Callable type returning the same std::array<double, M>
+ * \tparam MoonFromEarth Callable type returning the same std::array<double, M>
+ *
+ * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+ */
+template<class SunFromSSB, class EarthFromSSB, class MoonFromEarth>
+std::invoke_result_t<MoonFromEarth> compute_relative_vector(CentralBody target, CentralBody central_body,
+                                                            const SunFromSSB& sun_from_ssb,
+                                                            const EarthFromSSB& earth_from_ssb,
+                                                            const MoonFromEarth& moon_from_earth, const char* error_msg) {
+    using Vector = std::invoke_result_t<MoonFromEarth>;
+    constexpr size_t M = std::tuple_size_v<Vector>;
+
+    // A body relative to itself is always zero
+    if (target == central_body) {
+        return Vector{};
+    }
+
+    // The Earth relative to the SSB is only required when the Sun or SSB are involved
+    bool needs_ssb = target == CentralBody::SSB || target == CentralBody::Sun || central_body == CentralBody::SSB
+                     || central_body == CentralBody::Sun;
+
+    Vector earth_ssb{};
+    if (needs_ssb) {
+        earth_ssb = earth_from_ssb();
+    }
+
+    auto from_earth = [&](CentralBody body) {
+        Vector vec{};
+        switch (body) {
+            case CentralBody::SSB: {
+                for (size_t k = 0; k < M; k++) {
+                    vec[k] = -earth_ssb[k];
+                }
+                break;
+            }
+            case CentralBody::Sun: {
+                Vector sun_ssb = sun_from_ssb();
+                for (size_t k = 0; k < M; k++) {
+                    vec[k] = sun_ssb[k] - earth_ssb[k];
+                }
+                break;
+            }
+            case CentralBody::Earth: {
+                // Defaults to zero
+                break;
+            }
+            case CentralBody::Moon: {
+                vec = moon_from_earth();
+                break;
+            }
+            default: {
+                throw std::invalid_argument(error_msg);
+            }
+        }
+        return vec;
+    };
+
+    Vector target_from_earth  = from_earth(target);
+    Vector central_from_earth = from_earth(central_body);
+
+    Vector rel{};
+    for (size_t k = 0; k < M; k++) {
+        rel[k] = target_from_earth[k] - central_from_earth[k];
+    }
+    return rel;
+}
+
+/*!
+ * \brief Compose the position/velocity of the target relative to the central body by evaluating the individual tables
+ *
+ * \details The Earth relative to the SSB is the sum of the EMB relative to the SSB and the Earth relative to the EMB, so
+ * every ephemeris type holding the four tables shares this composition and only provides how a table is evaluated.
+ *
+ * \param target Body whose position/velocity is computed
+ * \param central_body Central body that the target is measured relative to
+ * \param sun_from_ssb Table of the Sun relative to the SSB
+ * \param emb_from_ssb Table of the EMB relative to the SSB
+ * \param earth_from_emb Table of the Earth relative to the EMB
+ * \param moon Table of the Moon relative to the Earth
+ * \param eval Callable evaluating a table, e.g. its position at the requested epoch
+ * \param error_msg Message of the exception thrown for an unexpected CentralBody
+ *
+ * \return Position/velocity of the target relative to the central body
+ *
+ * \tparam SunTable Type of the Sun table
+ * \tparam EMBTable Type of the EMB table
+ * \tparam EarthTable Type of the Earth table
+ * \tparam MoonTable Type of the Moon table
+ * \tparam Evaluate Callable type accepting each table and returning the same std::array<double, M>
+ *
+ * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+ */
+template<class SunTable, class EMBTable, class EarthTable, class MoonTable, class Evaluate>
+std::invoke_result_t<const Evaluate&, MoonTable&> compute_table_relative_vector(
+    CentralBody target, CentralBody central_body, SunTable& sun_from_ssb, EMBTable& emb_from_ssb,
+    EarthTable& earth_from_emb, MoonTable& moon, const Evaluate& eval, const char* error_msg) {
+    using Vector = std::invoke_result_t<const Evaluate&, MoonTable&>;
+    constexpr size_t M = std::tuple_size_v<Vector>;
+
+    auto earth_from_ssb = [&]() {
+        Vector emb_ssb   = eval(emb_from_ssb);
+        Vector earth_emb = eval(earth_from_emb);
+
+        Vector earth{};
+        for (size_t k = 0; k < M; k++) {
+            earth[k] = earth_emb[k] + emb_ssb[k];
+        }
+        return earth;
+    };
+
+    return compute_relative_vector(
+        target, central_body, [&]() { return eval(sun_from_ssb); }, earth_from_ssb, [&]() { return eval(moon); },
+        error_msg);
+}
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,199 @@
+#include "shadow_function.hpp"
+
+// standard library includes
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+
+double compute_illumination_fraction(const std::array<double, 3>& sun_from_sat, const std::array<double, 3>& body_from_sat,
+                                     double body_radius, double sun_radius) {
+    const double sun_dist  = std::sqrt(sun_from_sat[0] * sun_from_sat[0] + sun_from_sat[1] * sun_from_sat[1]
+                                       + sun_from_sat[2] * sun_from_sat[2]);
+    const double body_dist = std::sqrt(body_from_sat[0] * body_from_sat[0] + body_from_sat[1] * body_from_sat[1]
+                                       + body_from_sat[2] * body_from_sat[2]);
+
+    if (body_dist <= body_radius) {
+        return 0.;
+    }
+
+    // Sines and cosines of the apparent radii of the Sun (a) and the body (b), and the cosine of their separation (c)
+    const double sin_a = sun_radius / sun_dist;
+    const double sin_b = body_radius / body_dist;
+    const double cos_a = std::sqrt(1. - sin_a * sin_a);
+    const double cos_b = std::sqrt(1. - sin_b * sin_b);
+    const double cos_c = (sun_from_sat[0] * body_from_sat[0] + sun_from_sat[1] * body_from_sat[1]
+                          + sun_from_sat[2] * body_from_sat[2])
+                         / (sun_dist * body_dist);
+
+    // Fully lit if c >= a + b, i.e. cos(c) <= cos(a + b), which covers almost every call
+    if (cos_c <= cos_a * cos_b - sin_a * sin_b) {
+        return 1.;
+    }
+
+    const double a = std::asin(sin_a);
+    const double b = std::asin(sin_b);
+    const double c = std::acos(std::clamp(cos_c, -1., 1.));
+
+    // Umbra: the body covers the whole solar disk
+    if (c <= b - a) {
+        return 0.;
+    }
+
+    // Antumbra: the body lies entirely within the solar disk
+    if (c <= a - b) {
+        return 1. - (b * b) / (a * a);
+    }
+
+    // Penumbra: area of the lens where the two disks overlap
+    const double x    = (c * c + a * a - b * b) / (2. * c);
+    const double y    = std::sqrt(std::max(a * a - x * x, 0.));
+    const double area = a * a * std::acos(std::clamp(x / a, -1., 1.))
+                        + b * b * std::acos(std::clamp((c - x) / b, -1., 1.)) - c * y;
+
+    return 1. - area / (std::numbers::pi * a * a);
+}
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+ShadowFunction::ShadowFunction() :
+    sun_radius_(DEConstants::asun), earth_radius_(DEConstants::re), moon_radius_(DEConstants::am), context_() {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ShadowFunction::ShadowFunction(const EphemerisTableSet& tables) :
+    sun_radius_(DEConstants::asun), earth_radius_(DEConstants::re), moon_radius_(DEConstants::am), context_(tables) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void ShadowFunction::get_fractions(double mjdj2k_tdb, const double* positions, size_t num_sats,
+                                   IlluminationFraction* fractions) {
+    compute_epoch(mjdj2k_tdb, positions, num_sats, fractions);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ShadowFunction::get_fractions(const double* mjdj2k_tdb, const double* positions, size_t num_sats,
+                                   IlluminationFraction* fractions) {
+    // Process each run of satellites sharing an epoch together, so the bodies are evaluated once per run
+    size_t start = 0;
+    while (start < num_sats) {
+        size_t stop = start + 1;
+        while (stop < num_sats && mjdj2k_tdb[stop] == mjdj2k_tdb[start]) {
+            stop++;
+        }
+
+        compute_epoch(mjdj2k_tdb[start], positions + 3 * start, stop - start, fractions + start);
+        start = stop;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<IlluminationFraction> ShadowFunction::get_fractions(double mjdj2k_tdb,
+                                                                const std::vector<std::array<double, 3>>& positions) {
+    std::vector<IlluminationFraction> fractions(positions.size());
+    if (!positions.empty()) {
+        get_fractions(mjdj2k_tdb, positions.data()->data(), positions.size(), fractions.data());
+    }
+    return fractions;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<IlluminationFraction> ShadowFunction::get_fractions(const std::vector<double>& mjdj2k_tdb,
+                                                                const std::vector<std::array<double, 3>>& positions) {
+    if (mjdj2k_tdb.size() != positions.size()) {
+        throw std::invalid_argument("ShadowFunction::get_fractions() - The number of epochs does not match the number of "
+                                    "positions.");
+    }
+
+    std::vector<IlluminationFraction> fractions(positions.size());
+    if (!positions.empty()) {
+        get_fractions(mjdj2k_tdb.data(), positions.data()->data(), positions.size(), fractions.data());
+    }
+    return fractions;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ShadowFunction::set_radius(CentralBody body, double radius) {
+    if (!(radius >= 0.)) {
+        throw std::invalid_argument("ShadowFunction::set_radius() - The radius must be non-negative.");
+    }
+
+    switch (body) {
+        case CentralBody::Sun: {
+            sun_radius_ = radius;
+            break;
+        }
+        case CentralBody::Earth: {
+            earth_radius_ = radius;
+            break;
+        }
+        case CentralBody::Moon: {
+            moon_radius_ = radius;
+            break;
+        }
+        default: {
+            throw std::invalid_argument("ShadowFunction::set_radius() - Only the Sun, Earth, and Moon are supported.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double ShadowFunction::get_radius(CentralBody body) const {
+    switch (body) {
+        case CentralBody::Sun: {
+            return sun_radius_;
+        }
+        case CentralBody::Earth: {
+            return earth_radius_;
+        }
+        case CentralBody::Moon: {
+            return moon_radius_;
+        }
+        default: {
+            throw std::invalid_argument("ShadowFunction::get_radius() - Only the Sun, Earth, and Moon are supported.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ShadowFunction::compute_epoch(double mjdj2k_tdb, const double* positions, size_t num_sats,
+                                   IlluminationFraction* fractions) {
+    const std::array<double, 3> sun  = context_.get_position(CentralBody::Sun, mjdj2k_tdb);
+    const std::array<double, 3> moon = context_.get_position(CentralBody::Moon, mjdj2k_tdb);
+
+    for (size_t i = 0; i < num_sats; i++) {
+        const double* r = positions + 3 * i;
+
+        const std::array<double, 3> sun_from_sat{sun[0] - r[0], sun[1] - r[1], sun[2] - r[2]};
+        const std::array<double, 3> earth_from_sat{-r[0], -r[1], -r[2]};
+        const std::array<double, 3> moon_from_sat{moon[0] - r[0], moon[1] - r[1], moon[2] - r[2]};
+
+        fractions[i].earth = earth_radius_ > 0.
+                                 ? compute_illumination_fraction(sun_from_sat, earth_from_sat, earth_radius_, sun_radius_)
+                                 : 1.;
+        fractions[i].moon = moon_radius_ > 0.
+                                ? compute_illumination_fraction(sun_from_sat, moon_from_sat, moon_radius_, sun_radius_)
+                                : 1.;
+    }
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,190 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_SHADOW_FUNCTION_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_SHADOW_FUNCTION_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/shadow_function.hpp
+ * \brief Defines a class for computing the Earth and Moon shadow fractions of batches of Earth satellites
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+
+namespace jpl_ephemeris {
+
+//! Fraction of the solar disk visible from a satellite, for each occulting body
+struct IlluminationFraction {
+    //! Fraction of the solar disk not occulted by the Earth, from 0 (umbra) to 1 (fully lit)
+    double earth = 1.;
+
+    //! Fraction of the solar disk not occulted by the Moon, from 0 (umbra) to 1 (fully lit)
+    double moon = 1.;
+
+    //! Return the fraction of the solar disk not occulted by either body, neglecting the overlap of the two shadows
+    double combined() const {
+        return earth * moon;
+    }
+};
+
+/*!
+ * \brief Return the fraction of the solar disk visible past a spherical occulting body, with a conical shadow model
+ *
+ * \details The Sun and the occulting body are treated as disks of apparent radii a and b, separated by the angle c, and
+ * the visible fraction is one minus their overlap area over pi a^2 (Montenbruck & Gill, Satellite Orbits, 3.4.2). The
+ * fully lit case, c >= a + b, is detected by comparing cosines, so it needs no inverse trigonometric functions.
+ *
+ * \param sun_from_sat Position of the Sun relative to the satellite [km]
+ * \param body_from_sat Position of the occulting body relative to the satellite [km]
+ * \param body_radius Radius of the occulting body [km]
+ * \param sun_radius Radius of the Sun [km]
+ *
+ * \return Fraction of the solar disk visible from the satellite, from 0 (umbra) to 1 (fully lit). A satellite inside the
+ *     occulting body returns 0.
+ */
+double compute_illumination_fraction(const std::array<double, 3>& sun_from_sat, const std::array<double, 3>& body_from_sat,
+                                     double body_radius, double sun_radius);
+
+/*!
+ * \brief Defines a class for computing the Earth and Moon shadow fractions of batches of Earth satellites
+ *
+ * \details The Sun and Moon positions are evaluated once per distinct epoch, through an EphemerisContext, and shared by
+ * every satellite at that epoch, e.g. for the solar radiation pressure of a constellation. The radii default to the values
+ * of the DE header (see DEConstants). Like EphemerisContext, every query updates the cache, so each thread needs its own
+ * instance, e.g.
+ *
+ *     ShadowFunction shadow;
+ *     std::vector<IlluminationFraction> illum = shadow.get_fractions(mjdj2k_tdb, sat_positions);
+ */
+class ShadowFunction {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an instance that evaluates the compiled-in tables
+        ShadowFunction();
+
+        /*!
+         * \brief Create an instance that evaluates the specified tables
+         *
+         * \param tables Views of the tables. The coefficients must remain valid for the lifetime of this object.
+         */
+        explicit ShadowFunction(const EphemerisTableSet& tables);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute the illumination fractions of satellites that share one epoch
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame, stacked as
+         *     [x0, y0, z0, x1, ...] [km]
+         * \param num_sats Number of satellites
+         * \param fractions Output illumination fraction of each satellite
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        void get_fractions(double mjdj2k_tdb, const double* positions, size_t num_sats, IlluminationFraction* fractions);
+
+        /*!
+         * \brief Compute the illumination fractions of satellites that each have their own epoch
+         *
+         * \details The Sun and Moon are only re-evaluated when the epoch changes, so satellites that share an epoch should
+         * be stored next to each other.
+         *
+         * \param mjdj2k_tdb Epoch of each satellite, as a Modified Julian Date from the J2000 Epoch in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame, stacked as
+         *     [x0, y0, z0, x1, ...] [km]
+         * \param num_sats Number of satellites
+         * \param fractions Output illumination fraction of each satellite
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the tables
+         */
+        void get_fractions(const double* mjdj2k_tdb, const double* positions, size_t num_sats,
+                           IlluminationFraction* fractions);
+
+        /*!
+         * \brief Return the illumination fractions of satellites that share one epoch
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame [km]
+         *
+         * \return Illumination fraction of each satellite
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        std::vector<IlluminationFraction> get_fractions(double mjdj2k_tdb,
+                                                        const std::vector<std::array<double, 3>>& positions);
+
+        /*!
+         * \brief Return the illumination fractions of satellites that each have their own epoch
+         *
+         * \param mjdj2k_tdb Epoch of each satellite, as a Modified Julian Date from the J2000 Epoch in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame [km]
+         *
+         * \return Illumination fraction of each satellite
+         *
+         * \throws std::invalid_argument If mjdj2k_tdb and positions differ in size
+         * \throws std::out_of_range If an epoch is outside of the range covered by the tables
+         */
+        std::vector<IlluminationFraction> get_fractions(const std::vector<double>& mjdj2k_tdb,
+                                                        const std::vector<std::array<double, 3>>& positions);
+
+        /*!
+         * \brief Set the radius used for the Sun or an occulting body
+         *
+         * \param body CentralBody::Sun, CentralBody::Earth, or CentralBody::Moon
+         * \param radius Radius [km]. An occulting body with a radius of zero is skipped.
+         *
+         * \throws std::invalid_argument If body is the SSB, or radius is negative
+         */
+        void set_radius(CentralBody body, double radius);
+
+        /*!
+         * \brief Return the radius used for the Sun or an occulting body
+         *
+         * \param body CentralBody::Sun, CentralBody::Earth, or CentralBody::Moon
+         *
+         * \return Radius [km]
+         *
+         * \throws std::invalid_argument If body is the SSB
+         */
+        double get_radius(CentralBody body) const;
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Compute the illumination fractions of num_sats satellites that share the epoch mjdj2k_tdb
+        void compute_epoch(double mjdj2k_tdb, const double* positions, size_t num_sats, IlluminationFraction* fractions);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Radius of the Sun [km]
+        double sun_radius_;
+
+        //! Radius of the Earth [km]
+        double earth_radius_;
+
+        //! Radius of the Moon [km]
+        double moon_radius_;
+
+        //! Cache of the last granule of each table
+        EphemerisContext context_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
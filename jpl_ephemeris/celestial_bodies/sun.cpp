@@ -7,6 +7,7 @@
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_ssb_gcrf_table.hpp"
 #include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
 
 namespace jpl_ephemeris {
 
@@ -15,6 +16,8 @@ namespace jpl_ephemeris {
 //---------------------------------------
 
 std::array<double, 3> Sun::get_position(double mjdj2k_tdb, CentralBody central_body) {
+    JPL_EPHEMERIS_RECORD(record_body_call(CentralBody::Sun, central_body));
+
     // Initialize return array for position
     std::array<double, 3> pos{0., 0., 0.}; 
 
@@ -60,6 +63,8 @@ std::array<double, 3> Sun::get_position(double mjdj2k_tdb, CentralBody central_b
 //--------------------------------------------------------------------------------------------------------------------------
 
 std::array<double, 3> Sun::get_velocity(double mjdj2k_tdb, CentralBody central_body) {
+    JPL_EPHEMERIS_RECORD(record_body_call(CentralBody::Sun, central_body));
+
     // Initialize return array for velocity
     std::array<double, 3> vel{0., 0., 0.}; 
 
@@ -0,0 +1,167 @@
+#include "third_body_acceleration.hpp"
+
+// standard library includes
+#include <cmath>
+#include <stdexcept>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+
+void add_third_body_acceleration(double gm, const std::array<double, 3>& body_position, const double* positions,
+                                 size_t num_sats, double* accelerations) {
+    const double sx = body_position[0];
+    const double sy = body_position[1];
+    const double sz = body_position[2];
+
+    const double s_sq   = sx * sx + sy * sy + sz * sz;
+    const double s_cube = s_sq * std::sqrt(s_sq);
+
+    for (size_t i = 0; i < num_sats; i++) {
+        const double rx = positions[3 * i];
+        const double ry = positions[3 * i + 1];
+        const double rz = positions[3 * i + 2];
+
+        const double dx     = rx - sx;
+        const double dy     = ry - sy;
+        const double dz     = rz - sz;
+        const double d_sq   = dx * dx + dy * dy + dz * dz;
+        const double d_cube = d_sq * std::sqrt(d_sq);
+
+        // Since 1 + q = |r - s|^2 / |s|^2, (1 + q)^(3/2) = |r - s|^3 / |s|^3, which saves a second square root
+        const double q     = (rx * (rx - 2. * sx) + ry * (ry - 2. * sy) + rz * (rz - 2. * sz)) / s_sq;
+        const double f     = q * (3. + q * (3. + q)) / (1. + d_cube / s_cube);
+        const double scale = -gm / d_cube;
+
+        accelerations[3 * i] += scale * (rx + f * sx);
+        accelerations[3 * i + 1] += scale * (ry + f * sy);
+        accelerations[3 * i + 2] += scale * (rz + f * sz);
+    }
+}
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+ThirdBodyAcceleration::ThirdBodyAcceleration() :
+    gm_sun_(DEConstants::gm_sun), gm_moon_(DEConstants::gm_moon), context_() {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ThirdBodyAcceleration::ThirdBodyAcceleration(const EphemerisTableSet& tables) :
+    gm_sun_(DEConstants::gm_sun), gm_moon_(DEConstants::gm_moon), context_(tables) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void ThirdBodyAcceleration::get_accelerations(double mjdj2k_tdb, const double* positions, size_t num_sats,
+                                              double* accelerations) {
+    compute_epoch(mjdj2k_tdb, positions, num_sats, accelerations);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ThirdBodyAcceleration::get_accelerations(const double* mjdj2k_tdb, const double* positions, size_t num_sats,
+                                              double* accelerations) {
+    // Process each run of satellites sharing an epoch together, so the bodies are evaluated once per run
+    size_t start = 0;
+    while (start < num_sats) {
+        size_t stop = start + 1;
+        while (stop < num_sats && mjdj2k_tdb[stop] == mjdj2k_tdb[start]) {
+            stop++;
+        }
+
+        compute_epoch(mjdj2k_tdb[start], positions + 3 * start, stop - start, accelerations + 3 * start);
+        start = stop;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 3>> ThirdBodyAcceleration::get_accelerations(
+    double mjdj2k_tdb, const std::vector<std::array<double, 3>>& positions) {
+
+    std::vector<std::array<double, 3>> accelerations(positions.size());
+    if (!positions.empty()) {
+        get_accelerations(mjdj2k_tdb, positions.data()->data(), positions.size(), accelerations.data()->data());
+    }
+    return accelerations;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 3>> ThirdBodyAcceleration::get_accelerations(
+    const std::vector<double>& mjdj2k_tdb, const std::vector<std::array<double, 3>>& positions) {
+
+    if (mjdj2k_tdb.size() != positions.size()) {
+        throw std::invalid_argument("ThirdBodyAcceleration::get_accelerations() - The number of epochs does not match the "
+                                    "number of positions.");
+    }
+
+    std::vector<std::array<double, 3>> accelerations(positions.size());
+    if (!positions.empty()) {
+        get_accelerations(mjdj2k_tdb.data(), positions.data()->data(), positions.size(), accelerations.data()->data());
+    }
+    return accelerations;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ThirdBodyAcceleration::set_gm(CentralBody body, double gm) {
+    switch (body) {
+        case CentralBody::Sun: {
+            gm_sun_ = gm;
+            break;
+        }
+        case CentralBody::Moon: {
+            gm_moon_ = gm;
+            break;
+        }
+        default: {
+            throw std::invalid_argument("ThirdBodyAcceleration::set_gm() - Only the Sun and Moon are supported.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double ThirdBodyAcceleration::get_gm(CentralBody body) const {
+    switch (body) {
+        case CentralBody::Sun: {
+            return gm_sun_;
+        }
+        case CentralBody::Moon: {
+            return gm_moon_;
+        }
+        default: {
+            throw std::invalid_argument("ThirdBodyAcceleration::get_gm() - Only the Sun and Moon are supported.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ThirdBodyAcceleration::compute_epoch(double mjdj2k_tdb, const double* positions, size_t num_sats,
+                                          double* accelerations) {
+    for (size_t k = 0; k < 3 * num_sats; k++) {
+        accelerations[k] = 0.;
+    }
+
+    if (gm_sun_ != 0.) {
+        add_third_body_acceleration(gm_sun_, context_.get_position(CentralBody::Sun, mjdj2k_tdb), positions, num_sats,
+                                    accelerations);
+    }
+
+    if (gm_moon_ != 0.) {
+        add_third_body_acceleration(gm_moon_, context_.get_position(CentralBody::Moon, mjdj2k_tdb), positions, num_sats,
+                                    accelerations);
+    }
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,175 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_THIRD_BODY_ACCELERATION_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_THIRD_BODY_ACCELERATION_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/third_body_acceleration.hpp
+ * \brief Defines a class for computing the Sun and Moon point-mass perturbations on batches of Earth satellites
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Add the point-mass perturbation of a third body to the acceleration of each satellite
+ *
+ * \details The perturbation GM * ((s - r) / |s - r|^3 - s / |s|^3) is the difference of two nearly equal terms for a
+ * distant body, so it is evaluated with Battin's formulation, -GM / |r - s|^3 * (r + f(q) s), where
+ * q = r.(r - 2s) / s.s and f(q) = q (3 + 3q + q^2) / (1 + (1 + q)^(3/2)), which does not cancel. The loop over satellites
+ * has no branches, so it is vectorized by the compiler.
+ *
+ * \param gm Gravitational parameter of the third body [km^3/s^2]
+ * \param body_position Position of the third body relative to the central body [km]
+ * \param positions Positions of the satellites relative to the central body, stacked as [x0, y0, z0, x1, ...] [km]
+ * \param num_sats Number of satellites
+ * \param accelerations Accelerations of the satellites that the perturbation is added to, stacked like positions
+ *     [km/s^2]
+ */
+void add_third_body_acceleration(double gm, const std::array<double, 3>& body_position, const double* positions,
+                                 size_t num_sats, double* accelerations);
+
+/*!
+ * \brief Defines a class for computing the Sun and Moon point-mass perturbations on batches of Earth satellites
+ *
+ * \details The Sun and Moon positions are evaluated once per distinct epoch, through an EphemerisContext, and the
+ * perturbations are then computed for every satellite at that epoch with add_third_body_acceleration(). The gravitational
+ * parameters default to the values of the DE header (see DEConstants), and a body is skipped if its gravitational
+ * parameter is set to zero. Like EphemerisContext, every query updates the cache, so each thread needs its own instance,
+ * e.g.
+ *
+ *     ThirdBodyAcceleration third_body;
+ *     std::vector<std::array<double, 3>> accel = third_body.get_accelerations(mjdj2k_tdb, sat_positions);
+ */
+class ThirdBodyAcceleration {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an instance that evaluates the compiled-in tables
+        ThirdBodyAcceleration();
+
+        /*!
+         * \brief Create an instance that evaluates the specified tables
+         *
+         * \param tables Views of the tables. The coefficients must remain valid for the lifetime of this object.
+         */
+        explicit ThirdBodyAcceleration(const EphemerisTableSet& tables);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute the Sun and Moon perturbations on satellites that share one epoch
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame, stacked as
+         *     [x0, y0, z0, x1, ...] [km]
+         * \param num_sats Number of satellites
+         * \param accelerations Output perturbations, stacked like positions [km/s^2]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        void get_accelerations(double mjdj2k_tdb, const double* positions, size_t num_sats, double* accelerations);
+
+        /*!
+         * \brief Compute the Sun and Moon perturbations on satellites that each have their own epoch
+         *
+         * \details The body positions are only re-evaluated when the epoch changes, so satellites that share an epoch should
+         * be stored next to each other.
+         *
+         * \param mjdj2k_tdb Epoch of each satellite, as a Modified Julian Date from the J2000 Epoch in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame, stacked as
+         *     [x0, y0, z0, x1, ...] [km]
+         * \param num_sats Number of satellites
+         * \param accelerations Output perturbations, stacked like positions [km/s^2]
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the tables
+         */
+        void get_accelerations(const double* mjdj2k_tdb, const double* positions, size_t num_sats,
+                               double* accelerations);
+
+        /*!
+         * \brief Return the Sun and Moon perturbations on satellites that share one epoch
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame [km]
+         *
+         * \return Perturbation of each satellite [km/s^2]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables
+         */
+        std::vector<std::array<double, 3>> get_accelerations(double mjdj2k_tdb,
+                                                             const std::vector<std::array<double, 3>>& positions);
+
+        /*!
+         * \brief Return the Sun and Moon perturbations on satellites that each have their own epoch
+         *
+         * \param mjdj2k_tdb Epoch of each satellite, as a Modified Julian Date from the J2000 Epoch in the TDB Time System
+         * \param positions Positions of the satellites relative to the Earth in the GCRF frame [km]
+         *
+         * \return Perturbation of each satellite [km/s^2]
+         *
+         * \throws std::invalid_argument If mjdj2k_tdb and positions differ in size
+         * \throws std::out_of_range If an epoch is outside of the range covered by the tables
+         */
+        std::vector<std::array<double, 3>> get_accelerations(const std::vector<double>& mjdj2k_tdb,
+                                                             const std::vector<std::array<double, 3>>& positions);
+
+        /*!
+         * \brief Set the gravitational parameter used for a third body
+         *
+         * \param body Either CentralBody::Sun or CentralBody::Moon
+         * \param gm Gravitational parameter [km^3/s^2], or zero to skip the body
+         *
+         * \throws std::invalid_argument If body is not the Sun or the Moon
+         */
+        void set_gm(CentralBody body, double gm);
+
+        /*!
+         * \brief Return the gravitational parameter used for a third body
+         *
+         * \param body Either CentralBody::Sun or CentralBody::Moon
+         *
+         * \return Gravitational parameter [km^3/s^2]
+         *
+         * \throws std::invalid_argument If body is not the Sun or the Moon
+         */
+        double get_gm(CentralBody body) const;
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Compute the perturbations of num_sats satellites that share the epoch mjdj2k_tdb, overwriting accelerations
+        void compute_epoch(double mjdj2k_tdb, const double* positions, size_t num_sats, double* accelerations);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Gravitational parameter of the Sun [km^3/s^2]
+        double gm_sun_;
+
+        //! Gravitational parameter of the Moon [km^3/s^2]
+        double gm_moon_;
+
+        //! Cache of the last granule of each table
+        EphemerisContext context_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
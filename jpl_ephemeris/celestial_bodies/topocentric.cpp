@@ -0,0 +1,456 @@
+#include "topocentric.hpp"
+
+// standard library includes
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_roots.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of Chebyshev-Lobatto points the elevations are interpolated at, per segment
+constexpr size_t NUM_NODES = 33;
+
+//! Number of segments each Moon granule is split into
+constexpr unsigned int SEGMENTS_PER_GRANULE = 4;
+
+//! Number of sites processed by one task
+constexpr size_t SITES_PER_TASK = 64;
+
+//! Width of the time brackets the events are refined to [days], 1 ms
+constexpr double TIME_TOLERANCE = 1e-3 / 86400.0;
+
+//! Semi-major axis of the WGS84 ellipsoid [km]
+constexpr double WGS84_SEMI_MAJOR_AXIS = 6378.137;
+
+//! Flattening of the WGS84 ellipsoid
+constexpr double WGS84_FLATTENING = 1.0 / 298.257223563;
+
+//! Square matrix acting on the values of a function at the Chebyshev-Lobatto points
+using LobattoMatrix = std::array<std::array<double, NUM_NODES>, NUM_NODES>;
+
+//! Linear maps of the values of a function at the Chebyshev-Lobatto points
+struct LobattoMatrices {
+    //! Maps the values to the coefficients of their interpolant, i.e. chebyshev_lobatto_coefficients() as a matrix
+    LobattoMatrix coefficients{};
+
+    //! Maps the values to the derivative (with respect to y) of their interpolant at the same points
+    LobattoMatrix rates{};
+};
+
+//! Interpolants of one segment, shared by the tasks that process its sites
+struct Segment {
+    //! Start of the segment [days]
+    double begin = 0.;
+
+    //! End of the segment [days]
+    double end = 0.;
+
+    //! Coefficients of the position of the body in the ITRF frame
+    std::array<std::array<double, NUM_NODES>, 3> position{};
+
+    //! sin(elevation) - sin(horizon) at the interpolation points, laid out as [point][site]
+    std::vector<double> values{};
+
+    //! Coefficients of the interpolants of values, laid out as [coefficient][site]
+    std::vector<double> coeff{};
+
+    //! Derivatives (with respect to y) of the interpolants at the interpolation points, laid out as [point][site]
+    std::vector<double> rates{};
+};
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Throw if body is not the Sun or the Moon
+void check_body(CentralBody body, const char* method) {
+    if (body != CentralBody::Sun && body != CentralBody::Moon) {
+        throw std::invalid_argument(std::string("Topocentric::") + method
+                                    + "() - Unexpected input provided for body, which must be the Sun or the Moon.");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the matrices, built once from the interpolants of the unit vectors
+const LobattoMatrices& get_lobatto_matrices() {
+    static const LobattoMatrices matrices = [] {
+        LobattoMatrices mat;
+        for (size_t j = 0; j < NUM_NODES; j++) {
+            std::array<double, NUM_NODES> values{};
+            std::array<double, NUM_NODES> coeff{};
+            values[j] = 1.;
+            chebyshev_lobatto_coefficients<NUM_NODES>(values, coeff);
+
+            std::array<double, NUM_NODES - 1> derivative{};
+            chebyshev_derivative_coefficients(coeff.data(), NUM_NODES, -1., 1., 1., derivative.data());
+            for (size_t k = 0; k < NUM_NODES; k++) {
+                mat.coefficients[k][j] = coeff[k];
+                mat.rates[k][j]        = chebyshev_eval_normalized<NUM_NODES - 1>(chebyshev_lobatto_point<NUM_NODES>(k),
+                                                                                  derivative.data());
+            }
+        }
+        return mat;
+    }();
+    return matrices;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+/*!
+ * \brief Multiply mat by the columns [first, last) of values, both laid out as [point][site], so the inner loop runs along
+ * the sites
+ */
+void multiply_along_sites(const LobattoMatrix& mat, const double* values, size_t num_sites, size_t first, size_t last,
+                          double* result) {
+    for (size_t m = 0; m < NUM_NODES; m++) {
+        double* res = result + m * num_sites;
+        std::fill(res + first, res + last, 0.);
+        for (size_t k = 0; k < NUM_NODES; k++) {
+            const double w    = mat[m][k];
+            const double* val = values + k * num_sites;
+            for (size_t j = first; j < last; j++) {
+                res[j] += w * val[j];
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the end of the segment that starts at begin
+double get_segment_end(const EphemerisTableView& moon, double begin) {
+    const double length = moon.days_per_poly / SEGMENTS_PER_GRANULE;
+    const double ind    = std::floor((begin - moon.start_mjdj2k) / length) + 1.;
+    double end          = moon.start_mjdj2k + ind * length;
+    if (end <= begin) {
+        end += length;
+    }
+    return end;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Find the events of the sites [first, last) inside one segment, appending them to events in order of site
+void find_block_events(const Topocentric& topo, Segment& segment, size_t first, size_t last,
+                       std::vector<HorizonEvent>& events) {
+    const LobattoMatrices& lobatto = get_lobatto_matrices();
+    const size_t num_sites         = topo.get_num_sites();
+
+    multiply_along_sites(lobatto.coefficients, segment.values.data(), num_sites, first, last, segment.coeff.data());
+    multiply_along_sites(lobatto.rates, segment.values.data(), num_sites, first, last, segment.rates.data());
+
+    const double tol = 2. * TIME_TOLERANCE / (segment.end - segment.begin);
+    for (size_t j = first; j < last; j++) {
+        std::array<double, NUM_NODES> rates{};
+        std::array<double, NUM_NODES> coeff{};
+        for (size_t k = 0; k < NUM_NODES; k++) {
+            rates[k] = segment.rates[k * num_sites + j];
+            coeff[k] = segment.coeff[k * num_sites + j];
+        }
+
+        // The rate has degree N - 2, so its last coefficient stays zero
+        std::array<double, NUM_NODES> rate_coeff{};
+        chebyshev_derivative_coefficients(coeff.data(), NUM_NODES, -1., 1., 1., rate_coeff.data());
+
+        // The culminations split the segment into pieces on which the elevation is monotonic, each holding at most one
+        // rise or set
+        const std::vector<double> extrema = chebyshev_lobatto_sign_changes<NUM_NODES>(rates, rate_coeff, tol);
+
+        std::vector<std::pair<double, HorizonEventType>> roots;
+        for (double y : extrema) {
+            double rate = 0., acceleration = 0.;
+            chebyshev_state_eval_normalized<NUM_NODES>(y, rate_coeff.data(), rate, acceleration);
+            roots.emplace_back(y, acceleration < 0. ? HorizonEventType::UpperCulmination
+                                                    : HorizonEventType::LowerCulmination);
+        }
+        for (double y : chebyshev_monotone_sign_changes<NUM_NODES>(coeff, extrema, tol)) {
+            double value = 0., rate = 0.;
+            chebyshev_state_eval_normalized<NUM_NODES>(y, coeff.data(), value, rate);
+            roots.emplace_back(y, rate > 0. ? HorizonEventType::Rise : HorizonEventType::Set);
+        }
+
+        for (const std::pair<double, HorizonEventType>& root : roots) {
+            std::array<double, 3> r{};
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                r[comp] = chebyshev_eval_normalized<NUM_NODES>(root.first, segment.position[comp].data());
+            }
+
+            const std::array<double, 2> az_el = topo.get_azimuth_elevation(r, j);
+            events.push_back(HorizonEvent{j, transform_from_chebyshev_range(root.first, segment.begin, segment.end),
+                                          root.second, az_el[0], az_el[1]});
+        }
+    }
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+Topocentric::Topocentric(const std::vector<GroundSite>& sites, ItrfRotation itrf, unsigned int num_threads) :
+    sites_(sites), itrf_(std::move(itrf)), context_(EphemerisTableSet::get_compiled_in()),
+    pool_(std::make_shared<ThreadPool>(num_threads)), executor_() {
+    initialize_sites();
+
+    std::shared_ptr<ThreadPool> pool = pool_;
+    executor_ = [pool](size_t num_tasks, const std::function<void(size_t)>& task) { pool->run(num_tasks, task); };
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+Topocentric::Topocentric(const std::vector<GroundSite>& sites, ItrfRotation itrf, BatchExecutor executor) :
+    sites_(sites), itrf_(std::move(itrf)), context_(EphemerisTableSet::get_compiled_in()), pool_(),
+    executor_(std::move(executor)) {
+    if (!executor_) {
+        throw std::invalid_argument("Topocentric() - The provided executor is empty.");
+    }
+    initialize_sites();
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> Topocentric::get_position_itrf(CentralBody body, double mjdj2k_tdb) {
+    check_body(body, "get_position_itrf");
+
+    const std::array<double, 3> gcrf = context_.get_position(body, mjdj2k_tdb);
+    const RotationMatrix rot         = itrf_.get_rotation_from_gcrf(mjdj2k_tdb);
+
+    std::array<double, 3> itrf{};
+    for (unsigned int k = 0; k < 3; k++) {
+        itrf[k] = rot[k][0] * gcrf[0] + rot[k][1] * gcrf[1] + rot[k][2] * gcrf[2];
+    }
+    return itrf;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Topocentric::get_elevations(CentralBody body, const double* mjdj2k_tdb, size_t num_epochs, double* elevations) {
+    check_body(body, "get_elevations");
+
+    const size_t num_sites = sites_.size();
+    for (size_t i = 0; i < num_epochs; i++) {
+        double* el = elevations + i * num_sites;
+        compute_sin_elevations(get_position_itrf(body, mjdj2k_tdb[i]), el);
+        for (size_t j = 0; j < num_sites; j++) {
+            el[j] = std::asin(std::clamp(el[j], -1., 1.));
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Topocentric::get_azimuths_elevations(CentralBody body, const double* mjdj2k_tdb, size_t num_epochs,
+                                          double* azimuths, double* elevations) {
+    check_body(body, "get_azimuths_elevations");
+
+    const size_t num_sites = sites_.size();
+    const double* px       = position_[0].data();
+    const double* py       = position_[1].data();
+    const double* pz       = position_[2].data();
+    const double* ex       = east_[0].data();
+    const double* ey       = east_[1].data();
+    const double* nx       = north_[0].data();
+    const double* ny       = north_[1].data();
+    const double* nz       = north_[2].data();
+    const double* ux       = up_[0].data();
+    const double* uy       = up_[1].data();
+    const double* uz       = up_[2].data();
+
+    for (size_t i = 0; i < num_epochs; i++) {
+        const std::array<double, 3> r = get_position_itrf(body, mjdj2k_tdb[i]);
+        double* az                    = azimuths + i * num_sites;
+        double* el                    = elevations + i * num_sites;
+
+        // The east and north components are written to the outputs first, so this loop has no calls and vectorizes
+        for (size_t j = 0; j < num_sites; j++) {
+            const double dx = r[0] - px[j], dy = r[1] - py[j], dz = r[2] - pz[j];
+            az[j]           = ex[j] * dx + ey[j] * dy;
+            el[j]           = nx[j] * dx + ny[j] * dy + nz[j] * dz;
+        }
+
+        for (size_t j = 0; j < num_sites; j++) {
+            const double dx = r[0] - px[j], dy = r[1] - py[j], dz = r[2] - pz[j];
+            const double e = az[j], n = el[j];
+            const double u = ux[j] * dx + uy[j] * dy + uz[j] * dz;
+
+            const double azimuth = std::atan2(e, n);
+            az[j]                = azimuth < 0. ? azimuth + 2. * std::numbers::pi : azimuth;
+            el[j]                = std::atan2(u, std::sqrt(e * e + n * n));
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<HorizonEvent> Topocentric::find_horizon_events(CentralBody body, double start_mjdj2k_tdb,
+                                                           double stop_mjdj2k_tdb, double horizon) {
+    check_body(body, "find_horizon_events");
+
+    if (!(start_mjdj2k_tdb < stop_mjdj2k_tdb)) {
+        throw std::invalid_argument("Topocentric::find_horizon_events() - The start of the search interval must be "
+                                    "before its end.");
+    }
+
+    // Evaluate both ends up front, so an interval outside of the tables or the rotation fails before any work is done
+    get_position_itrf(body, start_mjdj2k_tdb);
+    get_position_itrf(body, stop_mjdj2k_tdb);
+
+    const size_t num_sites        = sites_.size();
+    const size_t num_blocks       = (num_sites + SITES_PER_TASK - 1) / SITES_PER_TASK;
+    const double sin_horizon      = std::sin(horizon);
+    const EphemerisTableView moon = EphemerisTableSet::get_compiled_in().moon;
+
+    Segment segment;
+    segment.values.resize(NUM_NODES * num_sites);
+    segment.coeff.resize(NUM_NODES * num_sites);
+    segment.rates.resize(NUM_NODES * num_sites);
+
+    std::vector<HorizonEvent> events;
+    std::vector<std::vector<HorizonEvent>> block_events(num_blocks);
+    while (start_mjdj2k_tdb < stop_mjdj2k_tdb) {
+        segment.begin = start_mjdj2k_tdb;
+        segment.end   = std::min(get_segment_end(moon, start_mjdj2k_tdb), stop_mjdj2k_tdb);
+
+        // The body is evaluated and rotated once per interpolation point, and every site reuses it
+        std::array<std::array<double, NUM_NODES>, 3> positions{};
+        for (size_t k = 0; k < NUM_NODES; k++) {
+            const double t = transform_from_chebyshev_range(chebyshev_lobatto_point<NUM_NODES>(k), segment.begin,
+                                                            segment.end);
+            const std::array<double, 3> r = get_position_itrf(body, t);
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                positions[comp][k] = r[comp];
+            }
+
+            double* val = segment.values.data() + k * num_sites;
+            compute_sin_elevations(r, val);
+            for (size_t j = 0; j < num_sites; j++) {
+                val[j] -= sin_horizon;
+            }
+        }
+        for (unsigned int comp = 0; comp < 3; comp++) {
+            chebyshev_lobatto_coefficients<NUM_NODES>(positions[comp], segment.position[comp]);
+        }
+
+        executor_(num_blocks, [&](size_t b) {
+            block_events[b].clear();
+            find_block_events(*this, segment, b * SITES_PER_TASK, std::min((b + 1) * SITES_PER_TASK, num_sites),
+                              block_events[b]);
+        });
+
+        const size_t first_event = events.size();
+        for (const std::vector<HorizonEvent>& block : block_events) {
+            events.insert(events.end(), block.begin(), block.end());
+        }
+        std::stable_sort(events.begin() + static_cast<std::ptrdiff_t>(first_event), events.end(),
+                         [](const HorizonEvent& lhs, const HorizonEvent& rhs) { return lhs.mjdj2k_tdb < rhs.mjdj2k_tdb; });
+
+        start_mjdj2k_tdb = segment.end;
+    }
+    return events;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 2> Topocentric::get_azimuth_elevation(const std::array<double, 3>& r_itrf, size_t site) const {
+    std::array<double, 3> enu{};
+    for (unsigned int comp = 0; comp < 3; comp++) {
+        const double d = r_itrf[comp] - position_[comp][site];
+        enu[0] += east_[comp][site] * d;
+        enu[1] += north_[comp][site] * d;
+        enu[2] += up_[comp][site] * d;
+    }
+
+    const double azimuth = std::atan2(enu[0], enu[1]);
+    return std::array<double, 2>{azimuth < 0. ? azimuth + 2. * std::numbers::pi : azimuth,
+                                 std::atan2(enu[2], std::sqrt(enu[0] * enu[0] + enu[1] * enu[1]))};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const std::vector<GroundSite>& Topocentric::get_sites() const {
+    return sites_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+size_t Topocentric::get_num_sites() const {
+    return sites_.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> Topocentric::get_site_position(const GroundSite& site) {
+    constexpr double e2 = WGS84_FLATTENING * (2. - WGS84_FLATTENING);
+
+    const double slat = std::sin(site.latitude), clat = std::cos(site.latitude);
+    const double radius = WGS84_SEMI_MAJOR_AXIS / std::sqrt(1. - e2 * slat * slat);
+    return std::array<double, 3>{(radius + site.altitude) * clat * std::cos(site.longitude),
+                                 (radius + site.altitude) * clat * std::sin(site.longitude),
+                                 (radius * (1. - e2) + site.altitude) * slat};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Topocentric::initialize_sites() {
+    for (unsigned int comp = 0; comp < 3; comp++) {
+        position_[comp].resize(sites_.size());
+        east_[comp].resize(sites_.size());
+        north_[comp].resize(sites_.size());
+        up_[comp].resize(sites_.size());
+    }
+
+    for (size_t j = 0; j < sites_.size(); j++) {
+        const GroundSite& site = sites_[j];
+        if (!(std::abs(site.latitude) <= 0.5 * std::numbers::pi) || !std::isfinite(site.longitude)
+            || !std::isfinite(site.altitude)) {
+            throw std::invalid_argument("Topocentric() - The latitude of a site must be in [-pi/2, pi/2], and its "
+                                        "longitude and altitude must be finite.");
+        }
+
+        const std::array<double, 3> pos = get_site_position(site);
+        const double slat = std::sin(site.latitude), clat = std::cos(site.latitude);
+        const double slon = std::sin(site.longitude), clon = std::cos(site.longitude);
+
+        const std::array<double, 3> east{-slon, clon, 0.};
+        const std::array<double, 3> north{-slat * clon, -slat * slon, clat};
+        const std::array<double, 3> up{clat * clon, clat * slon, slat};
+        for (unsigned int comp = 0; comp < 3; comp++) {
+            position_[comp][j] = pos[comp];
+            east_[comp][j]     = east[comp];
+            north_[comp][j]    = north[comp];
+            up_[comp][j]       = up[comp];
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Topocentric::compute_sin_elevations(const std::array<double, 3>& r, double* sin_elevations) const {
+    const size_t num_sites = sites_.size();
+    const double* px       = position_[0].data();
+    const double* py       = position_[1].data();
+    const double* pz       = position_[2].data();
+    const double* ux       = up_[0].data();
+    const double* uy       = up_[1].data();
+    const double* uz       = up_[2].data();
+
+    for (size_t j = 0; j < num_sites; j++) {
+        const double dx   = r[0] - px[j], dy = r[1] - py[j], dz = r[2] - pz[j];
+        sin_elevations[j] = (ux[j] * dx + uy[j] * dy + uz[j] * dz) / std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+}  // namespace jpl_ephemeris
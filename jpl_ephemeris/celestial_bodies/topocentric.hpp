@@ -0,0 +1,261 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_TOPOCENTRIC_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_TOPOCENTRIC_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/topocentric.hpp
+ * \brief Defines a class for evaluating the azimuth and elevation of the Sun or Moon from many ground sites, and finding
+ * their rise, set, and culmination times
+ */
+
+// standard library includes
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/batch_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/frames/itrf_rotation.hpp"
+#include "jpl_ephemeris/parallel/thread_pool.hpp"
+
+namespace jpl_ephemeris {
+
+//! Geodetic coordinates of a ground site on the WGS84 ellipsoid
+struct GroundSite {
+    //! Geodetic latitude [rad]
+    double latitude = 0.;
+
+    //! East longitude [rad]
+    double longitude = 0.;
+
+    //! Height above the ellipsoid [km]
+    double altitude = 0.;
+};
+
+//! Specifies a type of event found by Topocentric::find_horizon_events()
+enum class HorizonEventType : int {
+    Rise = 0,              //!< Elevation increases through the horizon
+    Set = 1,               //!< Elevation decreases through the horizon
+    UpperCulmination = 2,  //!< Maximum of the elevation
+    LowerCulmination = 3,  //!< Minimum of the elevation
+};
+
+//! Event found by Topocentric::find_horizon_events()
+struct HorizonEvent {
+    //! Index of the site in the list provided to the Topocentric constructor
+    size_t site = 0;
+
+    //! Modified Julian Date from the J2000 Epoch of the event, in the TDB Time System
+    double mjdj2k_tdb = 0.;
+
+    //! Type of the event
+    HorizonEventType type = HorizonEventType::Rise;
+
+    //! Azimuth of the body at the event, measured from north towards east [rad], in [0, 2 pi)
+    double azimuth = 0.;
+
+    //! Elevation of the body at the event [rad]
+    double elevation = 0.;
+};
+
+/*!
+ * \brief Defines a class for evaluating the azimuth and elevation of the Sun or Moon from many ground sites, and finding
+ * their rise, set, and culmination times
+ *
+ * \details The position of the body relative to the Earth is evaluated and rotated to the ITRF frame once per epoch, and
+ * the sites are then processed together: the site positions and their east, north, and up unit vectors are stored as
+ * structures of arrays, so the loops over the sites are plain dot products the compiler can vectorize.
+ *
+ * The horizon events of every site are the sign changes of sin(elevation) - sin(horizon) and of its rate. The search
+ * interval is split on the Moon granules, which also lie inside single granules of the other tables, and each granule into
+ * segments of a quarter of its length (one day for DE430), so the function is smooth on a segment and spans at most about
+ * one diurnal cycle. On each segment the body is evaluated and rotated at 33 Chebyshev-Lobatto points only, and the values
+ * of all sites are interpolated with matrix products that run along the sites. The culminations of each site are
+ * bracketed on its interpolant with the rates at the same points (see chebyshev_lobatto_sign_changes), and split the
+ * segment into pieces on which the elevation is monotonic, each holding at most one rise or set (see
+ * chebyshev_monotone_sign_changes). Every event is refined to 1 ms, and reported with the azimuth and elevation at the
+ * interpolated position of the body. The sites of a segment are processed in parallel blocks, and the results do not
+ * depend on the number of threads. A rise or set is a sign change, so a grazing pass that only touches the horizon is not
+ * reported.
+ *
+ * Positions are geometric (no light time, aberration, or refraction). The default horizon of -50 arcmin is the standard
+ * almanac value for the upper limb of the Sun or Moon, 34 arcmin of refraction plus a 16 arcmin semidiameter; pass zero
+ * for the geometric center. Every query updates the caches of the tables and of the rotation, so each thread that queries
+ * needs its own instance, e.g.
+ *
+ *     Nutation nutation = Nutation::from_de_ascii("header.430_572", {"ascp1950.430", "ascp2050.430"});
+ *     Topocentric topo(sites, ItrfRotation(CIPTable::fit(nutation), EarthOrientationTable::from_iers_finals("finals.all")));
+ *     std::vector<HorizonEvent> events = topo.find_horizon_events(CentralBody::Sun, start_mjdj2k_tdb, stop_mjdj2k_tdb);
+ */
+class Topocentric {
+    public:
+
+        //! Default horizon, for the upper limb of the Sun or Moon under standard refraction [rad]
+        static constexpr double STANDARD_HORIZON = -50.0 / 60.0 * std::numbers::pi / 180.0;
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create an instance for the specified sites, with its own thread pool for find_horizon_events()
+         *
+         * \param sites Ground sites
+         * \param itrf Rotation from the GCRF frame to the ITRF frame
+         * \param num_threads Number of threads used, including the calling thread. Zero uses the hardware concurrency.
+         *
+         * \throws std::invalid_argument If a latitude is outside of [-pi/2, pi/2], or a coordinate is not finite
+         */
+        Topocentric(const std::vector<GroundSite>& sites, ItrfRotation itrf, unsigned int num_threads = 1);
+
+        /*!
+         * \brief Create an instance for the specified sites, which runs the blocks of sites of find_horizon_events() on a
+         * caller-supplied executor
+         *
+         * \param sites Ground sites
+         * \param itrf Rotation from the GCRF frame to the ITRF frame
+         * \param executor Executor used to run the blocks of sites
+         *
+         * \throws std::invalid_argument If a latitude is outside of [-pi/2, pi/2], a coordinate is not finite, or executor is
+         *     empty
+         */
+        Topocentric(const std::vector<GroundSite>& sites, ItrfRotation itrf, BatchExecutor executor);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the position of the body relative to the center of the Earth, in the ITRF frame
+         *
+         * \param body Body, which must be CentralBody::Sun or CentralBody::Moon
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Position of the body in the ITRF frame [km]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for body
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the tables or the rotation
+         */
+        std::array<double, 3> get_position_itrf(CentralBody body, double mjdj2k_tdb);
+
+        /*!
+         * \brief Evaluate the elevation of the body from every site at a batch of epochs
+         *
+         * \param body Body, which must be CentralBody::Sun or CentralBody::Moon
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param elevations Output elevations [rad], num_epochs * get_num_sites() values, where elevations[i *
+         *     get_num_sites() + j] is the elevation at epoch i from site j
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for body
+         * \throws std::out_of_range If an epoch is outside of the range covered by the tables or the rotation
+         */
+        void get_elevations(CentralBody body, const double* mjdj2k_tdb, size_t num_epochs, double* elevations);
+
+        /*!
+         * \brief Evaluate the azimuth and elevation of the body from every site at a batch of epochs
+         *
+         * \param body Body, which must be CentralBody::Sun or CentralBody::Moon
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param azimuths Output azimuths, measured from north towards east [rad], in [0, 2 pi), in the layout of elevations
+         * \param elevations Output elevations [rad], num_epochs * get_num_sites() values, where elevations[i *
+         *     get_num_sites() + j] is the elevation at epoch i from site j
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for body
+         * \throws std::out_of_range If an epoch is outside of the range covered by the tables or the rotation
+         */
+        void get_azimuths_elevations(CentralBody body, const double* mjdj2k_tdb, size_t num_epochs, double* azimuths,
+                                     double* elevations);
+
+        /*!
+         * \brief Find the rises, sets, and culminations of the body at every site in [start, stop]
+         *
+         * \param body Body, which must be CentralBody::Sun or CentralBody::Moon
+         * \param start_mjdj2k_tdb Start of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param stop_mjdj2k_tdb End of the search interval, as a Modified Julian Date from the J2000 Epoch in TDB
+         * \param horizon Elevation of the horizon used for the rises and sets [rad]
+         *
+         * \return Events of every site in increasing order of time
+         *
+         * \throws std::invalid_argument If the interval is empty, or an unexpected value is provided for body
+         * \throws std::out_of_range If the interval is outside of the range covered by the tables or the rotation
+         */
+        std::vector<HorizonEvent> find_horizon_events(CentralBody body, double start_mjdj2k_tdb, double stop_mjdj2k_tdb,
+                                                      double horizon = STANDARD_HORIZON);
+
+        /*!
+         * \brief Return the azimuth and elevation of a body at the specified position from one site
+         *
+         * \param r_itrf Position of the body relative to the center of the Earth, in the ITRF frame [km]
+         * \param site Index of the site
+         *
+         * \return Azimuth, measured from north towards east [rad], in [0, 2 pi), and elevation [rad]
+         */
+        std::array<double, 2> get_azimuth_elevation(const std::array<double, 3>& r_itrf, size_t site) const;
+
+        //! Return the ground sites
+        const std::vector<GroundSite>& get_sites() const;
+
+        //! Return the number of ground sites
+        size_t get_num_sites() const;
+
+        /*!
+         * \brief Return the position of a ground site in the ITRF frame
+         *
+         * \param site Geodetic coordinates of the site on the WGS84 ellipsoid
+         *
+         * \return Position of the site [km]
+         */
+        static std::array<double, 3> get_site_position(const GroundSite& site);
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Validate the sites, and fill in their positions and local unit vectors
+        void initialize_sites();
+
+        //! Write sin(elevation) of the body at the ITRF position r for every site to sin_elevations
+        void compute_sin_elevations(const std::array<double, 3>& r, double* sin_elevations) const;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Ground sites
+        std::vector<GroundSite> sites_;
+
+        //! x, y, z of the site positions in the ITRF frame [km]
+        std::array<std::vector<double>, 3> position_{};
+
+        //! x, y, z of the local east unit vectors in the ITRF frame
+        std::array<std::vector<double>, 3> east_{};
+
+        //! x, y, z of the local north unit vectors in the ITRF frame
+        std::array<std::vector<double>, 3> north_{};
+
+        //! x, y, z of the local up (ellipsoid normal) unit vectors in the ITRF frame
+        std::array<std::vector<double>, 3> up_{};
+
+        //! Rotation from the GCRF frame to the ITRF frame
+        ItrfRotation itrf_;
+
+        //! Cached granules of the compiled-in tables
+        EphemerisContext context_;
+
+        //! Thread pool owned by this object, when no executor was supplied
+        std::shared_ptr<ThreadPool> pool_;
+
+        //! Executor that runs the blocks of sites
+        BatchExecutor executor_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
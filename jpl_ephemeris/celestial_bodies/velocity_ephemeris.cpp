@@ -0,0 +1,57 @@
+#include "velocity_ephemeris.hpp"
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/derivative_ephemeris_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/relative_vector.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Derivative tables of the compiled-in position tables
+struct DerivativeTables {
+    //! Velocity of the Sun relative to the SSB
+    DerivativeEphemerisTable<13> sun_from_ssb{SunFromSSBGCRFTable::get_table_view(), "sun_from_ssb velocity"};
+
+    //! Velocity of the EMB relative to the SSB
+    DerivativeEphemerisTable<15> emb_from_ssb{EMBFromSSBGCRFTable::get_table_view(), "emb_from_ssb velocity"};
+
+    //! Velocity of the Earth relative to the EMB
+    DerivativeEphemerisTable<15> earth_from_emb{EarthFromEMBGCRFTable::get_table_view(), "earth_from_emb velocity"};
+
+    //! Velocity of the Moon relative to the Earth
+    DerivativeEphemerisTable<15> moon{MoonGCRFTable::get_table_view(), "moon velocity"};
+};
+
+//! Return the derivative tables, which are built on first use
+const DerivativeTables& get_tables() {
+    static const DerivativeTables tables;
+    return tables;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void VelocityEphemeris::initialize() {
+    get_tables();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> VelocityEphemeris::get_velocity(CentralBody target, double mjdj2k_tdb, CentralBody central_body) {
+    const DerivativeTables& tables = get_tables();
+
+    return compute_table_relative_vector(
+        target, central_body, tables.sun_from_ssb, tables.emb_from_ssb, tables.earth_from_emb, tables.moon,
+        [&](const auto& table) { return table.get_velocity(mjdj2k_tdb); },
+        "VelocityEphemeris::get_velocity() - Unexpected input provided for CentralBody");
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,66 @@
+#ifndef JPL_EPHEMERIS_CELESTIAL_BODIES_VELOCITY_EPHEMERIS_HPP
+#define JPL_EPHEMERIS_CELESTIAL_BODIES_VELOCITY_EPHEMERIS_HPP
+
+/*!
+ * \file jpl_ephemeris/celestial_bodies/velocity_ephemeris.hpp
+ * \brief Defines a static class for computing the velocity of the Sun, Earth, and Moon from precomputed derivative tables
+ */
+
+// standard library includes
+#include <array>
+
+// jpl_ephemeris includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Defines a static class for computing the velocity of the Sun, Earth, and Moon from precomputed derivative tables
+ *
+ * \details The Chebyshev coefficients of the velocity are derived from the compiled-in position tables the first time
+ * they are needed (or when initialize() is called), so each velocity query is a single plain Clenshaw evaluation per
+ * component. The derivative tables take roughly the same memory as the position tables (about 8 MB).
+ */
+class VelocityEphemeris {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Delete the default constructor
+        VelocityEphemeris() = delete;
+
+        //! Delete the copy constructor
+        VelocityEphemeris(const VelocityEphemeris&) = delete;
+
+        //! Delete the copy assignment operator
+        VelocityEphemeris& operator=(const VelocityEphemeris&) = delete;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Build the derivative tables now, rather than on the first velocity query
+         */
+        static void initialize();
+
+        /*!
+         * \brief Return the velocity of the target body relative to the specified CentralBody
+         *
+         * \param target Body whose velocity is computed
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \return Velocity of the target relative to the specified CentralBody in the GCRF frame [km/s]
+         *
+         * \throws std::invalid_argument If an unexpected value is provided for target or central_body
+         */
+        static std::array<double, 3> get_velocity(CentralBody target, double mjdj2k_tdb,
+                                                  CentralBody central_body = CentralBody::Earth);
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
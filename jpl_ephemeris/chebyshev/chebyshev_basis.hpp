@@ -0,0 +1,67 @@
+#ifndef JPL_EPHEMERIS_CHEBYSHEV_CHEBYSHEV_BASIS_HPP
+#define JPL_EPHEMERIS_CHEBYSHEV_CHEBYSHEV_BASIS_HPP
+
+/*!
+ * \file jpl_ephemeris/chebyshev/chebyshev_basis.hpp
+ * \brief Functions to generate the Chebyshev basis T_0..T_{n-1} (and its derivative) at a point, so that several sets of
+ * coefficients sharing the same interval can be evaluated as dot products against a single basis vector.
+ */
+
+// Standard Library Includes
+#include <cstddef>
+
+namespace jpl_ephemeris {
+
+//! Maximum number of Chebyshev coefficients supported by the shared-basis evaluators
+static constexpr size_t MAX_CHEBYSHEV_COEFF = 32;
+
+/*!
+ * \brief Generate the Chebyshev basis T_0(y)..T_{n-1}(y) using the three-term recurrence T_{k+1} = 2y T_k - T_{k-1}
+ *
+ * \param y Value in the Chebyshev range [-1, 1]
+ * \param n Number of basis values to generate
+ * \param basis Output array of at least n values
+ */
+inline void chebyshev_basis(double y, size_t n, double* basis) {
+    if (n == 0) {
+        return;
+    }
+    basis[0] = 1.;
+    if (n == 1) {
+        return;
+    }
+    basis[1]  = y;
+    double y2 = 2. * y;
+    for (size_t k = 2; k < n; k++) {
+        basis[k] = y2 * basis[k - 1] - basis[k - 2];
+    }
+}
+
+/*!
+ * \brief Generate the derivative of the Chebyshev basis with respect to y, dT_0/dy..dT_{n-1}/dy, using the recurrence
+ * T'_{k+1} = 2 T_k + 2y T'_k - T'_{k-1}
+ *
+ * \param y Value in the Chebyshev range [-1, 1]
+ * \param n Number of basis values to generate
+ * \param basis Output array of at least n values for T_k(y), which is a by-product of the recurrence
+ * \param derivative_basis Output array of at least n values for dT_k/dy
+ */
+inline void chebyshev_derivative_basis(double y, size_t n, double* basis, double* derivative_basis) {
+    chebyshev_basis(y, n, basis);
+    if (n == 0) {
+        return;
+    }
+    derivative_basis[0] = 0.;
+    if (n == 1) {
+        return;
+    }
+    derivative_basis[1] = 1.;
+    double y2           = 2. * y;
+    for (size_t k = 2; k < n; k++) {
+        derivative_basis[k] = 2. * basis[k - 1] + y2 * derivative_basis[k - 1] - derivative_basis[k - 2];
+    }
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -6,8 +6,13 @@
  * \brief Include files for the chebyshev directory
  */
 
+#include "jpl_ephemeris/chebyshev/chebyshev_basis.hpp"
 #include "jpl_ephemeris/chebyshev/chebyshev_derivative_eval.hpp"
 #include "jpl_ephemeris/chebyshev/chebyshev_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_roots.hpp"
 #include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+#include "jpl_ephemeris/chebyshev/forward_difference.hpp"
+#include "jpl_ephemeris/chebyshev/power_basis.hpp"
 
 #endif
@@ -0,0 +1,156 @@
+#ifndef JPL_EPHEMERIS_CHEBYSHEV_CHEBYSHEV_NORMALIZED_EVAL_HPP
+#define JPL_EPHEMERIS_CHEBYSHEV_CHEBYSHEV_NORMALIZED_EVAL_HPP
+
+/*!
+ * \file jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp
+ * \brief Functions to evaluate a Chebyshev polynomial, and optionally its derivative, at a value that has already been
+ * transformed to the Chebyshev range [-1, 1].
+ *
+ * \details These skip the change of variables and bounds checks of chebyshev_eval and chebyshev_derivative_eval, so that
+ * callers that cache the normalization of a granule (or evaluate many components at the same point) only pay for the
+ * recurrence itself. The coefficients use the CSpice convention, where coeff[0] is applied with a factor of 1.0.
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Evaluate the Chebyshev polynomial at y in [-1, 1] using Clenshaw's recurrence formula
+ *
+ * \reference Numerical Recipes in Fortran 77: The Art of Scientific Computing, Page 187-188, Routine chebev
+ *
+ * \param y Value in the Chebyshev range [-1, 1]
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ *
+ * \return Value of the Chebyshev polynomial
+ *
+ * \tparam N Number of coefficients, which must be at least one
+ */
+template<size_t N>
+inline double chebyshev_eval_normalized(double y, const double* coeff) {
+    static_assert(N >= 1, "chebyshev_eval_normalized() - Number of coefficients must be greater than zero.");
+
+    double y2 = 2. * y;
+    double d = 0., dd = 0., sv = 0.;
+    for (size_t k = N - 1; k >= 1; k--) {
+        sv = d;
+        d  = y2 * d - dd + coeff[k];
+        dd = sv;
+    }
+    return y * d - dd + coeff[0];
+}
+
+/*!
+ * \brief Evaluate the Chebyshev polynomial and its derivative with respect to y, at y in [-1, 1], in a single pass of
+ * Clenshaw's recurrence formula
+ *
+ * \reference Numerical Recipes in Fortran 77: The Art of Scientific Computing, Page 189, Routine chder
+ *
+ * \param y Value in the Chebyshev range [-1, 1]
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ * \param value Output value of the Chebyshev polynomial
+ * \param derivative Output derivative of the Chebyshev polynomial with respect to y
+ *
+ * \tparam N Number of coefficients, which must be at least one
+ */
+template<size_t N>
+inline void chebyshev_state_eval_normalized(double y, const double* coeff, double& value, double& derivative) {
+    static_assert(N >= 1, "chebyshev_state_eval_normalized() - Number of coefficients must be greater than zero.");
+
+    double y2 = 2. * y;
+    double d = 0., dd = 0., sv = 0.;
+    double dp = 0., ddp = 0., svp = 0.;
+    for (size_t k = N - 1; k >= 1; k--) {
+        svp = dp;
+        dp  = y2 * dp - ddp + 2. * d;
+        ddp = svp;
+
+        sv = d;
+        d  = y2 * d - dd + coeff[k];
+        dd = sv;
+    }
+    value      = y * d - dd + coeff[0];
+    derivative = y * dp - ddp + d;
+}
+
+/*!
+ * \brief Evaluate the derivative of the Chebyshev polynomial with respect to y, at y in [-1, 1], using Clenshaw's
+ * recurrence formula
+ *
+ * \details The recurrence of the polynomial is still run, since the derivative depends on it, but its value is never
+ * formed, as in chebyshev_derivative_eval.
+ *
+ * \reference Numerical Recipes in Fortran 77: The Art of Scientific Computing, Page 189, Routine chder
+ *
+ * \param y Value in the Chebyshev range [-1, 1]
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ *
+ * \return Derivative of the Chebyshev polynomial with respect to y
+ *
+ * \tparam N Number of coefficients, which must be at least one
+ */
+template<size_t N>
+inline double chebyshev_derivative_eval_normalized(double y, const double* coeff) {
+    static_assert(N >= 1, "chebyshev_derivative_eval_normalized() - Number of coefficients must be greater than zero.");
+
+    double y2 = 2. * y;
+    double d = 0., dd = 0., sv = 0.;
+    double dp = 0., ddp = 0., svp = 0.;
+    for (size_t k = N - 1; k >= 1; k--) {
+        svp = dp;
+        dp  = y2 * dp - ddp + 2. * d;
+        ddp = svp;
+
+        sv = d;
+        d  = y2 * d - dd + coeff[k];
+        dd = sv;
+    }
+    return y * dp - ddp + d;
+}
+
+/*!
+ * \brief Evaluate the Chebyshev polynomial and its first K derivatives with respect to y, at y in [-1, 1], in a single
+ * pass of Clenshaw's recurrence formula
+ *
+ * \details Differentiating the recurrence b_k = 2y b_{k+1} - b_{k+2} + c_k m times gives
+ * b_k^(m) = 2y b_{k+1}^(m) + 2m b_{k+1}^(m-1) - b_{k+2}^(m), so every order runs alongside the value, and
+ * f^(m) = y b_1^(m) + m b_1^(m-1) - b_2^(m). K = 1 reduces to chebyshev_state_eval_normalized().
+ *
+ * \param y Value in the Chebyshev range [-1, 1]
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ * \param values Output value of the Chebyshev polynomial, followed by its derivatives of order 1..K with respect to y
+ *
+ * \tparam N Number of coefficients, which must be at least one
+ * \tparam K Highest order of derivative
+ */
+template<size_t N, size_t K>
+inline void chebyshev_derivatives_eval_normalized(double y, const double* coeff, std::array<double, K + 1>& values) {
+    static_assert(N >= 1, "chebyshev_derivatives_eval_normalized() - Number of coefficients must be greater than zero.");
+
+    double y2 = 2. * y;
+    std::array<double, K + 1> d{}, dd{};
+    for (size_t k = N - 1; k >= 1; k--) {
+        // Update the highest order first, so d[m - 1] still holds b_{k+1}^(m-1)
+        for (size_t m = K; m >= 1; m--) {
+            double sv = d[m];
+            d[m]      = y2 * d[m] - dd[m] + 2. * static_cast<double>(m) * d[m - 1];
+            dd[m]     = sv;
+        }
+
+        double sv = d[0];
+        d[0]      = y2 * d[0] - dd[0] + coeff[k];
+        dd[0]     = sv;
+    }
+
+    values[0] = y * d[0] - dd[0] + coeff[0];
+    for (size_t m = 1; m <= K; m++) {
+        values[m] = y * d[m] - dd[m] + static_cast<double>(m) * d[m - 1];
+    }
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif
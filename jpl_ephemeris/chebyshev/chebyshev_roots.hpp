@@ -0,0 +1,266 @@
+#ifndef JPL_EPHEMERIS_CHEBYSHEV_CHEBYSHEV_ROOTS_HPP
+#define JPL_EPHEMERIS_CHEBYSHEV_CHEBYSHEV_ROOTS_HPP
+
+/*!
+ * \file jpl_ephemeris/chebyshev/chebyshev_roots.hpp
+ * \brief Functions to interpolate a function at the Chebyshev-Lobatto points, and to find the sign changes of a Chebyshev
+ * polynomial on [-1, 1].
+ *
+ * \details The coefficients use the CSpice convention, where coeff[0] is applied with a factor of 1.0.
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Return the Chebyshev-Lobatto point y_j = cos(pi j / (N - 1)), which runs from y_0 = 1 down to y_{N-1} = -1
+ *
+ * \param j Index of the point
+ *
+ * \tparam N Number of points, which must be at least two
+ */
+template<size_t N>
+inline double chebyshev_lobatto_point(size_t j) {
+    static_assert(N >= 2, "chebyshev_lobatto_point() - Number of points must be at least two.");
+    return std::cos(std::numbers::pi * static_cast<double>(j) / static_cast<double>(N - 1));
+}
+
+/*!
+ * \brief Compute the coefficients of the polynomial of degree N - 1 that interpolates a function at the Chebyshev-Lobatto
+ * points
+ *
+ * \reference Trefethen, Approximation Theory and Approximation Practice, Chapter 3 (discrete cosine transform of the values)
+ *
+ * \param values Function values at chebyshev_lobatto_point<N>(0), ..., chebyshev_lobatto_point<N>(N - 1)
+ * \param coeff Output Chebyshev coefficients c_0..c_{N-1}
+ *
+ * \tparam N Number of points, which must be at least two
+ */
+template<size_t N>
+void chebyshev_lobatto_coefficients(const std::array<double, N>& values, std::array<double, N>& coeff) {
+    static_assert(N >= 2, "chebyshev_lobatto_coefficients() - Number of points must be at least two.");
+    constexpr size_t n = N - 1;
+
+    // cos(pi j k / n) only depends on j k mod 2n, so tabulate the 2n distinct values once
+    std::array<double, 2 * n> cosines{};
+    for (size_t m = 0; m < 2 * n; m++) {
+        cosines[m] = std::cos(std::numbers::pi * static_cast<double>(m) / static_cast<double>(n));
+    }
+
+    for (size_t k = 0; k < N; k++) {
+        double sum = 0.;
+        for (size_t j = 0; j < N; j++) {
+            double term = values[j] * cosines[(j * k) % (2 * n)];
+            sum += (j == 0 || j == n) ? 0.5 * term : term;
+        }
+
+        // The first and last coefficients carry a factor of 1/2, which folds c_0 into the CSpice convention
+        coeff[k] = (k == 0 || k == n ? 1. : 2.) * sum / static_cast<double>(n);
+    }
+}
+
+namespace detail {
+
+/*!
+ * \brief Refine a root of f bracketed by [a, b], where fa = f(a) and fb = f(b) differ in sign, with the Illinois variant of
+ * regula falsi
+ *
+ * \details Zero counts as positive. Returns the end of the final bracket with the smaller |f|, once the bracket is no
+ * wider than tol.
+ */
+template<typename Function>
+double refine_bracketed_root(const Function& f, double a, double b, double fa, double fb, double tol) {
+    int side = 0;
+    for (int iter = 0; iter < 100 && b - a > tol; iter++) {
+        double c = (a * fb - b * fa) / (fb - fa);
+        if (!(c > a && c < b)) {
+            c = 0.5 * (a + b);
+        }
+
+        double fc = f(c);
+        if ((fc >= 0.) == (fb >= 0.)) {
+            b  = c;
+            fb = fc;
+            if (side == -1) {
+                fa *= 0.5;
+            }
+            side = -1;
+        } else {
+            a  = c;
+            fa = fc;
+            if (side == 1) {
+                fb *= 0.5;
+            }
+            side = 1;
+        }
+    }
+    return std::abs(fa) < std::abs(fb) ? a : b;
+}
+
+/*!
+ * \brief Refine a root of the Chebyshev polynomial bracketed by [a, b], where fa and fb differ in sign
+ */
+template<size_t N>
+double refine_chebyshev_root(const double* coeff, double a, double b, double fa, double fb, double tol) {
+    return refine_bracketed_root([coeff](double y) { return chebyshev_eval_normalized<N>(y, coeff); }, a, b, fa, fb, tol);
+}
+
+/*!
+ * \brief Recursively isolate the sign changes on [a, b], appending them to roots in increasing order
+ */
+template<size_t N>
+void isolate_chebyshev_roots(const double* coeff, double bound, double a, double b, double fa, double fb, double tol,
+                             std::vector<double>& roots) {
+    // Zero counts as positive, so a root exactly on an endpoint is reported once, by the interval it is approached from
+    if ((fa >= 0.) != (fb >= 0.)) {
+        roots.push_back(refine_chebyshev_root<N>(coeff, a, b, fa, fb, tol));
+        return;
+    }
+
+    // With |f'| <= bound, a root at x needs |fa| <= bound (x - a) and |fb| <= bound (b - x), so |fa| + |fb| <= bound (b - a)
+    if (std::abs(fa) + std::abs(fb) > bound * (b - a) || b - a <= tol) {
+        return;
+    }
+
+    double mid  = 0.5 * (a + b);
+    double fmid = chebyshev_eval_normalized<N>(mid, coeff);
+    isolate_chebyshev_roots<N>(coeff, bound, a, mid, fa, fmid, tol, roots);
+    isolate_chebyshev_roots<N>(coeff, bound, mid, b, fmid, fb, tol, roots);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Find the values of y in [-1, 1] at which the Chebyshev polynomial changes sign
+ *
+ * \details Sign changes are bracketed on a uniform grid of N - 1 intervals. An interval without a sign change is discarded
+ * if the bound |f'| <= sum |c'_k| (from the coefficients of the derivative) rules out a root, and split otherwise, so
+ * pairs of close roots are not missed. Each bracket is then refined on the polynomial. Roots of even multiplicity, where
+ * the polynomial touches zero without changing sign, are not reported. Zero is treated as positive, so when the polynomials
+ * of adjacent intervals meet at a root, the root is reported by the interval on whose side the polynomial is negative.
+ *
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ * \param tol Width in y to which the brackets are refined
+ *
+ * \return Values of y at the sign changes, in increasing order
+ *
+ * \tparam N Number of coefficients, which must be at least two
+ */
+template<size_t N>
+std::vector<double> chebyshev_sign_changes(const std::array<double, N>& coeff, double tol = 1e-14) {
+    static_assert(N >= 2, "chebyshev_sign_changes() - Number of coefficients must be at least two.");
+
+    std::array<double, N - 1> derivative{};
+    chebyshev_derivative_coefficients(coeff.data(), N, -1., 1., 1., derivative.data());
+
+    double bound = 0.;
+    for (double val : derivative) {
+        bound += std::abs(val);
+    }
+
+    std::vector<double> roots;
+    double a  = -1.;
+    double fa = chebyshev_eval_normalized<N>(a, coeff.data());
+    for (size_t k = 1; k < N; k++) {
+        double b  = -1. + 2. * static_cast<double>(k) / static_cast<double>(N - 1);
+        double fb = chebyshev_eval_normalized<N>(b, coeff.data());
+        detail::isolate_chebyshev_roots<N>(coeff.data(), bound, a, b, fa, fb, tol, roots);
+        a  = b;
+        fa = fb;
+    }
+    return roots;
+}
+
+/*!
+ * \brief Find the values of y in [-1, 1] at which the Chebyshev polynomial changes sign, given its values at the
+ * Chebyshev-Lobatto points
+ *
+ * \details Same as chebyshev_sign_changes(), except that the sign changes are bracketed on the N - 1 intervals between the
+ * Chebyshev-Lobatto points instead of a uniform grid. The values at those points are usually at hand from the
+ * interpolation (see chebyshev_lobatto_coefficients), so the polynomial is only evaluated to split and refine brackets.
+ *
+ * \param values Values of the polynomial at chebyshev_lobatto_point<N>(0), ..., chebyshev_lobatto_point<N>(N - 1)
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ * \param tol Width in y to which the brackets are refined
+ *
+ * \return Values of y at the sign changes, in increasing order
+ *
+ * \tparam N Number of coefficients, which must be at least two
+ */
+template<size_t N>
+std::vector<double> chebyshev_lobatto_sign_changes(const std::array<double, N>& values, const std::array<double, N>& coeff,
+                                                   double tol = 1e-14) {
+    static_assert(N >= 2, "chebyshev_lobatto_sign_changes() - Number of coefficients must be at least two.");
+
+    std::array<double, N - 1> derivative{};
+    chebyshev_derivative_coefficients(coeff.data(), N, -1., 1., 1., derivative.data());
+
+    double bound = 0.;
+    for (double val : derivative) {
+        bound += std::abs(val);
+    }
+
+    // The points run from y = 1 down to y = -1, so walk them backwards to report the roots in increasing order
+    std::vector<double> roots;
+    double a  = -1.;
+    double fa = values[N - 1];
+    for (size_t k = N - 1; k-- > 0;) {
+        double b  = chebyshev_lobatto_point<N>(k);
+        double fb = values[k];
+        detail::isolate_chebyshev_roots<N>(coeff.data(), bound, a, b, fa, fb, tol, roots);
+        a  = b;
+        fa = fb;
+    }
+    return roots;
+}
+
+/*!
+ * \brief Find the values of y in [-1, 1] at which the Chebyshev polynomial changes sign, given the sign changes of its
+ * derivative
+ *
+ * \details The polynomial is monotonic between consecutive sign changes of its derivative (e.g. from
+ * chebyshev_sign_changes applied to the coefficients of the derivative), so each of those pieces holds at most one sign
+ * change, bracketed by the values at its ends, and no derivative bound or splitting is needed. Zero is treated as positive,
+ * as in chebyshev_sign_changes().
+ *
+ * \param coeff Chebyshev coefficients c_0..c_{N-1}
+ * \param extrema Values of y at which the derivative changes sign, in increasing order
+ * \param tol Width in y to which the brackets are refined
+ *
+ * \return Values of y at the sign changes, in increasing order
+ *
+ * \tparam N Number of coefficients, which must be at least two
+ */
+template<size_t N>
+std::vector<double> chebyshev_monotone_sign_changes(const std::array<double, N>& coeff, const std::vector<double>& extrema,
+                                                    double tol = 1e-14) {
+    static_assert(N >= 2, "chebyshev_monotone_sign_changes() - Number of coefficients must be at least two.");
+
+    std::vector<double> roots;
+    double a  = -1.;
+    double fa = chebyshev_eval_normalized<N>(a, coeff.data());
+    for (size_t k = 0; k <= extrema.size(); k++) {
+        double b  = k < extrema.size() ? extrema[k] : 1.;
+        double fb = chebyshev_eval_normalized<N>(b, coeff.data());
+        if ((fa >= 0.) != (fb >= 0.)) {
+            roots.push_back(detail::refine_chebyshev_root<N>(coeff.data(), a, b, fa, fb, tol));
+        }
+        a  = b;
+        fa = fb;
+    }
+    return roots;
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -12,4 +12,32 @@ double transform_to_chebyshev_range(double x, double lb, double ub) {
     return (x - 0.5 * (ub + lb)) / (0.5 * (ub - lb));
 }
 
+//--------------------------------------------------------------------------------------------------------------------------
+
+void chebyshev_derivative_coefficients(const double* coeff, size_t n, double lb, double ub, double scale,
+                                       double* derivative_coeff) {
+    if (n < 2) {
+        return;
+    }
+
+    // Apply the recurrence b_{k-1} = b_{k+1} + 2 k c_k in reverse, with b_{n-1} = b_n = 0
+    double b_next = 0.;  // b_{k+1}
+    double b_cur  = 0.;  // b_k
+    for (size_t k = n - 1; k >= 1; k--) {
+        double b_prev           = b_next + 2. * static_cast<double>(k) * coeff[k];
+        derivative_coeff[k - 1] = b_prev;
+        b_next                  = b_cur;
+        b_cur                   = b_prev;
+    }
+
+    // The recurrence produces b_0 for the Numerical Recipes convention, so halve it for the CSpice convention
+    derivative_coeff[0] *= 0.5;
+
+    // Normalize to the interval ub - lb, and apply the additional scale factor
+    double factor = scale * 2. / (ub - lb);
+    for (size_t k = 0; k + 1 < n; k++) {
+        derivative_coeff[k] *= factor;
+    }
+}
+
 }  // End namespace jpl_ephemeris
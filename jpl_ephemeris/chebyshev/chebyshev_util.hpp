@@ -6,6 +6,9 @@
  * \brief Utility functions for Chebyshev interpolation
  */
 
+// Standard Library Includes
+#include <cstddef>
+
 namespace jpl_ephemeris {
 
 /*!
@@ -34,6 +37,23 @@ double transform_from_chebyshev_range(double x, double lb, double ub);
  */
 double transform_to_chebyshev_range(double x, double lb, double ub);
 
+/*!
+ * \brief Compute the Chebyshev coefficients of the derivative of a Chebyshev polynomial with respect to x
+ *
+ * \note Both the input and output coefficients use the CSpice convention, where coeff[0] is applied with a factor of 1.0
+ *
+ * \reference Numerical Recipes in Fortran 77: The Art of Scientific Computing, Page 189, Routine chder
+ *
+ * \param coeff Chebyshev coefficients of the polynomial
+ * \param n Number of coefficients in coeff, which must be at least one
+ * \param lb Lower bound of the function range
+ * \param ub Upper bound of the function range
+ * \param scale Additional factor applied to every derivative coefficient, e.g. to convert units
+ * \param derivative_coeff Output array of n - 1 Chebyshev coefficients of the derivative (nothing is written for n = 1)
+ */
+void chebyshev_derivative_coefficients(const double* coeff, size_t n, double lb, double ub, double scale,
+                                       double* derivative_coeff);
+
 }  // End namespace jpl_ephemeris
 
 #endif
@@ -0,0 +1,103 @@
+#ifndef JPL_EPHEMERIS_CHEBYSHEV_FORWARD_DIFFERENCE_HPP
+#define JPL_EPHEMERIS_CHEBYSHEV_FORWARD_DIFFERENCE_HPP
+
+/*!
+ * \file jpl_ephemeris/chebyshev/forward_difference.hpp
+ * \brief Functions to evaluate a Chebyshev polynomial at evenly spaced points by updating a table of forward differences
+ *
+ * \details A polynomial of degree N - 1 sampled with a constant step has a constant (N - 1)-th forward difference, so
+ * once the table [p(y_0), Delta p(y_0), ..., Delta^{N-1} p(y_0)] is known, each further sample costs N - 1 additions and
+ * no multiplications. The table is built from the Taylor expansion about y_0, rather than by differencing samples, so
+ * each difference is accurate relative to its own (small) magnitude, and the rounding error accumulated over a granule
+ * stays bounded instead of growing with a power of the number of steps.
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Build the forward difference table of a Chebyshev polynomial for evenly spaced points y_0 + i h
+ *
+ * \details With the Taylor coefficients b_j = p^{(j)}(y_0) h^j / j! of q(s) = p(y_0 + s h), the differences are
+ * Delta^k q(0) = sum_{j >= k} b_j k! S(j, k), where S(j, k) are the Stirling numbers of the second kind.
+ *
+ * \param coeff Chebyshev coefficients c_0..c_{N-1} on [-1, 1], where c_0 is applied with a factor of 1.0 (CSpice
+ *     convention)
+ * \param y0 First point, in the Chebyshev range [-1, 1]
+ * \param h Step between points, in the Chebyshev variable
+ * \param diff Output forward difference table, diff[k] = Delta^k p(y0) for k = 0..N-1
+ *
+ * \tparam N Number of coefficients, which must be at least one
+ */
+template<size_t N>
+void chebyshev_forward_differences(const double* coeff, double y0, double h, double* diff) {
+    static_assert(N >= 1, "chebyshev_forward_differences() - Number of coefficients must be greater than zero.");
+
+    // Taylor coefficients b_j, from the value of each successive derivative series at y0
+    std::array<long double, N> taylor{};
+    std::array<double, N> cur{};
+    std::array<double, N> next{};
+    for (size_t k = 0; k < N; k++) {
+        cur[k] = coeff[k];
+    }
+
+    long double h_pow_over_fact = 1.L;
+    for (size_t j = 0; j < N; j++) {
+        size_t n = N - j;
+
+        // Clenshaw's recurrence on the j-th derivative series
+        double y2 = 2. * y0;
+        double d = 0., dd = 0., sv = 0.;
+        for (size_t k = n - 1; k >= 1; k--) {
+            sv = d;
+            d  = y2 * d - dd + cur[k];
+            dd = sv;
+        }
+        taylor[j] = static_cast<long double>(y0 * d - dd + cur[0]) * h_pow_over_fact;
+
+        h_pow_over_fact *= static_cast<long double>(h) / static_cast<long double>(j + 1);
+        chebyshev_derivative_coefficients(cur.data(), n, -1., 1., 1., next.data());
+        cur = next;
+    }
+
+    // Stirling numbers of the second kind, scaled by k!, using k! S(j, k) = k (k-1)! S(j-1, k-1) + k * k! S(j-1, k)
+    std::array<std::array<long double, N>, N> stirling{};
+    stirling[0][0] = 1.L;
+    for (size_t j = 1; j < N; j++) {
+        for (size_t k = 1; k <= j; k++) {
+            stirling[j][k] = static_cast<long double>(k) * (stirling[j - 1][k - 1] + stirling[j - 1][k]);
+        }
+    }
+
+    for (size_t k = 0; k < N; k++) {
+        long double sum = 0.L;
+        for (size_t j = k; j < N; j++) {
+            sum += taylor[j] * stirling[j][k];
+        }
+        diff[k] = static_cast<double>(sum);
+    }
+}
+
+/*!
+ * \brief Advance a forward difference table by one step
+ *
+ * \param diff Forward difference table, diff[0] is the value at the current point
+ *
+ * \tparam N Number of entries in the table
+ */
+template<size_t N>
+inline void forward_difference_step(double* diff) {
+    for (size_t k = 0; k + 1 < N; k++) {
+        diff[k] += diff[k + 1];
+    }
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif
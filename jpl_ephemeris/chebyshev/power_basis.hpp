@@ -0,0 +1,97 @@
+#ifndef JPL_EPHEMERIS_CHEBYSHEV_POWER_BASIS_HPP
+#define JPL_EPHEMERIS_CHEBYSHEV_POWER_BASIS_HPP
+
+/*!
+ * \file jpl_ephemeris/chebyshev/power_basis.hpp
+ * \brief Functions to convert a Chebyshev series into the power (monomial) basis on [-1, 1], and to evaluate a power
+ * series using Estrin's scheme.
+ *
+ * \details Clenshaw's recurrence is a single serial dependency chain, with one multiply-add of latency per coefficient.
+ * Estrin's scheme evaluates the same polynomial as a balanced tree, so the multiply-adds at each level are independent and
+ * the latency grows with log2 of the number of coefficients. The conversion to the power basis loses some accuracy, which
+ * must be measured before a table is evaluated this way.
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Convert the Chebyshev series sum_k c_k T_k(y) into the power series sum_k a_k y^k
+ *
+ * \details The monomial coefficients of T_k are generated with T_{k+1} = 2y T_k - T_{k-1}, accumulating in long double to
+ * limit the cancellation between the alternating terms.
+ *
+ * \param cheb Chebyshev coefficients c_0..c_{n-1}, where c_0 is applied with a factor of 1.0 (CSpice convention)
+ * \param n Number of coefficients
+ * \param power Output power series coefficients a_0..a_{n-1}
+ *
+ * \tparam N Maximum number of coefficients supported
+ */
+template<size_t N>
+void chebyshev_to_power_basis(const double* cheb, size_t n, double* power) {
+    std::array<long double, N> t_prev{}, t_cur{}, t_next{}, acc{};
+
+    // T_0 = 1, T_1 = y
+    t_prev[0] = 1.L;
+    t_cur[1]  = 1.L;
+
+    for (size_t k = 0; k < n; k++) {
+        const std::array<long double, N>& t_k = k == 0 ? t_prev : t_cur;
+        for (size_t j = 0; j <= k; j++) {
+            acc[j] += static_cast<long double>(cheb[k]) * t_k[j];
+        }
+
+        // Advance the recurrence once T_1 has been used
+        if (k >= 1) {
+            t_next.fill(0.L);
+            for (size_t j = 0; j + 1 < N; j++) {
+                t_next[j + 1] += 2.L * t_cur[j];
+            }
+            for (size_t j = 0; j < N; j++) {
+                t_next[j] -= t_prev[j];
+            }
+            t_prev = t_cur;
+            t_cur  = t_next;
+        }
+    }
+
+    for (size_t j = 0; j < n; j++) {
+        power[j] = static_cast<double>(acc[j]);
+    }
+}
+
+/*!
+ * \brief Evaluate the power series sum_k a_k y^k using Estrin's scheme
+ *
+ * \param y Value at which the power series is evaluated
+ * \param a Power series coefficients a_0..a_{N-1}
+ *
+ * \return Value of the power series
+ *
+ * \tparam N Number of coefficients
+ */
+template<size_t N>
+inline double estrin_eval(double y, const double* a) {
+    if constexpr (N == 0) {
+        return 0.;
+    } else if constexpr (N == 1) {
+        return a[0];
+    } else {
+        // Combine neighbouring coefficients, which halves the degree in terms of y^2
+        std::array<double, (N + 1) / 2> pairs;
+        for (size_t k = 0; k < N / 2; k++) {
+            pairs[k] = a[2 * k] + y * a[2 * k + 1];
+        }
+        if constexpr (N % 2 == 1) {
+            pairs[N / 2] = a[N - 1];
+        }
+        return estrin_eval<(N + 1) / 2>(y * y, pairs.data());
+    }
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif
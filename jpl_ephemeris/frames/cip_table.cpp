@@ -0,0 +1,212 @@
+#include "cip_table.hpp"
+
+// Standard Library Includes
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/chebyshev/chebyshev_roots.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of radians per arcsecond
+constexpr double RAD_PER_ARCSEC = std::numbers::pi / (180.0 * 3600.0);
+
+//! Number of Chebyshev coefficients per row of the table
+constexpr size_t NUM_COEFF = CIPTable::ROW_SIZE - 2;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the rotation of the frame about the y axis by angle [rad]
+RotationMatrix rotation_y(double angle) {
+    const double c = std::cos(angle), s = std::sin(angle);
+    return RotationMatrix{{{c, 0., -s}, {0., 1., 0.}, {s, 0., c}}};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the rotation of the frame about the z axis by angle [rad]
+RotationMatrix rotation_z(double angle) {
+    const double c = std::cos(angle), s = std::sin(angle);
+    return RotationMatrix{{{c, s, 0.}, {-s, c, 0.}, {0., 0., 1.}}};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the IAU 1976 precession matrix, from the mean equator and equinox of J2000 to those of date
+RotationMatrix get_precession_matrix(double mjdj2k_tdb) {
+    const double T     = mjdj2k_tdb / 36525.0;
+    const double zeta  = T * (2306.2181 + T * (0.30188 + T * 0.017998)) * RAD_PER_ARCSEC;
+    const double z     = T * (2306.2181 + T * (1.09468 + T * 0.018203)) * RAD_PER_ARCSEC;
+    const double theta = T * (2004.3109 + T * (-0.42665 - T * 0.041833)) * RAD_PER_ARCSEC;
+    return multiply(rotation_z(-z), multiply(rotation_y(theta), rotation_z(-zeta)));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return s + XY/2 [rad] from the IAU 2006 series, keeping the terms above 10 uas over the span of the DE files
+double get_s_plus_half_xy(double mjdj2k_tdb) {
+    const double T = mjdj2k_tdb / 36525.0;
+
+    // Fundamental arguments of the Moon (IERS Conventions 2003)
+    const double F     = std::fmod(335779.526232 + 1739527262.8478 * T, 1296000.0) * RAD_PER_ARCSEC;
+    const double D     = std::fmod(1072260.703692 + 1602961601.2090 * T, 1296000.0) * RAD_PER_ARCSEC;
+    const double omega = std::fmod(450160.398036 - 6962890.5431 * T, 1296000.0) * RAD_PER_ARCSEC;
+
+    const double poly = 94.0 + T * (3808.65 + T * (-122.68 + T * (-72574.11 + T * (27.98 + T * 15.62))));
+    const double periodic = -2640.73 * std::sin(omega) - 63.53 * std::sin(2. * omega)
+                            - 11.75 * std::sin(2. * F - 2. * D + 3. * omega) - 11.21 * std::sin(2. * F - 2. * D + omega)
+                            + T * T * (743.52 * std::sin(omega) + 56.91 * std::sin(2. * F - 2. * D + 2. * omega));
+    return (poly + periodic) * 1e-6 * RAD_PER_ARCSEC;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the view of rows of X, Y, s
+EphemerisTableView make_view(const std::array<std::vector<double>, 3>& rows) {
+    EphemerisTableView view;
+    for (unsigned int comp = 0; comp < 3; comp++) {
+        view.interp[comp] = rows[comp].data();
+    }
+    view.row_size      = static_cast<unsigned int>(CIPTable::ROW_SIZE);
+    view.num_granules  = static_cast<unsigned int>(rows[0].size() / CIPTable::ROW_SIZE);
+    view.start_mjdj2k  = rows[0][0];
+    view.stop_mjdj2k   = rows[0][rows[0].size() - CIPTable::ROW_SIZE + 1];
+    view.days_per_poly = CIPTable::DAYS_PER_POLY;
+    return view;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+CIPTable::CIPTable(std::array<std::vector<double>, 3> rows) :
+    rows_(std::move(rows)), view_(make_view(rows_)), cache_(view_),
+    registration_(TableLayout{"cip_xys", TableStorage::Heap, view_, 3}) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+CIPTable CIPTable::fit(Nutation& nutation) {
+    const double start        = nutation.get_start_mjdj2k();
+    const size_t num_granules = static_cast<size_t>(std::floor((nutation.get_stop_mjdj2k() - start) / DAYS_PER_POLY));
+    if (num_granules == 0) {
+        throw std::invalid_argument("CIPTable::fit() - The nutations cover less than one granule.");
+    }
+
+    std::array<std::vector<double>, 3> rows;
+    for (std::vector<double>& comp_rows : rows) {
+        comp_rows.reserve(num_granules * ROW_SIZE);
+    }
+
+    for (size_t k = 0; k < num_granules; k++) {
+        const double lb = start + DAYS_PER_POLY * static_cast<double>(k);
+        const double ub = lb + DAYS_PER_POLY;
+
+        std::array<std::array<double, NUM_COEFF>, 3> values{};
+        for (size_t j = 0; j < NUM_COEFF; j++) {
+            const double t                 = transform_from_chebyshev_range(chebyshev_lobatto_point<NUM_COEFF>(j), lb, ub);
+            const std::array<double, 3> xys = compute_xys(nutation, t);
+            for (unsigned int comp = 0; comp < 3; comp++) {
+                values[comp][j] = xys[comp];
+            }
+        }
+
+        for (unsigned int comp = 0; comp < 3; comp++) {
+            std::array<double, NUM_COEFF> coeff{};
+            chebyshev_lobatto_coefficients<NUM_COEFF>(values[comp], coeff);
+
+            rows[comp].push_back(lb);
+            rows[comp].push_back(ub);
+            rows[comp].insert(rows[comp].end(), coeff.begin(), coeff.end());
+        }
+    }
+    return CIPTable(std::move(rows));
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 3> CIPTable::get_xys(double mjdj2k_tdb) {
+    return cache_.get_position(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void CIPTable::get_xys(const double* mjdj2k_tdb, size_t num_epochs, double* xys) {
+    for (size_t i = 0; i < num_epochs; i++) {
+        const std::array<double, 3> val = cache_.get_position(mjdj2k_tdb[i]);
+        xys[3 * i]                      = val[0];
+        xys[3 * i + 1]                  = val[1];
+        xys[3 * i + 2]                  = val[2];
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const EphemerisTableView& CIPTable::get_view() const {
+    return view_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double CIPTable::get_start_mjdj2k() const {
+    return view_.start_mjdj2k;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double CIPTable::get_stop_mjdj2k() const {
+    return view_.stop_mjdj2k;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> CIPTable::compute_xys(Nutation& nutation, double mjdj2k_tdb) {
+    // The CIP is the pole of the true equator of date, i.e. the third row of N * P
+    const RotationMatrix np = multiply(nutation.get_nutation_matrix(mjdj2k_tdb), get_precession_matrix(mjdj2k_tdb));
+
+    const double x = np[2][0];
+    const double y = np[2][1];
+    return std::array<double, 3>{x, y, get_s_plus_half_xy(mjdj2k_tdb) - 0.5 * x * y};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix CIPTable::get_rotation_to_cirs(double x, double y, double s) {
+    // a = 1 / (1 + Z), with Z = sqrt(1 - X^2 - Y^2); X^2 + Y^2 stays below 1e-3 for three centuries around J2000, where
+    // the series to (X^2 + Y^2)^3 is exact to double precision in a * X^2
+    const double r2 = x * x + y * y;
+    const double a  = r2 < 1e-3 ? 0.5 + r2 * (0.125 + r2 * (0.0625 + r2 * 0.0390625)) : 1. / (1. + std::sqrt(1. - r2));
+
+    // Q^T = R3(-s) * [[1 - aX^2, -aXY, -X], [-aXY, 1 - aY^2, -Y], [X, Y, 1 - a(X^2 + Y^2)]]
+    const double axy = a * x * y;
+    const RotationMatrix q{{{1. - a * x * x, -axy, -x}, {-axy, 1. - a * y * y, -y}, {x, y, 1. - a * r2}}};
+
+    // s stays below 1e-6 rad over centuries, where the truncated series are exact to double precision
+    double cs = 0., ss = 0.;
+    if (std::abs(s) < 1e-6) {
+        cs = 1. - 0.5 * s * s;
+        ss = s;
+    } else {
+        cs = std::cos(s);
+        ss = std::sin(s);
+    }
+
+    RotationMatrix rot{};
+    for (unsigned int j = 0; j < 3; j++) {
+        rot[0][j] = cs * q[0][j] - ss * q[1][j];
+        rot[1][j] = ss * q[0][j] + cs * q[1][j];
+        rot[2][j] = q[2][j];
+    }
+    return rot;
+}
+
+}  // End namespace jpl_ephemeris
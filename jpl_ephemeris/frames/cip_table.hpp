@@ -0,0 +1,158 @@
+#ifndef JPL_EPHEMERIS_FRAMES_CIP_TABLE_HPP
+#define JPL_EPHEMERIS_FRAMES_CIP_TABLE_HPP
+
+/*!
+ * \file jpl_ephemeris/frames/cip_table.hpp
+ * \brief Defines a table of Chebyshev polynomials for the coordinates X, Y of the Celestial Intermediate Pole and the CIO
+ * locator s
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+#include "jpl_ephemeris/frames/nutation.hpp"
+#include "jpl_ephemeris/memory/footprint.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Defines a table of Chebyshev polynomials for the coordinates X, Y of the Celestial Intermediate Pole (CIP) and
+ * the CIO locator s
+ *
+ * \details fit() evaluates the precession-nutation model at the Chebyshev-Lobatto nodes of each granule and stores
+ * X, Y, s [rad] as three components of [lb, ub, c_0, ...] rows, so the table is evaluated through a GranuleCache like the
+ * position tables. The model is the IAU 1976 precession with the DE nutations (the IAU 1980 theory, see Nutation), and s
+ * from the IAU 2006 series truncated at 10 uas. The fit reproduces the model to a few uas.
+ *
+ * On its own, the model is off from the observed pole by up to about 0.1 arcsec, from the error of IAU 1976/1980 and the
+ * frame bias. The IERS celestial pole offsets dpsi, deps of the IAU 1980 EOP files measure exactly this difference, and
+ * ItrfRotation applies them at runtime (X += dpsi sin(eps), Y += deps), which brings the pole to the ~0.1 mas level of the
+ * IERS products. They are kept out of the table because they are tabulated daily, and do not fit smooth polynomials.
+ *
+ * Every query updates the cache, so each thread needs its own instance.
+ */
+class CIPTable {
+    public:
+
+        //! Number of values per row of the table, including the lb and ub values
+        static constexpr size_t ROW_SIZE = 14;
+
+        //! Number of days covered by each granule
+        static constexpr double DAYS_PER_POLY = 8.0;
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        CIPTable(const CIPTable&) = delete;
+
+        CIPTable& operator=(const CIPTable&) = delete;
+
+        CIPTable(CIPTable&&) = default;
+
+        CIPTable& operator=(CIPTable&&) = default;
+
+        /*!
+         * \brief Fit the table over the range covered by the nutations
+         *
+         * \param nutation Nutations of the DE ephemeris
+         *
+         * \return Table of whole granules from the start of the nutations
+         *
+         * \throws std::invalid_argument If the nutations cover less than one granule
+         */
+        static CIPTable fit(Nutation& nutation);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the coordinates of the CIP and the CIO locator
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return X, Y, s [rad]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 3> get_xys(double mjdj2k_tdb);
+
+        /*!
+         * \brief Evaluate the coordinates of the CIP and the CIO locator at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param xys Output X, Y, s [rad], 3 per epoch
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_xys(const double* mjdj2k_tdb, size_t num_epochs, double* xys);
+
+        //! Return the view of the table
+        const EphemerisTableView& get_view() const;
+
+        //! Return the first epoch covered by the table, in the TDB Time System
+        double get_start_mjdj2k() const;
+
+        //! Return the last epoch covered by the table, in the TDB Time System
+        double get_stop_mjdj2k() const;
+
+        /*!
+         * \brief Evaluate the model that the table is fitted to, without the table
+         *
+         * \param nutation Nutations of the DE ephemeris
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return X, Y, s [rad]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the nutations
+         */
+        static std::array<double, 3> compute_xys(Nutation& nutation, double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the rotation from the GCRF frame to the Celestial Intermediate Reference System (CIRS)
+         *
+         * \param x X coordinate of the CIP [rad]
+         * \param y Y coordinate of the CIP [rad]
+         * \param s CIO locator [rad]
+         *
+         * \return Rotation matrix, such that r_cirs = R * r_gcrf (IERS Conventions 2010, Eq. 5.10)
+         */
+        static RotationMatrix get_rotation_to_cirs(double x, double y, double s);
+
+    private:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create a table that owns the specified rows of X, Y, s
+        explicit CIPTable(std::array<std::vector<double>, 3> rows);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Rows of [lb, ub, c_0, ...] for each of X, Y, s
+        std::array<std::vector<double>, 3> rows_;
+
+        //! View of rows_
+        EphemerisTableView view_;
+
+        //! Cache of the last granule of the table
+        GranuleCache<ROW_SIZE> cache_;
+
+        //! Registration of rows_ with get_memory_footprint()
+        TableRegistration registration_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
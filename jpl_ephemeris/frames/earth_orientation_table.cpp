@@ -0,0 +1,153 @@
+#include "earth_orientation_table.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of radians per arcsecond
+constexpr double RAD_PER_ARCSEC = std::numbers::pi / (180.0 * 3600.0);
+
+//! Modified Julian Date of the J2000 Epoch
+constexpr double MJD_J2000 = 51544.5;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+/*!
+ * \brief Parse the fixed-width field that starts at the specified column (1 based) of a line
+ *
+ * \return True if the field holds a value
+ */
+bool parse_field(const std::string& line, size_t first_column, size_t last_column, double& value) {
+    if (line.size() < last_column) {
+        return false;
+    }
+
+    const std::string field = line.substr(first_column - 1, last_column - first_column + 1);
+    if (field.find_first_not_of(' ') == std::string::npos) {
+        return false;
+    }
+
+    value = std::strtod(field.c_str(), nullptr);
+    return true;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+EarthOrientationTable::EarthOrientationTable(std::vector<EarthOrientationRecord> records) : records_(std::move(records)) {
+    for (size_t i = 1; i < records_.size(); i++) {
+        if (!(records_[i].mjdj2k_utc > records_[i - 1].mjdj2k_utc)) {
+            throw std::invalid_argument("EarthOrientationTable() - The records must be in increasing order of time.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EarthOrientationTable EarthOrientationTable::from_iers_finals(const std::string& file_name) {
+    std::ifstream file(file_name);
+    if (!file) {
+        throw std::invalid_argument("EarthOrientationTable::from_iers_finals() - Unable to open " + file_name);
+    }
+
+    // Columns of readme.finals: MJD 8-15, x 19-27 ["], y 38-46 ["], UT1 - UTC 59-68 [s], dpsi 98-106 [mas],
+    // deps 117-125 [mas]
+    std::vector<EarthOrientationRecord> records;
+    double dpsi = 0., deps = 0.;
+    std::string line;
+    while (std::getline(file, line)) {
+        double mjd = 0., x_pole = 0., y_pole = 0., ut1_minus_utc = 0.;
+        if (!parse_field(line, 8, 15, mjd) || !parse_field(line, 19, 27, x_pole) || !parse_field(line, 38, 46, y_pole)
+            || !parse_field(line, 59, 68, ut1_minus_utc)) {
+            break;
+        }
+
+        double val = 0.;
+        if (parse_field(line, 98, 106, val)) {
+            dpsi = val * 1e-3 * RAD_PER_ARCSEC;
+        }
+        if (parse_field(line, 117, 125, val)) {
+            deps = val * 1e-3 * RAD_PER_ARCSEC;
+        }
+
+        records.push_back(EarthOrientationRecord{mjd - MJD_J2000, x_pole * RAD_PER_ARCSEC, y_pole * RAD_PER_ARCSEC,
+                                                 ut1_minus_utc, dpsi, deps});
+    }
+
+    if (records.empty()) {
+        throw std::invalid_argument("EarthOrientationTable::from_iers_finals() - No records were found in " + file_name);
+    }
+    return EarthOrientationTable(std::move(records));
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+EarthOrientationRecord EarthOrientationTable::get(double mjdj2k_utc) const {
+    size_t index = 0;
+    return get(mjdj2k_utc, index);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EarthOrientationRecord EarthOrientationTable::get(double mjdj2k_utc, size_t& index) const {
+    if (records_.empty()) {
+        return EarthOrientationRecord{mjdj2k_utc, 0., 0., 0., 0., 0.};
+    }
+
+    if (!(mjdj2k_utc >= records_.front().mjdj2k_utc && mjdj2k_utc <= records_.back().mjdj2k_utc)) {
+        throw std::out_of_range("EarthOrientationTable::get() - Value provided for mjdj2k_utc is outside of the range of "
+                                "the records.");
+    }
+
+    if (records_.size() == 1) {
+        return records_.front();
+    }
+
+    if (!(index + 1 < records_.size() && mjdj2k_utc >= records_[index].mjdj2k_utc
+          && mjdj2k_utc <= records_[index + 1].mjdj2k_utc)) {
+        auto it = std::upper_bound(records_.begin(), records_.end(), mjdj2k_utc,
+                                   [](double t, const EarthOrientationRecord& rec) { return t < rec.mjdj2k_utc; });
+        index = static_cast<size_t>(std::min(it, records_.end() - 1) - records_.begin()) - 1;
+    }
+    const EarthOrientationRecord& a = records_[index];
+    const EarthOrientationRecord& b = records_[index + 1];
+
+    // Remove the leap second, if any, between the two records
+    const double ut1_b = b.ut1_minus_utc - std::round(b.ut1_minus_utc - a.ut1_minus_utc);
+
+    const double f = (mjdj2k_utc - a.mjdj2k_utc) / (b.mjdj2k_utc - a.mjdj2k_utc);
+    return EarthOrientationRecord{mjdj2k_utc,
+                                  a.x_pole + f * (b.x_pole - a.x_pole),
+                                  a.y_pole + f * (b.y_pole - a.y_pole),
+                                  a.ut1_minus_utc + f * (ut1_b - a.ut1_minus_utc),
+                                  a.dpsi + f * (b.dpsi - a.dpsi),
+                                  a.deps + f * (b.deps - a.deps)};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool EarthOrientationTable::empty() const {
+    return records_.empty();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const std::vector<EarthOrientationRecord>& EarthOrientationTable::get_records() const {
+    return records_;
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,125 @@
+#ifndef JPL_EPHEMERIS_FRAMES_EARTH_ORIENTATION_TABLE_HPP
+#define JPL_EPHEMERIS_FRAMES_EARTH_ORIENTATION_TABLE_HPP
+
+/*!
+ * \file jpl_ephemeris/frames/earth_orientation_table.hpp
+ * \brief Defines a table of the Earth orientation parameters published by the IERS
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+//! Earth orientation parameters at one epoch
+struct EarthOrientationRecord {
+    //! Modified Julian Date from the J2000 Epoch, in the UTC Time System
+    double mjdj2k_utc = 0.;
+
+    //! x coordinate of the pole [rad]
+    double x_pole = 0.;
+
+    //! y coordinate of the pole [rad]
+    double y_pole = 0.;
+
+    //! UT1 - UTC [s]
+    double ut1_minus_utc = 0.;
+
+    //! Celestial pole offset in longitude, relative to the IAU 1980 nutation theory [rad]
+    double dpsi = 0.;
+
+    //! Celestial pole offset in obliquity, relative to the IAU 1980 nutation theory [rad]
+    double deps = 0.;
+};
+
+/*!
+ * \brief Defines a table of the Earth orientation parameters published by the IERS
+ *
+ * \details Records are interpolated linearly in time, which matches the daily spacing of the IERS products to well below
+ * their own uncertainty. UT1 - UTC jumps by one second at a leap second, so the jump is removed before interpolating
+ * across it. An empty table (the default) returns zero for every parameter, i.e. UT1 = UTC, no polar motion, and no
+ * celestial pole offsets.
+ */
+class EarthOrientationTable {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an empty table, which returns zero for every parameter
+        EarthOrientationTable() = default;
+
+        /*!
+         * \brief Create a table from the specified records
+         *
+         * \param records Records, in increasing order of time
+         *
+         * \throws std::invalid_argument If records are not in increasing order of time
+         */
+        explicit EarthOrientationTable(std::vector<EarthOrientationRecord> records);
+
+        /*!
+         * \brief Read the records of an IERS finals file, in the IAU 1980 version (finals.all, finals.data, or
+         * finals.daily), whose nutation columns are the offsets dpsi, deps
+         *
+         * \details The Bulletin A columns are used. Reading stops at the first record without UT1 - UTC (the end of the
+         * predictions), and records without celestial pole offsets keep the last published values.
+         *
+         * \param file_name Path to the file
+         *
+         * \return Table of the records
+         *
+         * \throws std::invalid_argument If the file cannot be read or has no records
+         */
+        static EarthOrientationTable from_iers_finals(const std::string& file_name);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the parameters interpolated at the specified epoch
+         *
+         * \param mjdj2k_utc Modified Julian Date from the J2000 Epoch, in the UTC Time System
+         *
+         * \return Interpolated parameters
+         *
+         * \throws std::out_of_range If the table is not empty and mjdj2k_utc is outside of the range of the records
+         */
+        EarthOrientationRecord get(double mjdj2k_utc) const;
+
+        /*!
+         * \brief Return the parameters interpolated at the specified epoch, starting the search from the interval of the
+         * previous query, which makes sorted queries constant time
+         *
+         * \param mjdj2k_utc Modified Julian Date from the J2000 Epoch, in the UTC Time System
+         * \param index Interval between records [index, index + 1] tried first, updated to the interval used
+         *
+         * \return Interpolated parameters
+         *
+         * \throws std::out_of_range If the table is not empty and mjdj2k_utc is outside of the range of the records
+         */
+        EarthOrientationRecord get(double mjdj2k_utc, size_t& index) const;
+
+        //! Return true if the table has no records
+        bool empty() const;
+
+        //! Return the records of the table
+        const std::vector<EarthOrientationRecord>& get_records() const;
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Records, in increasing order of time
+        std::vector<EarthOrientationRecord> records_{};
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef JPL_EPHEMERIS_FRAMES_FRAMES_INCLUDES_HPP
+#define JPL_EPHEMERIS_FRAMES_FRAMES_INCLUDES_HPP
+
+/*!
+ * \file jpl_ephemeris/frames/frames_includes.hpp
+ * \brief Include files for the frames directory
+ */
+
+#include "jpl_ephemeris/frames/cip_table.hpp"
+#include "jpl_ephemeris/frames/earth_orientation_table.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+#include "jpl_ephemeris/frames/itrf_rotation.hpp"
+#include "jpl_ephemeris/frames/nutation.hpp"
+
+#endif
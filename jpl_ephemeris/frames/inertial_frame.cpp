@@ -0,0 +1,55 @@
+#include "inertial_frame.hpp"
+
+// Standard Library Includes
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace jpl_ephemeris {
+
+RotationMatrix get_rotation_from_gcrf(InertialFrame frame) {
+    switch (frame) {
+        case InertialFrame::GCRF: {
+            return RotationMatrix{{{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}}};
+        }
+        case InertialFrame::EclipticJ2000: {
+            // IAU 1976 obliquity of the ecliptic at J2000, which is the value used by CSpice for ECLIPJ2000
+            static const double obliquity = 84381.448 / 3600.0 * std::numbers::pi / 180.0;
+            double c = std::cos(obliquity);
+            double s = std::sin(obliquity);
+            return RotationMatrix{{{1., 0., 0.}, {0., c, s}, {0., -s, c}}};
+        }
+        default: {
+            throw std::invalid_argument("get_rotation_from_gcrf() - No predefined rotation exists for the provided "
+                                        "InertialFrame.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 3> rotate(const RotationMatrix& rot, const std::array<double, 3>& vec) {
+    std::array<double, 3> out{0., 0., 0.};
+    for (unsigned int i = 0; i < 3; i++) {
+        for (unsigned int j = 0; j < 3; j++) {
+            out[i] += rot[i][j] * vec[j];
+        }
+    }
+    return out;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix multiply(const RotationMatrix& a, const RotationMatrix& b) {
+    RotationMatrix out{};
+    for (unsigned int i = 0; i < 3; i++) {
+        for (unsigned int j = 0; j < 3; j++) {
+            for (unsigned int k = 0; k < 3; k++) {
+                out[i][j] += a[i][k] * b[k][j];
+            }
+        }
+    }
+    return out;
+}
+
+}  // End namespace jpl_ephemeris
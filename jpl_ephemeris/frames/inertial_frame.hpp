@@ -0,0 +1,57 @@
+#ifndef JPL_EPHEMERIS_FRAMES_INERTIAL_FRAME_HPP
+#define JPL_EPHEMERIS_FRAMES_INERTIAL_FRAME_HPP
+
+/*!
+ * \file jpl_ephemeris/frames/inertial_frame.hpp
+ * \brief Defines the inertial frames that ephemeris tables can be expressed in, and the rotations from GCRF into them
+ */
+
+// Standard Library Includes
+#include <array>
+
+namespace jpl_ephemeris {
+
+//! Row-major 3x3 rotation matrix
+using RotationMatrix = std::array<std::array<double, 3>, 3>;
+
+//! Specifies the inertial frame that the Chebyshev polynomial coefficients of a table are expressed in
+enum class InertialFrame : int {
+    GCRF = 0,           //!< Geocentric Celestial Reference Frame (the frame of the DE tables)
+    EclipticJ2000 = 1,  //!< Mean ecliptic and equinox of J2000 (matches the CSpice ECLIPJ2000 frame)
+    UserDefined = 2,    //!< Constant rotation from GCRF supplied by the user
+};
+
+/*!
+ * \brief Return the constant rotation matrix from GCRF to the specified inertial frame
+ *
+ * \param frame Inertial frame to rotate into
+ *
+ * \return Rotation matrix, R, such that r_frame = R * r_gcrf
+ *
+ * \throws std::invalid_argument If frame is InertialFrame::UserDefined, which has no predefined rotation
+ */
+RotationMatrix get_rotation_from_gcrf(InertialFrame frame);
+
+/*!
+ * \brief Apply a rotation matrix to a vector
+ *
+ * \param rot Rotation matrix
+ * \param vec Vector to rotate
+ *
+ * \return rot * vec
+ */
+std::array<double, 3> rotate(const RotationMatrix& rot, const std::array<double, 3>& vec);
+
+/*!
+ * \brief Multiply two rotation matrices
+ *
+ * \param a Rotation applied second
+ * \param b Rotation applied first
+ *
+ * \return a * b
+ */
+RotationMatrix multiply(const RotationMatrix& a, const RotationMatrix& b);
+
+}  // End namespace jpl_ephemeris
+
+#endif
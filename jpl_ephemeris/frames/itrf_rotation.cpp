@@ -0,0 +1,168 @@
+#include "itrf_rotation.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of seconds per day
+constexpr double SEC_PER_DAY = 86400.0;
+
+//! Number of radians per arcsecond
+constexpr double RAD_PER_ARCSEC = std::numbers::pi / (180.0 * 3600.0);
+
+//! Number of epochs converted from TDB to UTC at a time by the batch methods, sized to stay in the L1 cache
+constexpr size_t UTC_CHUNK_SIZE = 256;
+
+//! Number of turns of the Earth rotation angle per day of UT1, IERS Conventions (2010), Eq. 5.15
+constexpr double ERA_TURNS_PER_DAY = 1.00273781191135448;
+
+//! Sine of the obliquity of the ecliptic at J2000 (84381.406 arcsec)
+const double SIN_OBLIQUITY_J2000 = std::sin(84381.406 * RAD_PER_ARCSEC);
+
+//! Rate of psi_A cos(eps_0) - chi_A, which couples the celestial pole offsets into X and Y [rad/century]
+const double POLE_OFFSET_COUPLING_RATE =
+    (5038.481507 * std::cos(84381.406 * RAD_PER_ARCSEC) - 10.556403) * RAD_PER_ARCSEC;
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+ItrfRotation::ItrfRotation(CIPTable cip, EarthOrientationTable eop, TimeConverter time) :
+    cip_(std::move(cip)), eop_(std::move(eop)), time_(std::move(time)) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+RotationMatrix ItrfRotation::get_rotation_from_gcrf(double mjdj2k_tdb) {
+    return compute_rotation(mjdj2k_tdb, time_.utc_from_tdb(mjdj2k_tdb));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ItrfRotation::get_rotations_from_gcrf(const double* mjdj2k_tdb, size_t num_epochs, RotationMatrix* rotations) {
+    std::array<double, UTC_CHUNK_SIZE> mjdj2k_utc{};
+    for (size_t start = 0; start < num_epochs; start += UTC_CHUNK_SIZE) {
+        const size_t count = std::min(UTC_CHUNK_SIZE, num_epochs - start);
+        time_.utc_from_tdb(mjdj2k_tdb + start, count, mjdj2k_utc.data());
+
+        for (size_t i = 0; i < count; i++) {
+            rotations[start + i] = compute_rotation(mjdj2k_tdb[start + i], mjdj2k_utc[i]);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ItrfRotation::rotate_from_gcrf(const double* mjdj2k_tdb, size_t num_epochs, const double* gcrf, double* itrf) {
+    std::array<double, UTC_CHUNK_SIZE> mjdj2k_utc{};
+    for (size_t start = 0; start < num_epochs; start += UTC_CHUNK_SIZE) {
+        const size_t count = std::min(UTC_CHUNK_SIZE, num_epochs - start);
+        time_.utc_from_tdb(mjdj2k_tdb + start, count, mjdj2k_utc.data());
+
+        for (size_t i = start; i < start + count; i++) {
+            const RotationMatrix rot = compute_rotation(mjdj2k_tdb[i], mjdj2k_utc[i - start]);
+
+            const double x = gcrf[3 * i], y = gcrf[3 * i + 1], z = gcrf[3 * i + 2];
+            for (unsigned int k = 0; k < 3; k++) {
+                itrf[3 * i + k] = rot[k][0] * x + rot[k][1] * y + rot[k][2] * z;
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const EarthOrientationTable& ItrfRotation::get_earth_orientation() const {
+    return eop_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double ItrfRotation::get_earth_rotation_angle(double mjdj2k_ut1) {
+    // IERS Conventions (2010), Eq. 5.15, with the whole days removed first to keep the precision of the fraction
+    const double turns = (mjdj2k_ut1 - std::floor(mjdj2k_ut1)) + 0.7790572732640 + (ERA_TURNS_PER_DAY - 1.) * mjdj2k_ut1;
+    return 2. * std::numbers::pi * (turns - std::floor(turns));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix ItrfRotation::compute_rotation(double mjdj2k_tdb, double mjdj2k_utc) {
+    const std::array<double, 3> xys = cip_.get_xys(mjdj2k_tdb);
+    if (!(mjdj2k_utc >= eop_lb_ && mjdj2k_utc <= eop_ub_)) {
+        load_eop_interval(mjdj2k_utc);
+    }
+    const double days = mjdj2k_utc - eop_lb_;
+    const double dpsi = eop_base_[2] + days * eop_rate_[2];
+    const double deps = eop_base_[3] + days * eop_rate_[3];
+
+    // Celestial pole offsets, IERS Conventions (2010), Eq. 5.26
+    const double T        = mjdj2k_tdb / 36525.0;
+    const double coupling = POLE_OFFSET_COUPLING_RATE * T;
+    const double dx       = dpsi * SIN_OBLIQUITY_J2000 + coupling * deps;
+    const double dy       = deps - coupling * dpsi * SIN_OBLIQUITY_J2000;
+    const RotationMatrix q = CIPTable::get_rotation_to_cirs(xys[0] + dx, xys[1] + dy, xys[2]);
+
+    // Earth rotation, R3(ERA), where the ERA is linear in UTC within the interval
+    const double era = era_base_ + days * era_rate_;
+    const double ce = std::cos(era), se = std::sin(era);
+    RotationMatrix tirs{};
+    for (unsigned int j = 0; j < 3; j++) {
+        tirs[0][j] = ce * q[0][j] + se * q[1][j];
+        tirs[1][j] = -se * q[0][j] + ce * q[1][j];
+        tirs[2][j] = q[2][j];
+    }
+
+    // Polar motion, R1(-yp) * R2(-xp) * R3(s'), whose angles are below 1e-5 rad, so that sin(a) = a and
+    // cos(a) = 1 - a^2 / 2 are exact to double precision
+    const double sp = -47e-6 * RAD_PER_ARCSEC * T;
+    const double xp = eop_base_[0] + days * eop_rate_[0], yp = eop_base_[1] + days * eop_rate_[1];
+    const double cx = 1. - 0.5 * xp * xp, cy = 1. - 0.5 * yp * yp, cs = 1. - 0.5 * sp * sp;
+    const RotationMatrix pom{{{cx * cs, cx * sp, xp},
+                              {-cy * sp + yp * xp * cs, cy * cs + yp * xp * sp, -yp * cx},
+                              {-yp * sp - cy * xp * cs, yp * cs - cy * xp * sp, cy * cx}}};
+    return multiply(pom, tirs);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ItrfRotation::load_eop_interval(double mjdj2k_utc) {
+    // Also checks the range, and moves eop_index_ to the interval containing the epoch
+    eop_.get(mjdj2k_utc, eop_index_);
+
+    // Without records the parameters are zero, so any span works; one day keeps the ERA products as exact as the direct
+    // evaluation
+    const std::vector<EarthOrientationRecord>& records = eop_.get_records();
+    double lb = mjdj2k_utc, ub = mjdj2k_utc + 1.;
+    if (records.size() == 1) {
+        lb = ub = records.front().mjdj2k_utc;
+    } else if (records.size() > 1) {
+        lb = records[eop_index_].mjdj2k_utc;
+        ub = records[eop_index_ + 1].mjdj2k_utc;
+    }
+
+    // Evaluating the ends through the table keeps its removal of the leap seconds from UT1 - UTC
+    const EarthOrientationRecord a = eop_.get(lb, eop_index_);
+    const EarthOrientationRecord b = eop_.get(ub, eop_index_);
+    const double span = ub - lb;
+    const auto rate   = [span](double va, double vb) { return span > 0. ? (vb - va) / span : 0.; };
+
+    eop_lb_   = lb;
+    eop_ub_   = ub;
+    eop_base_ = {a.x_pole, a.y_pole, a.dpsi, a.deps};
+    eop_rate_ = {rate(a.x_pole, b.x_pole), rate(a.y_pole, b.y_pole), rate(a.dpsi, b.dpsi), rate(a.deps, b.deps)};
+    era_base_ = get_earth_rotation_angle(lb + a.ut1_minus_utc / SEC_PER_DAY);
+    era_rate_ = 2. * std::numbers::pi * ERA_TURNS_PER_DAY
+                * (1. + rate(a.ut1_minus_utc, b.ut1_minus_utc) / SEC_PER_DAY);
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,133 @@
+#include "nutation.hpp"
+
+// Standard Library Includes
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of radians per arcsecond
+constexpr double RAD_PER_ARCSEC = std::numbers::pi / (180.0 * 3600.0);
+
+//! Angles below this magnitude are small enough for the truncated series of sin_cos() to be exact in double precision
+constexpr double SMALL_ANGLE = 1e-3;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Compute the sine and cosine of an angle, with truncated series for the small angles that the nutations always are
+void sin_cos(double x, double& s, double& c) {
+    if (std::abs(x) < SMALL_ANGLE) {
+        const double x2 = x * x;
+        s               = x * (1. - x2 / 6.);
+        c               = 1. - x2 * (0.5 - x2 / 24.);
+    } else {
+        s = std::sin(x);
+        c = std::cos(x);
+    }
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+Nutation::Nutation(DEAsciiTable table) :
+    table_(std::move(table).expect_row_size(2, ROW_SIZE)), cache_(table_.get_view()) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+Nutation Nutation::from_de_ascii(const std::string& header_file, const std::vector<std::string>& data_files) {
+    return Nutation(DEAsciiTable::load(header_file, data_files, DEAsciiTable::NUTATION_COLUMN, 2));
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::array<double, 2> Nutation::get_angles(double mjdj2k_tdb) {
+    return cache_.get_position(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 2> Nutation::get_rates(double mjdj2k_tdb) {
+    return cache_.get_velocity(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::array<double, 4> Nutation::get_state(double mjdj2k_tdb) {
+    return cache_.get_state(mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix Nutation::get_nutation_matrix(double mjdj2k_tdb) {
+    const std::array<double, 2> angles = cache_.get_position(mjdj2k_tdb);
+    return get_nutation_matrix(get_mean_obliquity(mjdj2k_tdb), angles[0], angles[1]);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Nutation::get_angles(const double* mjdj2k_tdb, size_t num_epochs, double* angles) {
+    cache_.get_positions(mjdj2k_tdb, num_epochs, angles);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Nutation::get_states(const double* mjdj2k_tdb, size_t num_epochs, double* states) {
+    cache_.get_states(mjdj2k_tdb, num_epochs, states);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Nutation::get_nutation_matrices(const double* mjdj2k_tdb, size_t num_epochs, RotationMatrix* matrices) {
+    for (size_t i = 0; i < num_epochs; i++) {
+        matrices[i] = get_nutation_matrix(mjdj2k_tdb[i]);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double Nutation::get_start_mjdj2k() const {
+    return table_.get_view().start_mjdj2k;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double Nutation::get_stop_mjdj2k() const {
+    return table_.get_view().stop_mjdj2k;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double Nutation::get_mean_obliquity(double mjdj2k_tdb) {
+    const double T = mjdj2k_tdb / 36525.0;
+    return (84381.448 + T * (-46.8150 + T * (-0.00059 + T * 0.001813))) * RAD_PER_ARCSEC;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+RotationMatrix Nutation::get_nutation_matrix(double mean_obliquity, double dpsi, double deps) {
+    const double se = std::sin(mean_obliquity), ce = std::cos(mean_obliquity);
+
+    double sd = 0., cd = 0., sp = 0., cp = 0.;
+    sin_cos(deps, sd, cd);
+    sin_cos(dpsi, sp, cp);
+
+    // Sine and cosine of the true obliquity, eps + deps
+    const double st = se * cd + ce * sd;
+    const double ct = ce * cd - se * sd;
+
+    RotationMatrix rot{};
+    rot[0] = {cp, -sp * ce, -sp * se};
+    rot[1] = {sp * ct, cp * ct * ce + st * se, cp * ct * se - st * ce};
+    rot[2] = {sp * st, cp * st * ce - ct * se, cp * st * se + ct * ce};
+    return rot;
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,200 @@
+#ifndef JPL_EPHEMERIS_FRAMES_NUTATION_HPP
+#define JPL_EPHEMERIS_FRAMES_NUTATION_HPP
+
+/*!
+ * \file jpl_ephemeris/frames/nutation.hpp
+ * \brief Defines a class for evaluating the nutation angles from the Chebyshev polynomials of the DE ephemeris
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_ascii_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
+#include "jpl_ephemeris/frames/inertial_frame.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Defines a class for evaluating the nutation angles from the Chebyshev polynomials of the DE ephemeris
+ *
+ * \details The DE ephemerides carry the nutations in longitude and obliquity (dpsi, deps) in GROUP 1050 next to the bodies
+ * (819 10 4 in header.430_572, 2 components). They are loaded from the ASCII DE files into a DEAsciiTable and evaluated
+ * with a GranuleCache, i.e. the same [lb, ub, c_0, ...] rows and Clenshaw kernels as the position tables. An epoch costs
+ * two recurrences of 10 coefficients, in place of the 106 terms of the IAU 1980 series or the 1365 terms of IAU 2000A.
+ *
+ * Accuracy envelope:
+ *  - The tables are the IAU 1980 nutation theory, so they share its model error. Against the observed pole (or IAU 2000A
+ *    with the IERS celestial pole offsets), IAU 1980 is off by tens of mas in longitude and a few mas in obliquity, and
+ *    the offset drifts away from J2000 because it also absorbs the error of the IAU 1976 precession. Add the dpsi, deps
+ *    offsets of IERS Bulletin A to the angles, and pass them to the static get_nutation_matrix(), to remove it.
+ *  - Ten coefficients over 8 day granules follow the shortest (about 5 day) terms of the series to the order of 0.01 mas,
+ *    which is negligible next to the model error.
+ *  - The tables are tabulated in TDB. Evaluating them at TT instead is off by the nutation rate times TT - TDB (< 2 ms),
+ *    far below 1 uas.
+ *
+ * Every query updates the cache, so each thread needs its own instance, e.g.
+ *
+ *     Nutation nutation = Nutation::from_de_ascii("header.430_572", {"ascp1950.430", "ascp2050.430"});
+ *     RotationMatrix n = nutation.get_nutation_matrix(mjdj2k_tdb);
+ */
+class Nutation {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create an instance that evaluates the specified table
+         *
+         * \param table Table of the nutations, with 2 components of 10 coefficients
+         *
+         * \throws std::invalid_argument If table does not have 2 components of 10 coefficients
+         */
+        explicit Nutation(DEAsciiTable table);
+
+        /*!
+         * \brief Create an instance from the nutations column of the ASCII DE files
+         *
+         * \param header_file Path to the header file (e.g. header.430_572)
+         * \param data_files Paths to the data files (e.g. ascp1950.430, ascp2050.430), in increasing order of time
+         *
+         * \return Instance covering the data files
+         *
+         * \throws std::invalid_argument If a file cannot be read, or the header has no nutations of 10 coefficients
+         */
+        static Nutation from_de_ascii(const std::string& header_file, const std::vector<std::string>& data_files);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return the nutation angles
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Nutation in longitude and obliquity (dpsi, deps) [rad]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 2> get_angles(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the rates of the nutation angles
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Rates of the nutation in longitude and obliquity [rad/s]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 2> get_rates(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the nutation angles and their rates, sharing a single recurrence per angle
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Angles [rad] and rates [rad/s], stacked as [dpsi, deps, ddpsi, ddeps]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        std::array<double, 4> get_state(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the nutation matrix, from the mean equator and equinox of date to the true equator and equinox of
+         * date, with the IAU 1980 mean obliquity
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Rotation matrix, N, such that r_true = N * r_mean
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        RotationMatrix get_nutation_matrix(double mjdj2k_tdb);
+
+        /*!
+         * \brief Evaluate the nutation angles at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param angles Output angles [rad], 2 per epoch as (dpsi, deps)
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_angles(const double* mjdj2k_tdb, size_t num_epochs, double* angles);
+
+        /*!
+         * \brief Evaluate the nutation angles and their rates at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param states Output states, 4 per epoch as [dpsi, deps, ddpsi, ddeps] [rad, rad/s]
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_states(const double* mjdj2k_tdb, size_t num_epochs, double* states);
+
+        /*!
+         * \brief Evaluate the nutation matrix at a batch of epochs
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param matrices Output rotation matrices, one per epoch
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void get_nutation_matrices(const double* mjdj2k_tdb, size_t num_epochs, RotationMatrix* matrices);
+
+        //! Return the first epoch covered by the table, in the TDB Time System
+        double get_start_mjdj2k() const;
+
+        //! Return the last epoch covered by the table, in the TDB Time System
+        double get_stop_mjdj2k() const;
+
+        /*!
+         * \brief Return the IAU 1980 mean obliquity of the ecliptic
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch, in the TDB Time System
+         *
+         * \return Mean obliquity [rad]
+         */
+        static double get_mean_obliquity(double mjdj2k_tdb);
+
+        /*!
+         * \brief Return the nutation matrix R1(-(eps + deps)) * R3(-dpsi) * R1(eps) for the specified angles, e.g. after
+         * adding the IERS celestial pole offsets
+         *
+         * \param mean_obliquity Mean obliquity of the ecliptic, eps [rad]
+         * \param dpsi Nutation in longitude [rad]
+         * \param deps Nutation in obliquity [rad]
+         *
+         * \return Rotation matrix, N, such that r_true = N * r_mean
+         */
+        static RotationMatrix get_nutation_matrix(double mean_obliquity, double dpsi, double deps);
+
+    private:
+
+        //! Number of values per row of the nutations table, including the lb and ub values
+        static constexpr size_t ROW_SIZE = 12;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Table of the nutations
+        DEAsciiTable table_;
+
+        //! Cache of the last granule of the table
+        GranuleCache<ROW_SIZE, 2> cache_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
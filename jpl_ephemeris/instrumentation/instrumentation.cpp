@@ -0,0 +1,262 @@
+#include "instrumentation.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Offsets of the counter groups within a block of counters
+constexpr size_t BODY_CALLS_OFFSET    = 0;
+constexpr size_t CONTEXT_CALLS_OFFSET = BODY_CALLS_OFFSET + NUM_CENTRAL_BODIES * NUM_CENTRAL_BODIES;
+constexpr size_t EVENTS_OFFSET        = CONTEXT_CALLS_OFFSET + NUM_CENTRAL_BODIES * NUM_CENTRAL_BODIES;
+constexpr size_t BATCH_CALLS_OFFSET   = EVENTS_OFFSET + NUM_INSTRUMENTED_EVENTS;
+constexpr size_t BATCH_EPOCHS_OFFSET  = BATCH_CALLS_OFFSET + 1;
+constexpr size_t BATCH_SIZES_OFFSET   = BATCH_EPOCHS_OFFSET + 1;
+constexpr size_t NUM_COUNTERS         = BATCH_SIZES_OFFSET + NUM_BATCH_SIZE_BUCKETS;
+
+//! Plain counts of every counter
+using Counts = std::array<uint64_t, NUM_COUNTERS>;
+
+//! Names of the CentralBody values
+const std::array<const char*, NUM_CENTRAL_BODIES> BODY_NAMES{"SSB", "Sun", "Earth", "Moon"};
+
+//! Names of the InstrumentedEvent values
+const std::array<const char*, NUM_INSTRUMENTED_EVENTS> EVENT_NAMES{
+    "table lookups", "table out of range", "cache hits", "cache misses", "view out of range", "batch out of range",
+};
+
+struct ThreadCounters;
+
+//! Blocks of the live threads, and the counts of the threads that have exited
+struct Registry {
+    //! Guards the other members; never taken while counting
+    std::mutex mutex{};
+
+    //! Blocks of the live threads that have counted at least once
+    std::vector<const ThreadCounters*> threads{};
+
+    //! Counts of the threads that have exited
+    Counts retired{};
+
+    //! Counts at the last reset_instrumentation()
+    Counts baseline{};
+};
+
+//! Return the registry, which is never destroyed, since threads may exit after the static destructors have run
+Registry& get_registry() {
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+//! Counters of one thread, only written by that thread
+struct ThreadCounters {
+    //! Register the block, the first time the thread counts
+    ThreadCounters() {
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(this);
+    }
+
+    //! Fold the counts into the registry, and unregister the block
+    ~ThreadCounters() {
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (size_t k = 0; k < NUM_COUNTERS; k++) {
+            registry.retired[k] += values[k].load(std::memory_order_relaxed);
+        }
+        registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+    }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+    //! Add to a counter. The owning thread is the only writer, so a relaxed load and store cannot lose counts.
+    void add(size_t counter, uint64_t count) {
+        std::atomic<uint64_t>& value = values[counter];
+        value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    //! Counters, read by the snapshots of other threads
+    std::array<std::atomic<uint64_t>, NUM_COUNTERS> values{};
+};
+
+//! Block of the calling thread
+thread_local ThreadCounters thread_counters;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the counts of every thread, including the ones that have exited. The caller must hold the registry mutex.
+Counts sum_counts(const Registry& registry) {
+    Counts counts = registry.retired;
+    for (const ThreadCounters* thread : registry.threads) {
+        for (size_t k = 0; k < NUM_COUNTERS; k++) {
+            counts[k] += thread->values[k].load(std::memory_order_relaxed);
+        }
+    }
+    return counts;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Count a call in the [target][central body] group starting at offset
+void record_call(size_t offset, CentralBody target, CentralBody central_body) {
+    const size_t ind_target  = static_cast<size_t>(target);
+    const size_t ind_central = static_cast<size_t>(central_body);
+    if (ind_target < NUM_CENTRAL_BODIES && ind_central < NUM_CENTRAL_BODIES) {
+        thread_counters.add(offset + ind_target * NUM_CENTRAL_BODIES + ind_central, 1);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Write the non-zero calls of a [target][central body] group
+void write_calls(std::ostream& out, const char* title,
+                 const std::array<std::array<uint64_t, NUM_CENTRAL_BODIES>, NUM_CENTRAL_BODIES>& calls) {
+    for (size_t target = 0; target < NUM_CENTRAL_BODIES; target++) {
+        for (size_t central = 0; central < NUM_CENTRAL_BODIES; central++) {
+            if (calls[target][central] != 0) {
+                out << title << " " << BODY_NAMES[target] << " from " << BODY_NAMES[central] << ": "
+                    << calls[target][central] << "\n";
+            }
+        }
+    }
+}
+
+}  // namespace
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+double InstrumentationSnapshot::get_cache_hit_rate() const {
+    const uint64_t hits    = get_count(InstrumentedEvent::CacheHit);
+    const uint64_t queries = hits + get_count(InstrumentedEvent::CacheMiss);
+    return queries == 0 ? 0. : static_cast<double>(hits) / static_cast<double>(queries);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::string InstrumentationSnapshot::to_string() const {
+    std::ostringstream out;
+    if (!enabled) {
+        out << "instrumentation: disabled (configure with -DJPL_EPHEMERIS_INSTRUMENTATION=ON)\n";
+        return out.str();
+    }
+
+    write_calls(out, "body calls:", body_calls);
+    write_calls(out, "context calls:", context_calls);
+    for (size_t k = 0; k < NUM_INSTRUMENTED_EVENTS; k++) {
+        if (events[k] != 0) {
+            out << EVENT_NAMES[k] << ": " << events[k] << "\n";
+        }
+    }
+    if (get_count(InstrumentedEvent::CacheHit) + get_count(InstrumentedEvent::CacheMiss) != 0) {
+        out << "cache hit rate: " << get_cache_hit_rate() << "\n";
+    }
+    if (batch_calls != 0) {
+        out << "batches: " << batch_calls << ", epochs: " << batch_epochs << "\n";
+        for (size_t k = 0; k < NUM_BATCH_SIZE_BUCKETS; k++) {
+            if (batch_sizes[k] != 0) {
+                out << "batches of " << (uint64_t(1) << k);
+                if (k + 1 < NUM_BATCH_SIZE_BUCKETS) {
+                    out << " to " << (uint64_t(2) << k) - 1;
+                } else {
+                    out << " or more";
+                }
+                out << " epochs: " << batch_sizes[k] << "\n";
+            }
+        }
+    }
+    return out.str();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool is_instrumentation_enabled() {
+#ifdef JPL_EPHEMERIS_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+InstrumentationSnapshot get_instrumentation_snapshot() {
+    Counts counts{};
+    {
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        counts = sum_counts(registry);
+        for (size_t k = 0; k < NUM_COUNTERS; k++) {
+            counts[k] -= registry.baseline[k];
+        }
+    }
+
+    InstrumentationSnapshot snapshot;
+    snapshot.enabled = is_instrumentation_enabled();
+    for (size_t target = 0; target < NUM_CENTRAL_BODIES; target++) {
+        for (size_t central = 0; central < NUM_CENTRAL_BODIES; central++) {
+            const size_t ind                        = target * NUM_CENTRAL_BODIES + central;
+            snapshot.body_calls[target][central]    = counts[BODY_CALLS_OFFSET + ind];
+            snapshot.context_calls[target][central] = counts[CONTEXT_CALLS_OFFSET + ind];
+        }
+    }
+    std::copy_n(counts.begin() + EVENTS_OFFSET, NUM_INSTRUMENTED_EVENTS, snapshot.events.begin());
+    snapshot.batch_calls  = counts[BATCH_CALLS_OFFSET];
+    snapshot.batch_epochs = counts[BATCH_EPOCHS_OFFSET];
+    std::copy_n(counts.begin() + BATCH_SIZES_OFFSET, NUM_BATCH_SIZE_BUCKETS, snapshot.batch_sizes.begin());
+    return snapshot;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void reset_instrumentation() {
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.baseline = sum_counts(registry);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void record_event(InstrumentedEvent event) {
+    const size_t ind = static_cast<size_t>(event);
+    if (ind < NUM_INSTRUMENTED_EVENTS) {
+        thread_counters.add(EVENTS_OFFSET + ind, 1);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void record_body_call(CentralBody target, CentralBody central_body) {
+    record_call(BODY_CALLS_OFFSET, target, central_body);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void record_context_call(CentralBody target, CentralBody central_body) {
+    record_call(CONTEXT_CALLS_OFFSET, target, central_body);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void record_batch(size_t num_epochs) {
+    if (num_epochs == 0) {
+        return;
+    }
+    const size_t bucket = std::min<size_t>(static_cast<size_t>(std::bit_width(num_epochs)) - 1,
+                                           NUM_BATCH_SIZE_BUCKETS - 1);
+    thread_counters.add(BATCH_CALLS_OFFSET, 1);
+    thread_counters.add(BATCH_EPOCHS_OFFSET, num_epochs);
+    thread_counters.add(BATCH_SIZES_OFFSET + bucket, 1);
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,136 @@
+#ifndef JPL_EPHEMERIS_INSTRUMENTATION_INSTRUMENTATION_HPP
+#define JPL_EPHEMERIS_INSTRUMENTATION_INSTRUMENTATION_HPP
+
+/*!
+ * \file jpl_ephemeris/instrumentation/instrumentation.hpp
+ * \brief Optional counters of the hot paths: calls per body and central body, granule cache hits and misses,
+ * out-of-range rejections, and batch sizes
+ *
+ * \details The counters are compiled in by configuring CMake with -DJPL_EPHEMERIS_INSTRUMENTATION=ON, which defines the
+ * JPL_EPHEMERIS_INSTRUMENTATION macro for the library and the targets linking against it. Code built outside of CMake
+ * against an instrumented library should define the macro too, so that the header-only evaluators (e.g. GranuleCache)
+ * count as well. Without the macro, JPL_EPHEMERIS_RECORD() expands to nothing, so the hot paths are unchanged, and
+ * get_instrumentation_snapshot() returns zeros.
+ *
+ * Each thread counts into its own block of counters, which only that thread writes, with relaxed atomic loads and
+ * stores, so counting takes no lock and no read-modify-write instruction. A snapshot sums the blocks of the live threads
+ * and the counts left behind by the threads that have exited, e.g.
+ *
+ *     reset_instrumentation();
+ *     run_workload();
+ *     std::cout << get_instrumentation_snapshot().to_string();
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+
+#ifdef JPL_EPHEMERIS_INSTRUMENTATION
+//! Record an event with one of the record_*() functions, e.g. JPL_EPHEMERIS_RECORD(record_batch(num_epochs))
+#define JPL_EPHEMERIS_RECORD(call) ::jpl_ephemeris::call
+#else
+//! Record an event with one of the record_*() functions, e.g. JPL_EPHEMERIS_RECORD(record_batch(num_epochs))
+#define JPL_EPHEMERIS_RECORD(call) ((void)0)
+#endif
+
+namespace jpl_ephemeris {
+
+//! Number of CentralBody values, which index the call counters
+constexpr size_t NUM_CENTRAL_BODIES = 4;
+
+//! Number of batch size buckets. Bucket k counts the batches of 2^k to 2^(k+1) - 1 epochs, and the last one all larger.
+constexpr size_t NUM_BATCH_SIZE_BUCKETS = 21;
+
+//! Events of the hot paths that are counted without further breakdown
+enum class InstrumentedEvent : int {
+    TableLookup = 0,       //!< Granule lookup in a compiled-in table, by the Sun, Earth, and Moon classes
+    TableOutOfRange = 1,   //!< Epoch rejected by a compiled-in table, by the Sun, Earth, and Moon classes
+    CacheHit = 2,          //!< GranuleCache query answered from the cached granule
+    CacheMiss = 3,         //!< GranuleCache query that required a granule lookup
+    ViewOutOfRange = 4,    //!< Epoch rejected by an EphemerisTableView (GranuleCache, EphemerisContext, ...)
+    BatchOutOfRange = 5,   //!< Batch rejected by BatchEphemeris, because one of its epochs is out of range
+};
+
+//! Number of InstrumentedEvent values
+constexpr size_t NUM_INSTRUMENTED_EVENTS = 6;
+
+//! Counts of the hot paths, summed over the threads since the last reset_instrumentation()
+struct InstrumentationSnapshot {
+
+    //---------------------------------------
+    // Class Methods
+    //---------------------------------------
+
+    //! Return the number of times an event was counted
+    uint64_t get_count(InstrumentedEvent event) const {
+        return events[static_cast<size_t>(event)];
+    }
+
+    //! Return the fraction of the GranuleCache queries answered from the cached granule, or zero if there were none
+    double get_cache_hit_rate() const;
+
+    //! Return a multi-line report of the non-zero counters
+    std::string to_string() const;
+
+    //---------------------------------------
+    // Class Attributes
+    //---------------------------------------
+
+    //! True if the library was built with the counters
+    bool enabled = false;
+
+    //! Calls of the Sun, Earth, and Moon classes, indexed by [target][central body] with the CentralBody values
+    std::array<std::array<uint64_t, NUM_CENTRAL_BODIES>, NUM_CENTRAL_BODIES> body_calls{};
+
+    //! Calls of EphemerisContext, indexed by [target][central body] with the CentralBody values
+    std::array<std::array<uint64_t, NUM_CENTRAL_BODIES>, NUM_CENTRAL_BODIES> context_calls{};
+
+    //! Counts of the events, indexed by the InstrumentedEvent values
+    std::array<uint64_t, NUM_INSTRUMENTED_EVENTS> events{};
+
+    //! Number of batches evaluated by BatchEphemeris
+    uint64_t batch_calls = 0;
+
+    //! Number of epochs evaluated by BatchEphemeris
+    uint64_t batch_epochs = 0;
+
+    //! Number of batches by size, with the buckets of NUM_BATCH_SIZE_BUCKETS
+    std::array<uint64_t, NUM_BATCH_SIZE_BUCKETS> batch_sizes{};
+};
+
+//! Return true if the library was built with the counters
+bool is_instrumentation_enabled();
+
+/*!
+ * \brief Sum the counters of every thread
+ *
+ * \details The counters of the other threads are read while they may still be counting, so each counter is exact, but
+ * the counters are not read at the same instant.
+ *
+ * \return Counts since the last reset_instrumentation()
+ */
+InstrumentationSnapshot get_instrumentation_snapshot();
+
+//! Start counting from zero, by recording the current counts as the baseline of later snapshots
+void reset_instrumentation();
+
+//! Count an event on the calling thread
+void record_event(InstrumentedEvent event);
+
+//! Count a call of the Sun, Earth, or Moon class on the calling thread. Unexpected CentralBody values are ignored.
+void record_body_call(CentralBody target, CentralBody central_body);
+
+//! Count a call of EphemerisContext on the calling thread. Unexpected CentralBody values are ignored.
+void record_context_call(CentralBody target, CentralBody central_body);
+
+//! Count a batch of BatchEphemeris, and its number of epochs, on the calling thread
+void record_batch(size_t num_epochs);
+
+}  // namespace jpl_ephemeris
+
+#endif
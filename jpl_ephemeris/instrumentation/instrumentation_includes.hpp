@@ -0,0 +1,11 @@
+#ifndef JPL_EPHEMERIS_INSTRUMENTATION_INSTRUMENTATION_INCLUDES_HPP
+#define JPL_EPHEMERIS_INSTRUMENTATION_INSTRUMENTATION_INCLUDES_HPP
+
+/*!
+ * \file jpl_ephemeris/instrumentation/instrumentation_includes.hpp
+ * \brief Include files for the instrumentation directory
+ */
+
+#include "jpl_ephemeris/instrumentation/instrumentation.hpp"
+
+#endif
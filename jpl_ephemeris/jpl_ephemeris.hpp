@@ -8,5 +8,10 @@
 
 #include "jpl_ephemeris/celestial_bodies/celestial_body_includes.hpp"
 #include "jpl_ephemeris/chebyshev/chebyshev_includes.hpp"
+#include "jpl_ephemeris/frames/frames_includes.hpp"
+#include "jpl_ephemeris/instrumentation/instrumentation_includes.hpp"
+#include "jpl_ephemeris/memory/memory_includes.hpp"
+#include "jpl_ephemeris/parallel/parallel_includes.hpp"
+#include "jpl_ephemeris/time/time_includes.hpp"
 
 #endif
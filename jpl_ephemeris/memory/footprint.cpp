@@ -0,0 +1,406 @@
+#include "footprint.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+// System Includes
+#include <sys/mman.h>
+#include <unistd.h>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Element type of the mincore vector, which differs between Linux and the BSDs
+#ifdef __linux__
+using MincoreFlag = unsigned char;
+#else
+using MincoreFlag = char;
+#endif
+
+//! Names of the compiled-in tables, in the order of EphemerisTableSet::get_views()
+const std::array<const char*, 4> COMPILED_IN_NAMES{"sun_from_ssb", "emb_from_ssb", "earth_from_emb", "moon"};
+
+//! Tables registered with a TableRegistration
+struct Registry {
+    //! Guards the other members. Held while measuring or advising, so a table cannot be freed underneath.
+    std::mutex mutex{};
+
+    //! Registered tables with their identifiers, in the order of registration
+    std::vector<std::pair<uint64_t, TableLayout>> tables{};
+
+    //! Identifier of the next registration
+    uint64_t next_id = 1;
+};
+
+//! Return the registry, which is never destroyed, since static tables may be destroyed after the static destructors run
+Registry& get_registry() {
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the size of a regular page [bytes]
+size_t get_page_size() {
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Remove a registration from the registry. Identifier zero is the empty registration.
+void unregister(uint64_t id) {
+    if (id == 0) {
+        return;
+    }
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const auto entry = std::find_if(registry.tables.begin(), registry.tables.end(),
+                                    [id](const std::pair<uint64_t, TableLayout>& table) {
+                                        return table.first == id;
+                                    });
+    if (entry != registry.tables.end()) {
+        registry.tables.erase(entry);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the layouts of the compiled-in tables
+std::vector<TableLayout> get_compiled_in_layouts() {
+    const std::array<EphemerisTableView, 4> views = EphemerisTableSet::get_compiled_in().get_views();
+    std::vector<TableLayout> layouts;
+    for (size_t k = 0; k < views.size(); k++) {
+        layouts.push_back(TableLayout{COMPILED_IN_NAMES[k], TableStorage::CompiledIn, views[k], 3});
+    }
+    return layouts;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+/*!
+ * \brief Count the bytes of [start, start + length) on resident pages with mincore
+ *
+ * \param start Start of the range
+ * \param length Length of the range [bytes]
+ * \param page_size Size of a page [bytes]
+ * \param measured Set to false if mincore failed
+ *
+ * \return Number of bytes of the range on resident pages
+ */
+size_t measure_resident_bytes(const void* start, size_t length, size_t page_size, bool& measured) {
+    if (length == 0) {
+        return 0;
+    }
+
+    const uintptr_t lb      = reinterpret_cast<uintptr_t>(start);
+    const uintptr_t ub      = lb + length;
+    const uintptr_t page_lb = lb & ~(page_size - 1);
+    const size_t num_pages  = (ub - page_lb + page_size - 1) / page_size;
+    std::vector<MincoreFlag> flags(num_pages);
+    if (mincore(reinterpret_cast<void*>(page_lb), num_pages * page_size, flags.data()) != 0) {
+        measured = false;
+        return 0;
+    }
+
+    // Only count the part of the first and last pages that holds coefficients
+    size_t num_bytes = 0;
+    for (size_t k = 0; k < num_pages; k++) {
+        if ((flags[k] & 1) != 0) {
+            const uintptr_t page_start = page_lb + k * page_size;
+            num_bytes += std::min(ub, page_start + page_size) - std::max(lb, page_start);
+        }
+    }
+    return num_bytes;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the footprint of a table, measuring its residency if requested
+TableFootprint get_table_footprint(const TableLayout& table, bool measure_residency, size_t page_size) {
+    const EphemerisTableView& view = table.view;
+
+    TableFootprint footprint;
+    footprint.name           = table.name;
+    footprint.storage        = table.storage;
+    footprint.num_components = table.num_components;
+    footprint.num_granules   = view.num_granules;
+    footprint.degree         = view.row_size > 2 ? view.num_coeff() - 1 : 0;
+    footprint.start_mjdj2k   = view.start_mjdj2k;
+    footprint.stop_mjdj2k    = view.stop_mjdj2k;
+    footprint.days_per_poly  = view.days_per_poly;
+    footprint.num_bytes      = table.get_num_bytes();
+
+    if (measure_residency) {
+        const size_t length = static_cast<size_t>(view.num_granules) * view.row_size * sizeof(double);
+        footprint.residency_measured = true;
+        for (unsigned int c = 0; c < table.num_components; c++) {
+            footprint.resident_bytes += measure_resident_bytes(view.interp[c], length, page_size,
+                                                               footprint.residency_measured);
+        }
+        if (!footprint.residency_measured) {
+            footprint.resident_bytes = 0;
+        }
+    }
+    return footprint;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the madvise advice for a table, or -1 if the kernel headers do not define it
+int get_madvise_advice(ColdRangeAdvice advice, TableStorage storage) {
+    if (advice == ColdRangeAdvice::Drop && storage == TableStorage::CompiledIn) {
+        // Clean pages of a file mapping, which are re-read from the file on the next access
+        return MADV_DONTNEED;
+    }
+#ifdef MADV_COLD
+    if (advice == ColdRangeAdvice::Cold) {
+        return MADV_COLD;
+    }
+#endif
+#ifdef MADV_PAGEOUT
+    if (advice == ColdRangeAdvice::PageOut || advice == ColdRangeAdvice::Drop) {
+        return MADV_PAGEOUT;
+    }
+#endif
+    return -1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Advise the whole pages inside of [lb, ub), adding the outcome to the report
+void advise_pages(uintptr_t lb, uintptr_t ub, int advice, size_t page_size, ColdRangeReport& report) {
+    // Round inward, so the pages shared with the granules in use or other data are left alone
+    const uintptr_t page_lb = (lb + page_size - 1) & ~(page_size - 1);
+    const uintptr_t page_ub = ub & ~(page_size - 1);
+    if (page_ub <= page_lb) {
+        return;
+    }
+
+    const size_t length = page_ub - page_lb;
+    if (advice >= 0 && madvise(reinterpret_cast<void*>(page_lb), length, advice) == 0) {
+        report.advised_bytes += length;
+    } else {
+        report.rejected_bytes += length;
+        report.error = advice >= 0 ? errno : EINVAL;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the index of the granule containing mjdj2k, or of the next one if round_up, clamped to [0, num_granules]
+size_t get_granule_bound(const EphemerisTableView& view, double mjdj2k, bool round_up) {
+    const double position = (mjdj2k - view.start_mjdj2k) / view.days_per_poly;
+    if (position <= 0.) {
+        return 0;
+    }
+    const double bound = round_up ? std::floor(position) + 1. : std::floor(position);
+    return bound >= view.num_granules ? view.num_granules : static_cast<size_t>(bound);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Advise the cold pages of a table. The caller must hold the registry mutex if the table is registered.
+ColdRangeReport advise_table(const TableLayout& table, double keep_start_mjdj2k, double keep_stop_mjdj2k,
+                             ColdRangeAdvice advice, size_t page_size) {
+    ColdRangeReport report;
+    const EphemerisTableView& view = table.view;
+    if (view.num_granules == 0 || !(view.days_per_poly > 0.)) {
+        return report;
+    }
+
+    // Granules [keep_lb, keep_ub) overlap the time span in use
+    const size_t keep_lb = get_granule_bound(view, keep_start_mjdj2k, false);
+    const size_t keep_ub = std::max(keep_lb, get_granule_bound(view, keep_stop_mjdj2k, true));
+
+    const size_t row_bytes   = view.row_size * sizeof(double);
+    const int madvise_advice = get_madvise_advice(advice, table.storage);
+    for (unsigned int c = 0; c < table.num_components; c++) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(view.interp[c]);
+        advise_pages(base, base + keep_lb * row_bytes, madvise_advice, page_size, report);
+        advise_pages(base + keep_ub * row_bytes, base + view.num_granules * row_bytes, madvise_advice, page_size,
+                     report);
+    }
+    return report;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Throw if [keep_start, keep_stop] is not a valid time span
+void check_keep_span(double keep_start_mjdj2k, double keep_stop_mjdj2k, const char* caller) {
+    if (!(keep_start_mjdj2k <= keep_stop_mjdj2k)) {
+        throw std::invalid_argument(std::string(caller) + " - keep_start_mjdj2k must not be greater than "
+                                    "keep_stop_mjdj2k.");
+    }
+}
+
+}  // End anonymous namespace
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+
+std::string to_string(TableStorage storage) {
+    switch (storage) {
+        case TableStorage::CompiledIn:
+            return "compiled-in";
+        case TableStorage::Mapped:
+            return "mapped";
+        case TableStorage::Heap:
+            return "heap";
+        default:
+            return "unknown";
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+size_t MemoryFootprint::get_num_bytes() const {
+    size_t num_bytes = 0;
+    for (const TableFootprint& table : tables) {
+        num_bytes += table.num_bytes;
+    }
+    return num_bytes;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+size_t MemoryFootprint::get_resident_bytes() const {
+    size_t num_bytes = 0;
+    for (const TableFootprint& table : tables) {
+        num_bytes += table.resident_bytes;
+    }
+    return num_bytes;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::string MemoryFootprint::to_string() const {
+    std::ostringstream out;
+    for (const TableFootprint& table : tables) {
+        out << table.name << ": " << jpl_ephemeris::to_string(table.storage) << ", " << table.num_components << " x "
+            << table.num_granules << " granules of degree " << table.degree << ", mjdj2k " << table.start_mjdj2k
+            << " to " << table.stop_mjdj2k << " (" << table.days_per_poly << " days per granule), " << table.num_bytes
+            << " bytes";
+        if (table.residency_measured) {
+            out << ", " << table.resident_bytes << " resident";
+        }
+        out << "\n";
+    }
+    out << "total: " << tables.size() << " tables, " << get_num_bytes() << " bytes";
+    const auto is_measured = [](const TableFootprint& table) {
+        return table.residency_measured;
+    };
+    if (std::any_of(tables.begin(), tables.end(), is_measured)) {
+        out << ", " << get_resident_bytes() << " resident";
+    }
+    out << "\n";
+    return out.str();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+MemoryFootprint get_memory_footprint(bool measure_residency) {
+    const size_t page_size = get_page_size();
+
+    MemoryFootprint footprint;
+    for (const TableLayout& table : get_compiled_in_layouts()) {
+        footprint.tables.push_back(get_table_footprint(table, measure_residency, page_size));
+    }
+
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const std::pair<uint64_t, TableLayout>& entry : registry.tables) {
+        footprint.tables.push_back(get_table_footprint(entry.second, measure_residency, page_size));
+    }
+    return footprint;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::string ColdRangeReport::to_string() const {
+    std::ostringstream out;
+    out << "advised: " << advised_bytes << " bytes, rejected: " << rejected_bytes << " bytes";
+    if (error != 0) {
+        out << " (" << std::strerror(error) << ")";
+    }
+    return out.str();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ColdRangeReport advise_cold_range(const TableLayout& table, double keep_start_mjdj2k, double keep_stop_mjdj2k,
+                                  ColdRangeAdvice advice) {
+    check_keep_span(keep_start_mjdj2k, keep_stop_mjdj2k, "advise_cold_range()");
+    return advise_table(table, keep_start_mjdj2k, keep_stop_mjdj2k, advice, get_page_size());
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ColdRangeReport advise_cold_ranges(double keep_start_mjdj2k, double keep_stop_mjdj2k, ColdRangeAdvice advice) {
+    check_keep_span(keep_start_mjdj2k, keep_stop_mjdj2k, "advise_cold_ranges()");
+    const size_t page_size = get_page_size();
+
+    ColdRangeReport report;
+    const auto add = [&report](const ColdRangeReport& table_report) {
+        report.advised_bytes += table_report.advised_bytes;
+        report.rejected_bytes += table_report.rejected_bytes;
+        report.error = table_report.error != 0 ? table_report.error : report.error;
+    };
+
+    for (const TableLayout& table : get_compiled_in_layouts()) {
+        add(advise_table(table, keep_start_mjdj2k, keep_stop_mjdj2k, advice, page_size));
+    }
+
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const std::pair<uint64_t, TableLayout>& entry : registry.tables) {
+        add(advise_table(entry.second, keep_start_mjdj2k, keep_stop_mjdj2k, advice, page_size));
+    }
+    return report;
+}
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+TableRegistration::TableRegistration(TableLayout layout) {
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    id_ = registry.next_id++;
+    registry.tables.emplace_back(id_, std::move(layout));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TableRegistration::~TableRegistration() {
+    unregister(id_);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TableRegistration::TableRegistration(TableRegistration&& other) noexcept : id_(std::exchange(other.id_, 0)) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TableRegistration& TableRegistration::operator=(TableRegistration&& other) noexcept {
+    if (this != &other) {
+        unregister(id_);
+        id_ = std::exchange(other.id_, 0);
+    }
+    return *this;
+}
+
+}  // End namespace jpl_ephemeris
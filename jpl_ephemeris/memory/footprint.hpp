@@ -0,0 +1,230 @@
+#ifndef JPL_EPHEMERIS_MEMORY_FOOTPRINT_HPP
+#define JPL_EPHEMERIS_MEMORY_FOOTPRINT_HPP
+
+/*!
+ * \file jpl_ephemeris/memory/footprint.hpp
+ * \brief Functions and classes for reporting the memory spent on the coefficient tables, and for releasing the granules
+ * outside of the time span in use
+ *
+ * \details The footprint lists the four compiled-in tables, followed by every table that currently holds coefficients of
+ * its own: the ResidentTables copies, DEAsciiTable, CIPTable, DerivativeEphemerisTable, and FrameEphemerisTable. Those
+ * classes register their storage on construction and unregister it on destruction, e.g.
+ *
+ *     std::cout << get_memory_footprint().to_string();
+ *
+ *     // On a worker that only evaluates 2020-2030, let the kernel reclaim the rest of the tables first
+ *     advise_cold_ranges(7305., 10958., ColdRangeAdvice::PageOut);
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_view.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies where the coefficients of a table are stored
+enum class TableStorage : int {
+    CompiledIn = 0,  //!< Read-only data of the library, a private file mapping backed by the library file
+    Mapped = 1,      //!< Anonymous mapping owned by a ResidentTables instance
+    Heap = 2,        //!< Heap allocation owned by a table object (e.g. DEAsciiTable or CIPTable)
+};
+
+//! Return the name of a TableStorage: "compiled-in", "mapped", or "heap"
+std::string to_string(TableStorage storage);
+
+//! Location and shape of the coefficients of one table
+struct TableLayout {
+    //! Name of the table, e.g. "sun_from_ssb"
+    std::string name{};
+
+    //! Storage of the coefficients
+    TableStorage storage = TableStorage::Heap;
+
+    //! View of the coefficients. The rows of each component are contiguous.
+    EphemerisTableView view{};
+
+    //! Number of components stored in the table (1-3)
+    unsigned int num_components = 3;
+
+    //! Return the number of bytes of coefficients
+    size_t get_num_bytes() const {
+        return static_cast<size_t>(num_components) * view.num_granules * view.row_size * sizeof(double);
+    }
+};
+
+//! Memory spent on one table
+struct TableFootprint {
+    //! Name of the table, e.g. "sun_from_ssb"
+    std::string name{};
+
+    //! Storage of the coefficients
+    TableStorage storage = TableStorage::Heap;
+
+    //! Number of components stored in the table (1-3)
+    unsigned int num_components = 0;
+
+    //! Number of granules of each component
+    unsigned int num_granules = 0;
+
+    //! Degree of the Chebyshev polynomials
+    unsigned int degree = 0;
+
+    //! Start of the time span of the table, MJD J2K TDB [days]
+    double start_mjdj2k = 0.;
+
+    //! End of the time span of the table, MJD J2K TDB [days]
+    double stop_mjdj2k = 0.;
+
+    //! Length of each granule [days]
+    double days_per_poly = 0.;
+
+    //! Number of bytes of coefficients
+    size_t num_bytes = 0;
+
+    //! Number of bytes of coefficients on pages resident in RAM, as reported by mincore
+    size_t resident_bytes = 0;
+
+    //! True if resident_bytes could be measured
+    bool residency_measured = false;
+};
+
+//! Memory spent on every table that is currently loaded
+struct MemoryFootprint {
+    //! Return the number of bytes of coefficients of every table
+    size_t get_num_bytes() const;
+
+    //! Return the number of bytes of coefficients on resident pages of every table whose residency was measured
+    size_t get_resident_bytes() const;
+
+    //! Return a multi-line report with one line per table, followed by the totals
+    std::string to_string() const;
+
+    //! Tables, the compiled-in ones first, then the registered ones in the order they were loaded
+    std::vector<TableFootprint> tables{};
+};
+
+/*!
+ * \brief Return the memory spent on the compiled-in tables and on every registered table
+ *
+ * \details The residency is measured with mincore over the pages holding the coefficients of each component, counting the
+ * bytes of coefficients on the pages reported resident. For the compiled-in tables, this is whether the pages of the
+ * library file are in the page cache, which is shared with the other processes using the library.
+ *
+ * \param measure_residency If false, skip mincore and leave the residency of every table unmeasured
+ *
+ * \return Footprint of every table
+ */
+MemoryFootprint get_memory_footprint(bool measure_residency = true);
+
+/*!
+ * \brief Registers the coefficients of a table with get_memory_footprint(), for as long as the registration lives
+ *
+ * \details The table classes holding coefficients keep a registration as their last member, so the registration ends
+ * before the coefficients are freed. The registered layout is copied, so the coefficients must stay at the same address
+ * for the lifetime of the registration, which holds for moved std::vector storage.
+ */
+class TableRegistration {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an empty registration
+        TableRegistration() = default;
+
+        //! Register a table
+        explicit TableRegistration(TableLayout layout);
+
+        //! Unregister the table
+        ~TableRegistration();
+
+        //! Delete the copy constructor, since each table is registered once
+        TableRegistration(const TableRegistration&) = delete;
+
+        //! Delete the copy assignment operator, since each table is registered once
+        TableRegistration& operator=(const TableRegistration&) = delete;
+
+        //! Take over the registration of other, leaving it empty
+        TableRegistration(TableRegistration&& other) noexcept;
+
+        //! Unregister the current table, and take over the registration of other, leaving it empty
+        TableRegistration& operator=(TableRegistration&& other) noexcept;
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Identifier of the registration, zero if empty
+        uint64_t id_ = 0;
+};
+
+//! Specifies how the kernel is advised to treat the pages outside of the time span in use
+enum class ColdRangeAdvice : int {
+    Cold = 0,     //!< madvise(MADV_COLD): reclaim the pages first under memory pressure (Linux 5.4+)
+    PageOut = 1,  //!< madvise(MADV_PAGEOUT): reclaim the pages now, swapping out anonymous ones (Linux 5.4+)
+    Drop = 2,     //!< MADV_DONTNEED for the compiled-in tables, which are re-read from the library file on the next
+                  //!< access, and MADV_PAGEOUT for the others, whose contents would otherwise be lost
+};
+
+//! Outcome of advise_cold_ranges()
+struct ColdRangeReport {
+    //! Number of bytes of whole pages that were advised
+    size_t advised_bytes = 0;
+
+    //! Number of bytes of whole pages whose advice was rejected
+    size_t rejected_bytes = 0;
+
+    //! Value of errno of the last rejected advice (e.g. EINVAL for locked pages or an older kernel), zero otherwise
+    int error = 0;
+
+    //! Return a one-line description of the outcome
+    std::string to_string() const;
+};
+
+/*!
+ * \brief Advise the kernel about the pages of a table that only hold granules outside of [keep_start, keep_stop]
+ *
+ * \details The ranges are rounded inward to whole pages, so the pages shared with a granule in use, or with other data, are
+ * never advised. The coefficients stay valid whatever the advice: a later query of a cold granule faults its pages back
+ * in. Locked pages (ResidencyOptions::lock) are rejected by the kernel and reported in the ColdRangeReport.
+ *
+ * \param table Table to advise
+ * \param keep_start_mjdj2k Start of the time span in use, MJD J2K TDB [days]
+ * \param keep_stop_mjdj2k End of the time span in use, MJD J2K TDB [days]
+ * \param advice Advice for the pages outside of the time span
+ *
+ * \return Bytes advised and rejected
+ *
+ * \throws std::invalid_argument If keep_start_mjdj2k is greater than keep_stop_mjdj2k, or either is NaN
+ */
+ColdRangeReport advise_cold_range(const TableLayout& table, double keep_start_mjdj2k, double keep_stop_mjdj2k,
+                                  ColdRangeAdvice advice = ColdRangeAdvice::Cold);
+
+/*!
+ * \brief Advise the kernel about the pages of every table listed by get_memory_footprint() that only hold granules outside
+ * of [keep_start, keep_stop]
+ *
+ * \details See advise_cold_range().
+ *
+ * \param keep_start_mjdj2k Start of the time span in use, MJD J2K TDB [days]
+ * \param keep_stop_mjdj2k End of the time span in use, MJD J2K TDB [days]
+ * \param advice Advice for the pages outside of the time span
+ *
+ * \return Bytes advised and rejected, summed over the tables
+ *
+ * \throws std::invalid_argument If keep_start_mjdj2k is greater than keep_stop_mjdj2k, or either is NaN
+ */
+ColdRangeReport advise_cold_ranges(double keep_start_mjdj2k, double keep_stop_mjdj2k,
+                                   ColdRangeAdvice advice = ColdRangeAdvice::Cold);
+
+}  // End namespace jpl_ephemeris
+
+#endif
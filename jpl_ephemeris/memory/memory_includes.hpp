@@ -0,0 +1,12 @@
+#ifndef JPL_EPHEMERIS_MEMORY_MEMORY_INCLUDES_HPP
+#define JPL_EPHEMERIS_MEMORY_MEMORY_INCLUDES_HPP
+
+/*!
+ * \file jpl_ephemeris/memory/memory_includes.hpp
+ * \brief Include files for the memory directory
+ */
+
+#include "jpl_ephemeris/memory/footprint.hpp"
+#include "jpl_ephemeris/memory/residency.hpp"
+
+#endif
@@ -0,0 +1,335 @@
+#include "residency.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Return the size of a regular page [bytes]
+size_t get_page_size() {
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the default huge page size from /proc/meminfo, or 2 MiB if it is unavailable [bytes]
+size_t get_huge_page_size() {
+    std::ifstream meminfo("/proc/meminfo");
+    std::string line;
+    while (std::getline(meminfo, line)) {
+        unsigned long kb = 0;
+        if (std::sscanf(line.c_str(), "Hugepagesize: %lu kB", &kb) == 1 && kb > 0) {
+            return static_cast<size_t>(kb) * 1024;
+        }
+    }
+    return size_t{2} << 20;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return true if transparent huge pages are enabled for madvise'd regions
+bool transparent_huge_pages_enabled() {
+    std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string setting;
+    if (!std::getline(enabled, setting)) {
+        return false;
+    }
+    return setting.find("[never]") == std::string::npos;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Round value up to a multiple of alignment, which must be a power of two
+size_t round_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Address range [first, second)
+using AddressRange = std::pair<uintptr_t, uintptr_t>;
+
+/*!
+ * \brief Sum the huge page backed bytes of the mappings overlapping any of the ranges from /proc/self/smaps
+ *
+ * \param ranges Address ranges
+ * \param measured Set to true if /proc/self/smaps could be read
+ *
+ * \return Number of bytes backed by transparent or explicit huge pages, counting each mapping once
+ */
+size_t measure_huge_page_bytes(const std::vector<AddressRange>& ranges, bool& measured) {
+    std::ifstream smaps("/proc/self/smaps");
+    measured = smaps.is_open();
+
+    bool in_range    = false;
+    size_t num_bytes = 0;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        unsigned long kb = 0;
+        if (std::sscanf(line.c_str(), "AnonHugePages: %lu kB", &kb) == 1 ||
+            std::sscanf(line.c_str(), "Private_Hugetlb: %lu kB", &kb) == 1 ||
+            std::sscanf(line.c_str(), "Shared_Hugetlb: %lu kB", &kb) == 1) {
+            if (in_range) {
+                num_bytes += static_cast<size_t>(kb) * 1024;
+            }
+            continue;
+        }
+
+        // Every mapping starts with a header line of the form "start-end perms offset dev inode path"
+        unsigned long map_lb = 0;
+        unsigned long map_ub = 0;
+        if (std::sscanf(line.c_str(), "%lx-%lx ", &map_lb, &map_ub) == 2) {
+            in_range = std::any_of(ranges.begin(), ranges.end(), [map_lb, map_ub](const AddressRange& range) {
+                return map_lb < range.second && map_ub > range.first;
+            });
+        }
+    }
+
+    return num_bytes;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the page-aligned ranges covering the components of the tables, merging the ones that share pages
+std::vector<AddressRange> get_page_ranges(const EphemerisTableSet& tables, size_t page_size) {
+    std::vector<AddressRange> ranges;
+    for (const EphemerisTableView& view : tables.get_views()) {
+        const size_t length = static_cast<size_t>(view.num_granules) * view.row_size * sizeof(double);
+        for (const double* interp : view.interp) {
+            ranges.emplace_back(reinterpret_cast<uintptr_t>(interp) & ~(page_size - 1),
+                                round_up(reinterpret_cast<uintptr_t>(interp) + length, page_size));
+        }
+    }
+
+    std::sort(ranges.begin(), ranges.end());
+    std::vector<AddressRange> merged;
+    for (const AddressRange& range : ranges) {
+        if (!merged.empty() && range.first <= merged.back().second) {
+            merged.back().second = std::max(merged.back().second, range.second);
+        } else {
+            merged.push_back(range);
+        }
+    }
+    return merged;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Read one value from every page of [start, start + length), so the pages are faulted in
+void prefault_range(const void* start, size_t length, size_t page_size) {
+    const volatile char* bytes = static_cast<const volatile char*>(start);
+    for (size_t offset = 0; offset < length; offset += page_size) {
+        (void)bytes[offset];
+    }
+    if (length > 0) {
+        (void)bytes[length - 1];
+    }
+}
+
+}  // End anonymous namespace
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+
+std::string to_string(HugePageMode mode) {
+    switch (mode) {
+        case HugePageMode::None:
+            return "none";
+        case HugePageMode::Transparent:
+            return "transparent";
+        case HugePageMode::Explicit:
+            return "explicit";
+        default:
+            return "unknown";
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::string ResidencyReport::to_string() const {
+    std::ostringstream out;
+    out << "huge pages: " << jpl_ephemeris::to_string(applied_huge_pages) << " (requested "
+        << jpl_ephemeris::to_string(requested_huge_pages) << ")";
+    if (huge_pages_measured) {
+        out << ", " << huge_page_bytes << " of " << mapped_bytes << " bytes on huge pages";
+    }
+    out << ", prefaulted: " << (prefaulted ? "yes" : "no") << ", locked: " << (locked ? "yes" : "no");
+    if (lock_error != 0) {
+        out << " (" << std::strerror(lock_error) << ")";
+    }
+    if (protect_error != 0) {
+        out << ", read-only: no (" << std::strerror(protect_error) << ")";
+    }
+    return out.str();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ResidencyReport make_compiled_tables_resident(const ResidencyOptions& options) {
+    const size_t page_size = get_page_size();
+    const EphemerisTableSet tables = EphemerisTableSet::get_compiled_in();
+
+    ResidencyReport report;
+    report.requested_huge_pages = options.huge_pages;
+    report.num_bytes            = tables.get_num_bytes();
+    report.locked               = options.lock;
+
+    // Each component of each table is a separate array, and adjacent arrays can share a page, so handle the merged
+    // page-aligned ranges one at a time
+    const std::vector<AddressRange> ranges = get_page_ranges(tables, page_size);
+    for (const AddressRange& range : ranges) {
+        const void* start   = reinterpret_cast<const void*>(range.first);
+        const size_t length = range.second - range.first;
+        report.mapped_bytes += length;
+
+        if (options.prefault) {
+            prefault_range(start, length, page_size);
+        }
+
+        if (options.lock && mlock(start, length) != 0) {
+            report.locked     = false;
+            report.lock_error = errno;
+        }
+    }
+
+    report.huge_page_bytes = measure_huge_page_bytes(ranges, report.huge_pages_measured);
+
+    // mlock also faults the pages in
+    report.prefaulted = options.prefault || report.locked;
+    return report;
+}
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+ResidentTables::ResidentTables(const ResidencyOptions& options, const EphemerisTableSet& source) :
+    map_base_(nullptr), map_length_(0), tables_(source), report_(), registrations_() {
+
+    const size_t page_size      = get_page_size();
+    const size_t huge_page_size = get_huge_page_size();
+    const size_t num_bytes      = source.get_num_bytes();
+
+    report_.requested_huge_pages = options.huge_pages;
+    report_.num_bytes            = num_bytes;
+
+    // Try the requested mode first, then each weaker mode if falling back is allowed
+    char* data = nullptr;
+    for (int mode = static_cast<int>(options.huge_pages); mode >= 0 && data == nullptr; mode--) {
+        if (mode != static_cast<int>(options.huge_pages) && !options.fall_back) {
+            throw std::runtime_error("ResidentTables::ResidentTables() - Requested huge page mode '" +
+                                     to_string(options.huge_pages) + "' is unavailable.");
+        }
+
+        if (mode == static_cast<int>(HugePageMode::Explicit)) {
+#ifdef MAP_HUGETLB
+            map_length_ = round_up(num_bytes, huge_page_size);
+            void* base  = mmap(nullptr, map_length_, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (base != MAP_FAILED) {
+                map_base_                  = base;
+                data                       = static_cast<char*>(base);
+                report_.mapped_bytes       = map_length_;
+                report_.applied_huge_pages = HugePageMode::Explicit;
+            }
+#endif
+        } else if (mode == static_cast<int>(HugePageMode::Transparent)) {
+#ifdef MADV_HUGEPAGE
+            if (transparent_huge_pages_enabled()) {
+                // Over-allocate by one huge page, so the coefficients can start on a huge page boundary
+                const size_t length = round_up(num_bytes, huge_page_size);
+                map_length_         = length + huge_page_size;
+                void* base = mmap(nullptr, map_length_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (base != MAP_FAILED) {
+                    char* aligned = reinterpret_cast<char*>(
+                        round_up(reinterpret_cast<uintptr_t>(base), huge_page_size));
+                    if (madvise(aligned, length, MADV_HUGEPAGE) == 0) {
+                        map_base_                  = base;
+                        data                       = aligned;
+                        report_.mapped_bytes       = length;
+                        report_.applied_huge_pages = HugePageMode::Transparent;
+                    } else {
+                        munmap(base, map_length_);
+                    }
+                }
+            }
+#endif
+        } else {
+            map_length_ = round_up(num_bytes, page_size);
+            void* base  = mmap(nullptr, map_length_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            map_base_                  = base;
+            data                       = static_cast<char*>(base);
+            report_.mapped_bytes       = map_length_;
+            report_.applied_huge_pages = HugePageMode::None;
+        }
+    }
+
+    // Copy each component into the mapping back to back, which also faults every page in
+    EphemerisTableView* views[4] = {&tables_.sun_from_ssb, &tables_.emb_from_ssb, &tables_.earth_from_emb, &tables_.moon};
+    size_t offset = 0;
+    for (EphemerisTableView* view : views) {
+        const size_t length = static_cast<size_t>(view->num_granules) * view->row_size * sizeof(double);
+        for (const double*& interp : view->interp) {
+            std::memcpy(data + offset, interp, length);
+            interp = reinterpret_cast<const double*>(data + offset);
+            offset += length;
+        }
+    }
+    report_.prefaulted = true;
+
+    if (mprotect(map_base_, map_length_, PROT_READ) == 0) {
+        report_.read_only = true;
+    } else {
+        report_.protect_error = errno;
+    }
+
+    if (options.lock) {
+        if (mlock(data, report_.mapped_bytes) == 0) {
+            report_.locked = true;
+        } else {
+            report_.lock_error = errno;
+        }
+    }
+
+    const std::vector<AddressRange> ranges{{reinterpret_cast<uintptr_t>(data),
+                                            reinterpret_cast<uintptr_t>(data) + report_.mapped_bytes}};
+    report_.huge_page_bytes = measure_huge_page_bytes(ranges, report_.huge_pages_measured);
+
+    const std::array<const char*, 4> names{"sun_from_ssb", "emb_from_ssb", "earth_from_emb", "moon"};
+    for (size_t k = 0; k < registrations_.size(); k++) {
+        registrations_[k] = TableRegistration(TableLayout{names[k], TableStorage::Mapped, *views[k], 3});
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ResidentTables::~ResidentTables() {
+    // Unregister the tables before their storage goes away
+    registrations_ = {};
+
+    // Unmapping also releases any lock on the pages
+    if (map_base_ != nullptr) {
+        munmap(map_base_, map_length_);
+    }
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,174 @@
+#ifndef JPL_EPHEMERIS_MEMORY_RESIDENCY_HPP
+#define JPL_EPHEMERIS_MEMORY_RESIDENCY_HPP
+
+/*!
+ * \file jpl_ephemeris/memory/residency.hpp
+ * \brief Functions and classes for keeping the coefficient tables resident in memory, for latency-deterministic queries
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <string>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/memory/footprint.hpp"
+
+namespace jpl_ephemeris {
+
+//! Specifies the page size used for the coefficient storage
+enum class HugePageMode : int {
+    None = 0,         //!< Regular pages
+    Transparent = 1,  //!< Transparent huge pages, requested with madvise(MADV_HUGEPAGE)
+    Explicit = 2,     //!< Explicit huge pages from the hugetlbfs pool, requested with mmap(MAP_HUGETLB)
+};
+
+//! Requested residency of the coefficient storage
+struct ResidencyOptions {
+    //! Page size requested for the coefficient storage
+    HugePageMode huge_pages = HugePageMode::Transparent;
+
+    //! If the requested huge page mode is unavailable, fall back to the next weaker mode instead of throwing
+    bool fall_back = true;
+
+    //! Touch every page up front, so the first query into any part of the tables does not page fault
+    bool prefault = true;
+
+    //! Lock the pages into RAM with mlock, so they cannot be paged out
+    bool lock = false;
+};
+
+//! Residency that actually took effect
+struct ResidencyReport {
+    //! Page size that was requested
+    HugePageMode requested_huge_pages = HugePageMode::None;
+
+    //! Page size of the storage that was created, or whose advice was accepted by the kernel
+    HugePageMode applied_huge_pages = HugePageMode::None;
+
+    //! Number of bytes of coefficients
+    size_t num_bytes = 0;
+
+    //! Number of bytes mapped for the coefficients, after rounding up to whole pages
+    size_t mapped_bytes = 0;
+
+    //! Number of bytes of the coefficient storage backed by huge pages, as reported by /proc/self/smaps
+    size_t huge_page_bytes = 0;
+
+    //! True if huge_page_bytes could be measured
+    bool huge_pages_measured = false;
+
+    //! True if every page was touched up front
+    bool prefaulted = false;
+
+    //! True if the pages were locked into RAM
+    bool locked = false;
+
+    //! Value of errno if the pages could not be locked (e.g. EPERM or ENOMEM from RLIMIT_MEMLOCK), zero otherwise
+    int lock_error = 0;
+
+    //! True if the copy of the tables was made read-only (ResidentTables only)
+    bool read_only = false;
+
+    //! Value of errno if the copy of the tables could not be made read-only, zero otherwise
+    int protect_error = 0;
+
+    //! Return a one-line description of the residency, e.g. for logging at start-up
+    std::string to_string() const;
+};
+
+//! Return the name of a HugePageMode
+std::string to_string(HugePageMode mode);
+
+/*!
+ * \brief Prefault and lock the compiled-in tables in place, which keeps the Sun, Earth, and Moon classes resident
+ *
+ * \details The compiled-in tables live in the data segment of the library, which is a private file mapping, so they
+ * cannot be moved onto huge pages in place; use ResidentTables for that. The requested huge page mode is recorded in the
+ * report, but is never applied.
+ *
+ * \param options Requested residency
+ *
+ * \return Residency that actually took effect
+ */
+ResidencyReport make_compiled_tables_resident(const ResidencyOptions& options = ResidencyOptions());
+
+/*!
+ * \brief Copy of the coefficient tables held in storage with the requested residency
+ *
+ * \details The tables are copied into a single anonymous mapping, which is created on explicit huge pages, advised for
+ * transparent huge pages, or left on regular pages, and then made read-only. Copying the coefficients touches every page,
+ * so the copy is always prefaulted. Pass get_tables() to the instance-based evaluators, e.g.
+ *
+ *     ResidentTables resident(ResidencyOptions{HugePageMode::Transparent, true, true, true});
+ *     std::cout << resident.get_report().to_string() << "\n";
+ *     EphemerisContext context(resident.get_tables());
+ */
+class ResidentTables {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Copy the tables into storage with the requested residency
+         *
+         * \param options Requested residency
+         * \param source Tables to copy
+         *
+         * \throws std::runtime_error If the requested huge page mode is unavailable and options.fall_back is false
+         * \throws std::bad_alloc If no storage could be mapped at all
+         */
+        explicit ResidentTables(const ResidencyOptions& options = ResidencyOptions(),
+                                const EphemerisTableSet& source = EphemerisTableSet::get_compiled_in());
+
+        //! Unmap the storage
+        ~ResidentTables();
+
+        //! Delete the copy constructor, since the views point into the owned storage
+        ResidentTables(const ResidentTables&) = delete;
+
+        //! Delete the copy assignment operator, since the views point into the owned storage
+        ResidentTables& operator=(const ResidentTables&) = delete;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return the views of the copied tables
+        const EphemerisTableSet& get_tables() const {
+            return tables_;
+        }
+
+        //! Return the residency that actually took effect
+        const ResidencyReport& get_report() const {
+            return report_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Start of the mapping
+        void* map_base_;
+
+        //! Length of the mapping [bytes]
+        size_t map_length_;
+
+        //! Views of the copied tables
+        EphemerisTableSet tables_;
+
+        //! Residency that actually took effect
+        ResidencyReport report_;
+
+        //! Registrations of the copied tables with get_memory_footprint()
+        std::array<TableRegistration, 4> registrations_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef JPL_EPHEMERIS_PARALLEL_PARALLEL_INCLUDES_HPP
+#define JPL_EPHEMERIS_PARALLEL_PARALLEL_INCLUDES_HPP
+
+/*!
+ * \file jpl_ephemeris/parallel/parallel_includes.hpp
+ * \brief Include files for the parallel directory
+ */
+
+#include "jpl_ephemeris/parallel/thread_pool.hpp"
+
+#endif
@@ -0,0 +1,156 @@
+#include "thread_pool.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+
+namespace jpl_ephemeris {
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+ThreadPool::ThreadPool(unsigned int num_threads) :
+    num_threads_(num_threads), blocks_(), workers_(), run_mutex_(), mutex_(), start_cv_(), done_cv_(), generation_(0),
+    active_(0), stop_(false), task_(nullptr), error_(), failed_(false) {
+
+    if (num_threads_ == 0) {
+        num_threads_ = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    for (unsigned int id = 0; id < num_threads_; id++) {
+        blocks_.push_back(std::make_unique<TaskBlock>());
+    }
+
+    // The calling thread is thread 0, so only start the remaining workers
+    for (unsigned int id = 1; id < num_threads_; id++) {
+        workers_.emplace_back(&ThreadPool::worker_loop, this, id);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void ThreadPool::run(size_t num_tasks, const std::function<void(size_t)>& task) {
+    if (num_tasks == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    // Hand each thread a contiguous block of tasks
+    for (unsigned int id = 0; id < num_threads_; id++) {
+        std::lock_guard<std::mutex> lock(blocks_[id]->mutex);
+        blocks_[id]->begin = num_tasks * id / num_threads_;
+        blocks_[id]->end   = num_tasks * (id + 1) / num_threads_;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_   = &task;
+        error_  = nullptr;
+        failed_ = false;
+        active_ = static_cast<unsigned int>(workers_.size());
+        generation_++;
+    }
+    start_cv_.notify_all();
+
+    execute(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return active_ == 0; });
+    task_ = nullptr;
+
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ThreadPool::worker_loop(unsigned int id) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [&]() { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+
+        execute(id);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            active_--;
+        }
+        done_cv_.notify_one();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void ThreadPool::execute(unsigned int id) {
+    const std::function<void(size_t)>& task = *task_;
+
+    size_t ind = 0;
+    while (pop_front(id, ind) || steal_back(id, ind)) {
+        // Drain the remaining tasks without running them once a task has thrown
+        if (failed_) {
+            continue;
+        }
+
+        try {
+            task(ind);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+            failed_ = true;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool ThreadPool::pop_front(unsigned int id, size_t& task) {
+    TaskBlock& block = *blocks_[id];
+    std::lock_guard<std::mutex> lock(block.mutex);
+    if (block.begin >= block.end) {
+        return false;
+    }
+    task = block.begin++;
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool ThreadPool::steal_back(unsigned int id, size_t& task) {
+    for (unsigned int offset = 1; offset < num_threads_; offset++) {
+        TaskBlock& block = *blocks_[(id + offset) % num_threads_];
+        std::lock_guard<std::mutex> lock(block.mutex);
+        if (block.begin < block.end) {
+            task = --block.end;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,151 @@
+#ifndef JPL_EPHEMERIS_PARALLEL_THREAD_POOL_HPP
+#define JPL_EPHEMERIS_PARALLEL_THREAD_POOL_HPP
+
+/*!
+ * \file jpl_ephemeris/parallel/thread_pool.hpp
+ * \brief Fixed-size work-stealing thread pool for running a set of indexed tasks
+ */
+
+// Standard Library Includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Fixed-size work-stealing thread pool for running a set of indexed tasks
+ *
+ * \details Each call to run() splits the task indices 0..num_tasks-1 into one contiguous block per thread. A thread works
+ * through its own block from the front, so neighbouring tasks (e.g. neighbouring granules) stay on the same core, and
+ * once its block is empty it steals single tasks from the back of the other blocks. The calling thread takes part in the
+ * work, so a pool of N threads starts N - 1 workers.
+ */
+class ThreadPool {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Start the worker threads
+         *
+         * \param num_threads Total number of threads, including the calling thread. Zero uses the number of hardware
+         *     threads.
+         */
+        explicit ThreadPool(unsigned int num_threads = 0);
+
+        //! Stop and join the worker threads
+        ~ThreadPool();
+
+        //! Delete the copy constructor
+        ThreadPool(const ThreadPool&) = delete;
+
+        //! Delete the copy assignment operator
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Run task(0), ..., task(num_tasks - 1) across the pool, and return once all of them have completed
+         *
+         * \details Calls from different threads are serialized. If any task throws, the remaining tasks are skipped and the
+         * first exception is rethrown on the calling thread.
+         *
+         * \param num_tasks Number of tasks
+         * \param task Function called with the index of each task
+         */
+        void run(size_t num_tasks, const std::function<void(size_t)>& task);
+
+        //! Return the total number of threads, including the calling thread
+        unsigned int get_num_threads() const {
+            return num_threads_;
+        }
+
+    private:
+
+        //! Block of task indices [begin, end) owned by one thread
+        struct TaskBlock {
+            //! Protects begin and end
+            std::mutex mutex{};
+
+            //! Next task index taken by the owner
+            size_t begin = 0;
+
+            //! One past the last task index, decremented by thieves
+            size_t end = 0;
+        };
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Main loop of a worker thread
+        void worker_loop(unsigned int id);
+
+        //! Run tasks from the thread's own block, and then steal from the other blocks until none remain
+        void execute(unsigned int id);
+
+        //! Take the next task from the front of a block
+        bool pop_front(unsigned int id, size_t& task);
+
+        //! Take the last task from the back of a block
+        bool steal_back(unsigned int id, size_t& task);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Total number of threads, including the calling thread
+        unsigned int num_threads_;
+
+        //! Task blocks, one per thread (index 0 belongs to the calling thread)
+        std::vector<std::unique_ptr<TaskBlock>> blocks_;
+
+        //! Worker threads
+        std::vector<std::thread> workers_;
+
+        //! Serializes calls to run()
+        std::mutex run_mutex_;
+
+        //! Protects the state shared with the workers
+        std::mutex mutex_;
+
+        //! Signals the workers that a new generation of tasks, or a stop, is available
+        std::condition_variable start_cv_;
+
+        //! Signals run() that all of the workers have finished the current generation
+        std::condition_variable done_cv_;
+
+        //! Incremented every time run() publishes a set of tasks
+        uint64_t generation_;
+
+        //! Number of workers still running the current generation
+        unsigned int active_;
+
+        //! Set when the pool is being destroyed
+        bool stop_;
+
+        //! Task of the current generation
+        const std::function<void(size_t)>* task_;
+
+        //! First exception thrown by a task of the current generation
+        std::exception_ptr error_;
+
+        //! Set once a task has thrown, so the remaining tasks are skipped
+        std::atomic<bool> failed_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
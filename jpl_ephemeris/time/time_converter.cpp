@@ -0,0 +1,335 @@
+#include "time_converter.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_ascii_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_normalized_eval.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_roots.hpp"
+#include "jpl_ephemeris/chebyshev/chebyshev_util.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of seconds per day
+constexpr double SEC_PER_DAY = 86400.0;
+
+//! TT - TAI [s]
+constexpr double TT_MINUS_TAI = 32.184;
+
+//! Number of days covered by each polynomial of the fitted table
+constexpr double FIT_DAYS_PER_POLY = 32.0;
+
+//! Number of coefficients per polynomial of the fitted table
+constexpr size_t FIT_NUM_COEFF = 10;
+
+//! Largest number of coefficients per polynomial supported by the kernel table
+constexpr size_t MAX_NUM_COEFF = 32;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return TDB - TT [s] from the series of USNO Circular 179, Eq. 2.6
+double get_tdb_minus_tt_series(double mjdj2k_tt) {
+    const double T = mjdj2k_tt / 36525.0;
+    return 0.001657 * std::sin(628.3076 * T + 6.2401) + 0.000022 * std::sin(575.3385 * T + 4.2970)
+           + 0.000014 * std::sin(1256.6152 * T + 6.1969) + 0.000005 * std::sin(606.9777 * T + 4.0212)
+           + 0.000005 * std::sin(52.9691 * T + 0.4444) + 0.000002 * std::sin(21.3299 * T + 5.5431)
+           + 0.000010 * T * std::sin(628.3076 * T + 4.2490);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Fit the series to Chebyshev polynomials over the range covered by all of the compiled-in tables
+std::vector<double> fit_series_table() {
+    double start = -1e300, stop = 1e300;
+    for (const EphemerisTableView& view : EphemerisTableSet::get_compiled_in().get_views()) {
+        start = std::max(start, view.start_mjdj2k);
+        stop  = std::min(stop, view.stop_mjdj2k);
+    }
+
+    const size_t num_granules = static_cast<size_t>(std::ceil((stop - start) / FIT_DAYS_PER_POLY));
+    std::vector<double> table;
+    table.reserve(num_granules * (FIT_NUM_COEFF + 2));
+    for (size_t k = 0; k < num_granules; k++) {
+        const double lb = start + FIT_DAYS_PER_POLY * static_cast<double>(k);
+        const double ub = lb + FIT_DAYS_PER_POLY;
+
+        std::array<double, FIT_NUM_COEFF> values{};
+        for (size_t j = 0; j < FIT_NUM_COEFF; j++) {
+            values[j] = -get_tdb_minus_tt_series(
+                transform_from_chebyshev_range(chebyshev_lobatto_point<FIT_NUM_COEFF>(j), lb, ub));
+        }
+
+        std::array<double, FIT_NUM_COEFF> coeff{};
+        chebyshev_lobatto_coefficients<FIT_NUM_COEFF>(values, coeff);
+
+        table.push_back(lb);
+        table.push_back(ub);
+        table.insert(table.end(), coeff.begin(), coeff.end());
+    }
+    return table;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+TimeConverter::TimeConverter() : TimeConverter(fit_series_table(), FIT_NUM_COEFF + 2) {}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TimeConverter::TimeConverter(std::vector<double> table, unsigned int row_size) :
+    table_(std::move(table)), row_size_(row_size), num_granules_(0), start_mjdj2k_(0.), stop_mjdj2k_(0.),
+    days_per_poly_(0.), apply_(nullptr), leap_seconds_(get_default_leap_seconds()) {
+    if (row_size_ < 3 || row_size_ - 2 > MAX_NUM_COEFF) {
+        throw std::invalid_argument("TimeConverter() - Unsupported number of coefficients per polynomial.");
+    }
+
+    if (table_.empty() || table_.size() % row_size_ != 0) {
+        throw std::invalid_argument("TimeConverter() - The table must contain a whole, non-zero number of rows.");
+    }
+
+    num_granules_  = static_cast<unsigned int>(table_.size() / row_size_);
+    start_mjdj2k_  = table_[0];
+    stop_mjdj2k_   = table_[(num_granules_ - 1) * row_size_ + 1];
+    days_per_poly_ = table_[1] - table_[0];
+    apply_         = get_kernels(std::make_index_sequence<MAX_NUM_COEFF>{})[row_size_ - 3];
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TimeConverter TimeConverter::from_de_ascii(const std::string& header_file, const std::vector<std::string>& data_files) {
+    DEAsciiTable de_table = DEAsciiTable::load(header_file, data_files, DEAsciiTable::TT_MINUS_TDB_COLUMN, 1);
+
+    const EphemerisTableView& view = de_table.get_view();
+    const double* first_row        = view.get_row(0, 0);
+    std::vector<double> table(first_row, first_row + static_cast<size_t>(view.num_granules) * view.row_size);
+    return TimeConverter(std::move(table), view.row_size);
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+double TimeConverter::get_tt_minus_tdb(double mjdj2k_tdb) const {
+    double tt_minus_tdb = 0.;
+    apply_(*this, &mjdj2k_tdb, 1, &tt_minus_tdb, 0., 1.);
+    return tt_minus_tdb;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::tdb_from_tt(double mjdj2k_tt) const {
+    double mjdj2k_tdb = 0.;
+    tdb_from_tt(&mjdj2k_tt, 1, &mjdj2k_tdb);
+    return mjdj2k_tdb;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::tt_from_tdb(double mjdj2k_tdb) const {
+    double mjdj2k_tt = 0.;
+    tt_from_tdb(&mjdj2k_tdb, 1, &mjdj2k_tt);
+    return mjdj2k_tt;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::tdb_from_utc(double mjdj2k_utc) const {
+    double mjdj2k_tdb = 0.;
+    tdb_from_utc(&mjdj2k_utc, 1, &mjdj2k_tdb);
+    return mjdj2k_tdb;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::utc_from_tdb(double mjdj2k_tdb) const {
+    double mjdj2k_utc = 0.;
+    utc_from_tdb(&mjdj2k_tdb, 1, &mjdj2k_utc);
+    return mjdj2k_utc;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TimeConverter::tdb_from_tt(const double* mjdj2k_tt, size_t num_epochs, double* mjdj2k_tdb) const {
+    // Evaluating the table at TT in place of TDB is off by d(TT - TDB)/dt * (TT - TDB) ~ 1e-12 s
+    apply_(*this, mjdj2k_tt, num_epochs, mjdj2k_tdb, 1., -1. / SEC_PER_DAY);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TimeConverter::tt_from_tdb(const double* mjdj2k_tdb, size_t num_epochs, double* mjdj2k_tt) const {
+    apply_(*this, mjdj2k_tdb, num_epochs, mjdj2k_tt, 1., 1. / SEC_PER_DAY);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TimeConverter::tdb_from_utc(const double* mjdj2k_utc, size_t num_epochs, double* mjdj2k_tdb) const {
+    // TT = UTC + (TAI - UTC) + (TT - TAI), keeping the leap second interval [lower, upper) of the previous epoch
+    double lower = 1., upper = 0., offset = 0.;
+    for (size_t i = 0; i < num_epochs; i++) {
+        const double mjdj2k = mjdj2k_utc[i];
+        if (!(mjdj2k >= lower && mjdj2k < upper)) {
+            auto it = std::upper_bound(leap_seconds_.begin(), leap_seconds_.end(), mjdj2k,
+                                       [](double val, const LeapSecond& leap) { return val < leap.mjdj2k_utc; });
+            if (it == leap_seconds_.begin()) {
+                throw std::out_of_range("TimeConverter::tdb_from_utc() - Value provided for mjdj2k_utc is before the "
+                                        "first leap second.");
+            }
+
+            offset = (std::prev(it)->tai_minus_utc + TT_MINUS_TAI) / SEC_PER_DAY;
+            lower  = std::prev(it)->mjdj2k_utc;
+            upper = it == leap_seconds_.end() ? std::numeric_limits<double>::infinity() : it->mjdj2k_utc;
+        }
+        mjdj2k_tdb[i] = mjdj2k + offset;
+    }
+
+    tdb_from_tt(mjdj2k_tdb, num_epochs, mjdj2k_tdb);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TimeConverter::utc_from_tdb(const double* mjdj2k_tdb, size_t num_epochs, double* mjdj2k_utc) const {
+    tt_from_tdb(mjdj2k_tdb, num_epochs, mjdj2k_utc);
+
+    // UTC = TAI - (TAI - UTC), where leap second k takes effect at TAI = UTC_k + (TAI - UTC)_k
+    auto get_start_tai = [](const LeapSecond& leap) { return leap.mjdj2k_utc + leap.tai_minus_utc / SEC_PER_DAY; };
+    double lower = 1., upper = 0., offset = 0.;
+    for (size_t i = 0; i < num_epochs; i++) {
+        const double mjdj2k_tai = mjdj2k_utc[i] - TT_MINUS_TAI / SEC_PER_DAY;
+        if (!(mjdj2k_tai >= lower && mjdj2k_tai < upper)) {
+            auto it = std::upper_bound(leap_seconds_.begin(), leap_seconds_.end(), mjdj2k_tai,
+                                       [&](double val, const LeapSecond& leap) { return val < get_start_tai(leap); });
+            if (it == leap_seconds_.begin()) {
+                throw std::out_of_range("TimeConverter::utc_from_tdb() - Value provided for mjdj2k_tdb is before the "
+                                        "first leap second.");
+            }
+
+            offset = std::prev(it)->tai_minus_utc / SEC_PER_DAY;
+            lower  = get_start_tai(*std::prev(it));
+            upper  = it == leap_seconds_.end() ? std::numeric_limits<double>::infinity() : get_start_tai(*it);
+        }
+        mjdj2k_utc[i] = mjdj2k_tai - offset;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::get_tai_minus_utc(double mjdj2k_utc) const {
+    auto it = std::upper_bound(leap_seconds_.begin(), leap_seconds_.end(), mjdj2k_utc,
+                               [](double val, const LeapSecond& leap) { return val < leap.mjdj2k_utc; });
+    if (it == leap_seconds_.begin()) {
+        throw std::out_of_range("TimeConverter::get_tai_minus_utc() - Value provided for mjdj2k_utc is before the first "
+                                "leap second.");
+    }
+    return std::prev(it)->tai_minus_utc;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TimeConverter::set_leap_seconds(const std::vector<LeapSecond>& leap_seconds) {
+    if (leap_seconds.empty()) {
+        throw std::invalid_argument("TimeConverter::set_leap_seconds() - At least one leap second must be provided.");
+    }
+
+    for (size_t i = 1; i < leap_seconds.size(); i++) {
+        if (!(leap_seconds[i].mjdj2k_utc > leap_seconds[i - 1].mjdj2k_utc)) {
+            throw std::invalid_argument("TimeConverter::set_leap_seconds() - The leap seconds must be in increasing order "
+                                        "of time.");
+        }
+    }
+
+    leap_seconds_ = leap_seconds;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+const std::vector<LeapSecond>& TimeConverter::get_leap_seconds() const {
+    return leap_seconds_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<LeapSecond> TimeConverter::get_default_leap_seconds() {
+    // Modified Julian Dates (0h UTC) of each leap second, and TAI - UTC from then on
+    static const std::array<std::pair<double, double>, 28> table{{
+        {41317., 10.}, {41499., 11.}, {41683., 12.}, {42048., 13.}, {42413., 14.}, {42778., 15.}, {43144., 16.},
+        {43509., 17.}, {43874., 18.}, {44239., 19.}, {44786., 20.}, {45151., 21.}, {45516., 22.}, {46247., 23.},
+        {47161., 24.}, {47892., 25.}, {48257., 26.}, {48804., 27.}, {49169., 28.}, {49534., 29.}, {50083., 30.},
+        {50630., 31.}, {51179., 32.}, {53736., 33.}, {54832., 34.}, {56109., 35.}, {57204., 36.}, {57754., 37.},
+    }};
+
+    // MJD 51544.5 is the J2000 Epoch
+    std::vector<LeapSecond> leap_seconds;
+    leap_seconds.reserve(table.size());
+    for (const std::pair<double, double>& entry : table) {
+        leap_seconds.push_back(LeapSecond{entry.first - 51544.5, entry.second});
+    }
+    return leap_seconds;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::get_start_mjdj2k() const {
+    return start_mjdj2k_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double TimeConverter::get_stop_mjdj2k() const {
+    return stop_mjdj2k_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TimeConverter::get_index(double mjdj2k_tdb) const {
+    // The negated comparison also rejects NaN, which would otherwise produce an undefined index
+    if (!(mjdj2k_tdb >= start_mjdj2k_ && mjdj2k_tdb <= stop_mjdj2k_)) {
+        throw std::out_of_range("TimeConverter::get_index() - Value provided for mjdj2k is outside of the range covered "
+                                "by the TT - TDB table.");
+    }
+
+    unsigned int ind = static_cast<unsigned int>((mjdj2k_tdb - start_mjdj2k_) / days_per_poly_);
+    return ind < num_granules_ ? ind : num_granules_ - 1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+template<size_t NC>
+void TimeConverter::apply_tt_minus_tdb(const TimeConverter& converter, const double* in, size_t num_epochs, double* out,
+                                       double weight, double scale) {
+    // Keep the granule [lb, ub) of the previous epoch, so sorted epochs skip the lookup
+    const double* row = nullptr;
+    double lb = 1., ub = 0., mid = 0., inv_half_width = 0.;
+    for (size_t i = 0; i < num_epochs; i++) {
+        const double mjdj2k = in[i];
+        if (!(mjdj2k >= lb && mjdj2k < ub)) {
+            row            = converter.table_.data() + static_cast<size_t>(converter.get_index(mjdj2k)) * converter.row_size_;
+            lb             = row[0];
+            ub             = row[1];
+            mid            = 0.5 * (ub + lb);
+            inv_half_width = 2. / (ub - lb);
+        }
+        out[i] = weight * mjdj2k + scale * chebyshev_eval_normalized<NC>((mjdj2k - mid) * inv_half_width, row + 2);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+template<size_t... I>
+std::array<void (*)(const TimeConverter&, const double*, size_t, double*, double, double), sizeof...(I)>
+TimeConverter::get_kernels(std::index_sequence<I...>) {
+    return {&TimeConverter::apply_tt_minus_tdb<I + 1>...};
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,274 @@
+#ifndef JPL_EPHEMERIS_TIME_TIME_CONVERTER_HPP
+#define JPL_EPHEMERIS_TIME_TIME_CONVERTER_HPP
+
+/*!
+ * \file jpl_ephemeris/time/time_converter.hpp
+ * \brief Defines a class for converting epochs between the UTC, TT, and TDB time systems
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+//! Offset of TAI from UTC, in effect from the specified UTC epoch until the next leap second
+struct LeapSecond {
+    //! Modified Julian Date from the J2000 Epoch, in the UTC Time System, at which the offset takes effect
+    double mjdj2k_utc = 0.;
+
+    //! TAI - UTC [s]
+    double tai_minus_utc = 0.;
+};
+
+/*!
+ * \brief Defines a class for converting epochs between the UTC, TT, and TDB time systems
+ *
+ * \details TT - TDB is stored as a table of Chebyshev polynomials in TDB, with the same [lb, ub, c_0, ...] rows as the
+ * ephemeris tables, and evaluated with chebyshev_eval_normalized. A conversion costs one Chebyshev evaluation; TT to TDB
+ * evaluates the table at TT in place of TDB, which is off by d(TT - TDB)/dt * (TT - TDB) ~ 1e-12 s. The batch methods keep
+ * the current granule and leap second between epochs, so sorted epochs only pay for the evaluation.
+ *
+ * The table comes from one of two sources:
+ *  - from_de_ascii() loads the TT - TDB column that JPL integrates alongside the DE430t ephemeris (the de430t ASCII
+ *    files), which reproduces the integrated time ephemeris.
+ *  - The default constructor fits the table once, over the range of the compiled-in ephemeris tables, to the series of
+ *    USNO Circular 179, Eq. 2.6, which agrees with the integrated TT - TDB to about 10 us between 1600 and 2200.
+ *
+ * UTC is converted through TAI = UTC + leap seconds and TT = TAI + 32.184 s. The leap seconds default to the IERS table
+ * from 1972, and UTC before 1972 is rejected. Instances are immutable after construction apart from set_leap_seconds(),
+ * so one instance can be shared between threads, e.g.
+ *
+ *     TimeConverter time;
+ *     double mjdj2k_tdb = time.tdb_from_utc(mjdj2k_utc);
+ */
+class TimeConverter {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create a converter whose table is fitted to the USNO Circular 179 series, over the range of the compiled-in tables
+        TimeConverter();
+
+        /*!
+         * \brief Create a converter from the TT - TDB column of the ASCII DE files
+         *
+         * \param header_file Path to the header file (e.g. header.430t)
+         * \param data_files Paths to the data files (e.g. ascp01950.430t, ascp02050.430t), in increasing order of time.
+         *     Blocks repeated at the end of one file and the start of the next are skipped.
+         *
+         * \return Converter whose table covers the data files
+         *
+         * \throws std::invalid_argument If a file cannot be read, the header has no TT - TDB coefficients (e.g. the plain
+         *     DE430 files), or the blocks are not contiguous
+         */
+        static TimeConverter from_de_ascii(const std::string& header_file, const std::vector<std::string>& data_files);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Return TT - TDB at the specified epoch
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch in the TDB Time System
+         *
+         * \return TT - TDB [s]
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        double get_tt_minus_tdb(double mjdj2k_tdb) const;
+
+        /*!
+         * \brief Convert an epoch from TT to TDB
+         *
+         * \param mjdj2k_tt Modified Julian Date from the J2000 Epoch in the TT Time System
+         *
+         * \return Modified Julian Date from the J2000 Epoch in the TDB Time System
+         *
+         * \throws std::out_of_range If the epoch is outside of the range covered by the table
+         */
+        double tdb_from_tt(double mjdj2k_tt) const;
+
+        /*!
+         * \brief Convert an epoch from TDB to TT
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch in the TDB Time System
+         *
+         * \return Modified Julian Date from the J2000 Epoch in the TT Time System
+         *
+         * \throws std::out_of_range If mjdj2k_tdb is outside of the range covered by the table
+         */
+        double tt_from_tdb(double mjdj2k_tdb) const;
+
+        /*!
+         * \brief Convert an epoch from UTC to TDB
+         *
+         * \param mjdj2k_utc Modified Julian Date from the J2000 Epoch in the UTC Time System
+         *
+         * \return Modified Julian Date from the J2000 Epoch in the TDB Time System
+         *
+         * \throws std::out_of_range If mjdj2k_utc is before the first leap second, or outside of the range covered by the
+         *     table
+         */
+        double tdb_from_utc(double mjdj2k_utc) const;
+
+        /*!
+         * \brief Convert an epoch from TDB to UTC
+         *
+         * \details An epoch inside a leap second has no UTC representation as a day count, and is mapped into the first
+         * second of the following day.
+         *
+         * \param mjdj2k_tdb Modified Julian Date from the J2000 Epoch in the TDB Time System
+         *
+         * \return Modified Julian Date from the J2000 Epoch in the UTC Time System
+         *
+         * \throws std::out_of_range If the epoch is before the first leap second, or outside of the range covered by the
+         *     table
+         */
+        double utc_from_tdb(double mjdj2k_tdb) const;
+
+        /*!
+         * \brief Convert a batch of epochs from TT to TDB
+         *
+         * \param mjdj2k_tt Epochs in the TT Time System
+         * \param num_epochs Number of epochs
+         * \param mjdj2k_tdb Output epochs in the TDB Time System, which may alias mjdj2k_tt
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void tdb_from_tt(const double* mjdj2k_tt, size_t num_epochs, double* mjdj2k_tdb) const;
+
+        /*!
+         * \brief Convert a batch of epochs from TDB to TT
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param mjdj2k_tt Output epochs in the TT Time System, which may alias mjdj2k_tdb
+         *
+         * \throws std::out_of_range If an epoch is outside of the range covered by the table
+         */
+        void tt_from_tdb(const double* mjdj2k_tdb, size_t num_epochs, double* mjdj2k_tt) const;
+
+        /*!
+         * \brief Convert a batch of epochs from UTC to TDB
+         *
+         * \param mjdj2k_utc Epochs in the UTC Time System
+         * \param num_epochs Number of epochs
+         * \param mjdj2k_tdb Output epochs in the TDB Time System, which may alias mjdj2k_utc
+         *
+         * \throws std::out_of_range If an epoch is before the first leap second, or outside of the range covered by the
+         *     table
+         */
+        void tdb_from_utc(const double* mjdj2k_utc, size_t num_epochs, double* mjdj2k_tdb) const;
+
+        /*!
+         * \brief Convert a batch of epochs from TDB to UTC
+         *
+         * \param mjdj2k_tdb Epochs in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param mjdj2k_utc Output epochs in the UTC Time System, which may alias mjdj2k_tdb
+         *
+         * \throws std::out_of_range If an epoch is before the first leap second, or outside of the range covered by the
+         *     table
+         */
+        void utc_from_tdb(const double* mjdj2k_tdb, size_t num_epochs, double* mjdj2k_utc) const;
+
+        /*!
+         * \brief Return TAI - UTC at the specified epoch
+         *
+         * \param mjdj2k_utc Modified Julian Date from the J2000 Epoch in the UTC Time System
+         *
+         * \return TAI - UTC [s]
+         *
+         * \throws std::out_of_range If mjdj2k_utc is before the first leap second
+         */
+        double get_tai_minus_utc(double mjdj2k_utc) const;
+
+        /*!
+         * \brief Replace the leap seconds, e.g. after the IERS announces a new one
+         *
+         * \param leap_seconds Leap seconds, in increasing order of time
+         *
+         * \throws std::invalid_argument If leap_seconds is empty or not in increasing order of time
+         */
+        void set_leap_seconds(const std::vector<LeapSecond>& leap_seconds);
+
+        //! Return the leap seconds used by this converter
+        const std::vector<LeapSecond>& get_leap_seconds() const;
+
+        //! Return the leap seconds of the IERS table (Bulletin C), from 1972-01-01 to 2017-01-01
+        static std::vector<LeapSecond> get_default_leap_seconds();
+
+        //! Return the first epoch covered by the table, in the TDB Time System
+        double get_start_mjdj2k() const;
+
+        //! Return the last epoch covered by the table, in the TDB Time System
+        double get_stop_mjdj2k() const;
+
+    private:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create a converter from rows of [lb, ub, c_0, ..., c_{row_size - 3}] on a uniform grid of granules
+        TimeConverter(std::vector<double> table, unsigned int row_size);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute out[i] = weight * in[i] + scale * (TT - TDB)(in[i]), with TT - TDB in seconds, with the kernel
+         * for NC coefficients
+         */
+        template<size_t NC>
+        static void apply_tt_minus_tdb(const TimeConverter& converter, const double* in, size_t num_epochs, double* out,
+                                       double weight, double scale);
+
+        //! Return apply_tt_minus_tdb() instantiated for 1..sizeof...(I) coefficients, indexed by the number of coefficients - 1
+        template<size_t... I>
+        static std::array<void (*)(const TimeConverter&, const double*, size_t, double*, double, double), sizeof...(I)>
+        get_kernels(std::index_sequence<I...>);
+
+        //! Return the granule index of the specified epoch in TDB
+        unsigned int get_index(double mjdj2k_tdb) const;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Rows of TT - TDB [s] coefficients, stored as [lb, ub, c_0, ..., c_{row_size - 3}]
+        std::vector<double> table_;
+
+        //! Number of values per row, including the lb and ub values
+        unsigned int row_size_;
+
+        //! Number of granules (rows)
+        unsigned int num_granules_;
+
+        //! Lower bound on MJD J2K in the TDB time system [days]
+        double start_mjdj2k_;
+
+        //! Upper bound on MJD J2K in the TDB time system [days]
+        double stop_mjdj2k_;
+
+        //! Number of days covered by each set of polynomial coefficients
+        double days_per_poly_;
+
+        //! apply_tt_minus_tdb() instantiated for the number of coefficients of the table
+        void (*apply_)(const TimeConverter&, const double*, size_t, double*, double, double);
+
+        //! Leap seconds, in increasing order of time
+        std::vector<LeapSecond> leap_seconds_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
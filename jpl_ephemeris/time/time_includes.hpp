@@ -0,0 +1,11 @@
+#ifndef JPL_EPHEMERIS_TIME_TIME_INCLUDES_HPP
+#define JPL_EPHEMERIS_TIME_TIME_INCLUDES_HPP
+
+/*!
+ * \file jpl_ephemeris/time/time_includes.hpp
+ * \brief Include files for the time directory
+ */
+
+#include "jpl_ephemeris/time/time_converter.hpp"
+
+#endif
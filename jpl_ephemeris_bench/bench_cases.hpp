@@ -0,0 +1,162 @@
+#ifndef JPL_EPHEMERIS_BENCH_BENCH_CASES_HPP
+#define JPL_EPHEMERIS_BENCH_BENCH_CASES_HPP
+
+/*!
+ * \file jpl_ephemeris_bench/bench_cases.hpp
+ * \brief APIs measured by jpl_ephemeris_bench and jpl_ephemeris_latency
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/earth.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_emb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/earth_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/emb_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/sun_from_ssb_gcrf_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/moon.hpp"
+#include "jpl_ephemeris/celestial_bodies/sun.hpp"
+
+namespace jpl_ephemeris {
+
+//! Bodies and their names, as used in the names of the cases
+inline constexpr std::array<std::pair<CentralBody, const char*>, 4> BENCH_BODIES{{
+    {CentralBody::SSB, "SSB"},
+    {CentralBody::Sun, "Sun"},
+    {CentralBody::Earth, "Earth"},
+    {CentralBody::Moon, "Moon"},
+}};
+
+//! Spacing of the sequential epochs, one minute [days]
+inline constexpr double BENCH_SEQUENTIAL_STEP = 1.0 / 1440.0;
+
+/*!
+ * \brief Return epochs within the span of the compiled-in tables, either sequential or uniformly random
+ *
+ * \details Sequential epochs are BENCH_SEQUENTIAL_STEP apart from a random start. When they would not fit within the
+ * span of the tables, random epochs are returned instead.
+ *
+ * \param sequential Whether the epochs are sequential
+ * \param count Number of epochs
+ * \param seed Seed of the random number generator
+ *
+ * \return Epochs in the TDB Time System
+ */
+inline std::vector<double> make_bench_epochs(bool sequential, size_t count, uint64_t seed) {
+    // The Moon table has the shortest granules, and covers the same span as the others
+    const EphemerisTableView moon = EphemerisTableSet::get_compiled_in().moon;
+    const double span             = static_cast<double>(count) * BENCH_SEQUENTIAL_STEP;
+
+    std::mt19937_64 rng(seed);
+    std::vector<double> epochs(count);
+    if (sequential && span < moon.stop_mjdj2k - moon.start_mjdj2k) {
+        std::uniform_real_distribution<double> dist(moon.start_mjdj2k, moon.stop_mjdj2k - span);
+        const double start = dist(rng);
+        for (size_t i = 0; i < count; i++) {
+            epochs[i] = start + static_cast<double>(i) * BENCH_SEQUENTIAL_STEP;
+        }
+    } else {
+        std::uniform_real_distribution<double> dist(moon.start_mjdj2k, moon.stop_mjdj2k);
+        for (double& t : epochs) {
+            t = dist(rng);
+        }
+    }
+    return epochs;
+}
+
+/*!
+ * \brief Call visit(api, target, central_body, quantity, eval, reset) for every measured API
+ *
+ * \details The APIs are the compiled-in tables ("table"), the Sun, Earth, and Moon classes ("body"), and EphemerisContext
+ * ("context"), for every central body other than the target, and for position, velocity, and state. eval is a callable
+ * of a distinct type per case, which takes the epoch and returns a std::array, so the caller can instantiate its timing
+ * loop around it. The "state" of the table and body APIs is a get_position() call followed by a get_velocity() call,
+ * which is what callers of those APIs do. reset is empty, except for the context cases, where it recreates the
+ * EphemerisContext so its granule caches start cold. Every call creates new contexts, so each thread that measures needs
+ * its own set of cases.
+ *
+ * \tparam Visitor Callable taking (const char*, const char*, const char*, const char*, Eval, std::function<void()>)
+ */
+template<class Visitor>
+void visit_bench_cases(Visitor&& visit) {
+    // Visit the position, velocity, and state cases of a static class
+    auto visit_static = [&](const char* api, const char* target, const char* central_body, auto position, auto velocity) {
+        auto state = [position, velocity](double t) {
+            const std::array<double, 3> pos = position(t);
+            const std::array<double, 3> vel = velocity(t);
+            return std::array<double, 6>{pos[0], pos[1], pos[2], vel[0], vel[1], vel[2]};
+        };
+        visit(api, target, central_body, "position", position, std::function<void()>());
+        visit(api, target, central_body, "velocity", velocity, std::function<void()>());
+        visit(api, target, central_body, "state", state, std::function<void()>());
+    };
+
+    // Tables
+    visit_static("table", "Sun", "SSB", SunFromSSBGCRFTable::get_position, SunFromSSBGCRFTable::get_velocity);
+    visit_static("table", "EMB", "SSB", EMBFromSSBGCRFTable::get_position, EMBFromSSBGCRFTable::get_velocity);
+    visit_static("table", "Earth", "EMB", EarthFromEMBGCRFTable::get_position, EarthFromEMBGCRFTable::get_velocity);
+    visit_static("table", "Earth", "SSB", EarthFromSSBGCRFTable::get_position, EarthFromSSBGCRFTable::get_velocity);
+    visit_static("table", "Moon", "Earth", MoonGCRFTable::get_position, MoonGCRFTable::get_velocity);
+
+    // Sun, Earth, and Moon classes, for every central body other than the target
+    for (const auto& [central_body, central_name] : BENCH_BODIES) {
+        if (central_body != CentralBody::Sun) {
+            visit_static("body", "Sun", central_name, [central_body](double t) { return Sun::get_position(t, central_body); },
+                         [central_body](double t) { return Sun::get_velocity(t, central_body); });
+        }
+        if (central_body != CentralBody::Earth) {
+            visit_static("body", "Earth", central_name,
+                         [central_body](double t) { return Earth::get_position(t, central_body); },
+                         [central_body](double t) { return Earth::get_velocity(t, central_body); });
+        }
+        if (central_body != CentralBody::Moon) {
+            visit_static("body", "Moon", central_name,
+                         [central_body](double t) { return Moon::get_position(t, central_body); },
+                         [central_body](double t) { return Moon::get_velocity(t, central_body); });
+        }
+    }
+
+    // EphemerisContext, whose granule caches are recreated by reset
+    for (const auto& [target, target_name] : BENCH_BODIES) {
+        if (target == CentralBody::SSB) {
+            continue;
+        }
+
+        for (const auto& [central_body, central_name] : BENCH_BODIES) {
+            if (central_body == target) {
+                continue;
+            }
+
+            auto context = std::make_shared<EphemerisContext>(EphemerisTableSet::get_compiled_in());
+            std::function<void()> reset = [context]() {
+                *context = EphemerisContext(EphemerisTableSet::get_compiled_in());
+            };
+
+            visit("context", target_name, central_name, "position",
+                  [context, target, central_body](double t) { return context->get_position(target, t, central_body); },
+                  reset);
+            visit("context", target_name, central_name, "velocity",
+                  [context, target, central_body](double t) { return context->get_velocity(target, t, central_body); },
+                  reset);
+            visit("context", target_name, central_name, "state",
+                  [context, target, central_body](double t) { return context->get_state(target, t, central_body); },
+                  reset);
+        }
+    }
+}
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,193 @@
+#include "benchmark_suite.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris_bench/bench_cases.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Keeps the compiler from discarding the evaluations
+volatile double sink = 0.;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return a batch function that evaluates the callable at every epoch, summing the first component of each output
+template<class Eval>
+std::function<double(const double*, size_t)> make_batch(Eval eval) {
+    return [eval](const double* epochs, size_t count) {
+        double sum = 0.;
+        for (size_t i = 0; i < count; i++) {
+            sum += eval(epochs[i])[0];
+        }
+        return sum;
+    };
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Write a string as a JSON value; the names of the suite never need escaping
+void write_string(std::ostream& out, const std::string& value) {
+    out << '"' << value << '"';
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+BenchmarkSuite::BenchmarkSuite(BenchmarkOptions options) : options_(std::move(options)), evict_buffer_() {
+    if (options_.batch_size == 0 || options_.repetitions == 0 || options_.cold_batch_size == 0
+        || options_.cold_repetitions == 0) {
+        throw std::invalid_argument("BenchmarkSuite() - Batch sizes and numbers of repetitions must be greater than zero.");
+    }
+    evict_buffer_.assign(options_.evict_mib * 1024 * 1024 / sizeof(uint64_t), 1);
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::vector<BenchmarkResult> BenchmarkSuite::run(std::ostream* progress) {
+    std::vector<Case> cases = make_cases();
+
+    std::vector<BenchmarkResult> results;
+    for (const Case& test : cases) {
+        const std::string name = test.api + "/" + test.target + "/" + test.central_body + "/" + test.quantity;
+        if (name.find(options_.filter) == std::string::npos) {
+            continue;
+        }
+        if (progress != nullptr) {
+            *progress << name << std::endl;
+        }
+
+        for (bool sequential : {true, false}) {
+            // Every case sees the same epochs, so the results of different cases can be compared
+            const std::vector<double> warm_epochs = make_bench_epochs(sequential, options_.batch_size, options_.seed);
+            const std::vector<double> cold_epochs = make_bench_epochs(sequential, options_.cold_batch_size, options_.seed + 1);
+            results.push_back(time_case(test, cold_epochs, sequential, true));
+            results.push_back(time_case(test, warm_epochs, sequential, false));
+        }
+    }
+    return results;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkSuite::write_json(const std::vector<BenchmarkResult>& results, std::ostream& out) const {
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"benchmark\": \"jpl_ephemeris_bench\",\n";
+    out << "  \"label\": ";
+    write_string(out, options_.label);
+    out << ",\n";
+#ifdef __VERSION__
+    out << "  \"compiler\": ";
+    write_string(out, __VERSION__);
+    out << ",\n";
+#endif
+    out << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    out << "  \"options\": {\"batch_size\": " << options_.batch_size << ", \"repetitions\": " << options_.repetitions
+        << ", \"cold_batch_size\": " << options_.cold_batch_size << ", \"cold_repetitions\": " << options_.cold_repetitions
+        << ", \"evict_mib\": " << options_.evict_mib << ", \"seed\": " << options_.seed << "},\n";
+    out << "  \"results\": [";
+
+    for (size_t k = 0; k < results.size(); k++) {
+        const BenchmarkResult& res = results[k];
+        out << (k == 0 ? "\n" : ",\n") << "    {\"api\": ";
+        write_string(out, res.api);
+        out << ", \"target\": ";
+        write_string(out, res.target);
+        out << ", \"central_body\": ";
+        write_string(out, res.central_body);
+        out << ", \"quantity\": ";
+        write_string(out, res.quantity);
+        out << ", \"epochs\": ";
+        write_string(out, res.epochs);
+        out << ", \"cache\": ";
+        write_string(out, res.cache);
+        out << ", \"calls\": " << res.calls << ", \"repetitions\": " << res.repetitions << ", \"ns_per_call\": {\"min\": "
+            << res.min_ns << ", \"median\": " << res.median_ns << ", \"mean\": " << res.mean_ns << "}}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<BenchmarkSuite::Case> BenchmarkSuite::make_cases() const {
+    std::vector<Case> cases;
+    visit_bench_cases([&](const char* api, const char* target, const char* central_body, const char* quantity, auto eval,
+                          std::function<void()> reset) {
+        cases.push_back(Case{api, target, central_body, quantity, make_batch(eval), std::move(reset)});
+    });
+    return cases;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+BenchmarkResult BenchmarkSuite::time_case(const Case& test, const std::vector<double>& epochs, bool sequential,
+                                          bool cold) {
+    const size_t repetitions = cold ? options_.cold_repetitions : options_.repetitions;
+
+    if (!cold) {
+        sink = sink + test.eval(epochs.data(), epochs.size());
+    }
+
+    std::vector<double> ns_per_call(repetitions);
+    for (double& val : ns_per_call) {
+        if (cold) {
+            if (test.reset) {
+                test.reset();
+            }
+            evict();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        sink       = sink + test.eval(epochs.data(), epochs.size());
+        auto stop  = std::chrono::steady_clock::now();
+        val = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(epochs.size());
+    }
+
+    BenchmarkResult res;
+    res.api          = test.api;
+    res.target       = test.target;
+    res.central_body = test.central_body;
+    res.quantity     = test.quantity;
+    res.epochs       = sequential ? "sequential" : "random";
+    res.cache        = cold ? "cold" : "warm";
+    res.calls        = epochs.size();
+    res.repetitions  = repetitions;
+
+    double sum = 0.;
+    for (double val : ns_per_call) {
+        sum += val;
+    }
+    res.mean_ns = sum / static_cast<double>(repetitions);
+
+    std::sort(ns_per_call.begin(), ns_per_call.end());
+    res.min_ns    = ns_per_call.front();
+    res.median_ns = ns_per_call[repetitions / 2];
+    return res;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkSuite::evict() {
+    // One read per cache line is enough to displace the previous contents
+    uint64_t sum = 0;
+    for (size_t i = 0; i < evict_buffer_.size(); i += 8) {
+        sum += evict_buffer_[i];
+    }
+    sink = sink + static_cast<double>(sum);
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,170 @@
+#ifndef JPL_EPHEMERIS_BENCH_BENCHMARK_SUITE_HPP
+#define JPL_EPHEMERIS_BENCH_BENCHMARK_SUITE_HPP
+
+/*!
+ * \file jpl_ephemeris_bench/benchmark_suite.hpp
+ * \brief Microbenchmark suite of the tables, the Sun, Earth, and Moon classes, and EphemerisContext
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+//! Settings of a BenchmarkSuite run
+struct BenchmarkOptions {
+    //! Number of epochs per timed pass with a warm cache
+    size_t batch_size = 4096;
+
+    //! Number of timed passes with a warm cache
+    size_t repetitions = 20;
+
+    //! Number of epochs per timed pass with a cold cache
+    size_t cold_batch_size = 64;
+
+    //! Number of timed passes with a cold cache
+    size_t cold_repetitions = 30;
+
+    //! Size of the buffer read between cold passes to evict the tables from the CPU caches [MiB]
+    size_t evict_mib = 32;
+
+    //! Seed of the random epochs
+    uint64_t seed = 42;
+
+    //! Only run the cases whose name (e.g. "context/Moon/Earth/state") contains this string
+    std::string filter{};
+
+    //! Free-form label copied to the output, e.g. a version or commit
+    std::string label{};
+};
+
+//! Timing of one case, epoch pattern, and cache state
+struct BenchmarkResult {
+    //! API measured: "table", "body" (the Sun, Earth, and Moon classes), or "context" (EphemerisContext)
+    std::string api{};
+
+    //! Target body
+    std::string target{};
+
+    //! Central body
+    std::string central_body{};
+
+    //! Quantity evaluated: "position", "velocity", or "state"
+    std::string quantity{};
+
+    //! Epoch pattern: "sequential" or "random"
+    std::string epochs{};
+
+    //! Cache state: "cold" or "warm"
+    std::string cache{};
+
+    //! Number of calls per timed pass
+    size_t calls = 0;
+
+    //! Number of timed passes
+    size_t repetitions = 0;
+
+    //! Fastest pass [ns per call]
+    double min_ns = 0.;
+
+    //! Median pass [ns per call]
+    double median_ns = 0.;
+
+    //! Mean of the passes [ns per call]
+    double mean_ns = 0.;
+};
+
+/*!
+ * \brief Microbenchmark suite of the tables, the Sun, Earth, and Moon classes, and EphemerisContext
+ *
+ * \details Every case (API, target, central body, and quantity) is timed on two epoch patterns: sequential epochs one
+ * minute apart, as a propagator would query, and epochs drawn uniformly over the whole range of the tables. Each pattern
+ * is timed with a warm cache, where the batch is run once before the timed passes, and with a cold cache, where a buffer
+ * larger than the last-level cache is read and every EphemerisContext is recreated before each timed pass. Passes are
+ * timed as a whole, so the clock overhead is spread over the batch. The "state" of the table and body APIs is a
+ * get_position() call followed by a get_velocity() call, which is what callers of those APIs do.
+ */
+class BenchmarkSuite {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create the suite
+         *
+         * \param options Settings of the run
+         *
+         * \throws std::invalid_argument If a batch size or number of repetitions is zero
+         */
+        explicit BenchmarkSuite(BenchmarkOptions options);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Run every case that matches the filter
+         *
+         * \param progress Stream that the name of each case is written to as it runs, or nullptr
+         *
+         * \return Results, in the order the cases were run
+         */
+        std::vector<BenchmarkResult> run(std::ostream* progress = nullptr);
+
+        /*!
+         * \brief Write results as a JSON document
+         *
+         * \param results Results of run()
+         * \param out Output stream
+         */
+        void write_json(const std::vector<BenchmarkResult>& results, std::ostream& out) const;
+
+    private:
+
+        //! Evaluates the case at every epoch of a batch, and returns a sum of the outputs so they cannot be discarded
+        using BatchFunction = std::function<double(const double*, size_t)>;
+
+        //! Case of the suite
+        struct Case {
+            std::string api;
+            std::string target;
+            std::string central_body;
+            std::string quantity;
+            BatchFunction eval;
+            std::function<void()> reset;
+        };
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Build the list of cases
+        std::vector<Case> make_cases() const;
+
+        //! Time the passes of a case over the epochs, with a cold or warm cache
+        BenchmarkResult time_case(const Case& test, const std::vector<double>& epochs, bool sequential, bool cold);
+
+        //! Read the eviction buffer, so the tables no longer sit in the CPU caches
+        void evict();
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Settings of the run
+        BenchmarkOptions options_;
+
+        //! Buffer read to evict the CPU caches
+        std::vector<uint64_t> evict_buffer_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,36 @@
+#include "cycle_counter.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <limits>
+
+namespace jpl_ephemeris {
+
+double calibrate_cycle_counter(unsigned int duration_ms) {
+    const auto duration = std::chrono::milliseconds(duration_ms);
+
+    const auto start_time    = std::chrono::steady_clock::now();
+    const uint64_t start_cnt = cycle_counter_start();
+    auto stop_time           = start_time;
+    while (stop_time - start_time < duration) {
+        stop_time = std::chrono::steady_clock::now();
+    }
+    const uint64_t stop_cnt = cycle_counter_stop();
+
+    const double elapsed_ns = std::chrono::duration<double, std::nano>(stop_time - start_time).count();
+    return static_cast<double>(stop_cnt - start_cnt) / elapsed_ns;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t measure_cycle_counter_overhead(unsigned int num_samples) {
+    uint64_t overhead = std::numeric_limits<uint64_t>::max();
+    for (unsigned int k = 0; k < num_samples; k++) {
+        const uint64_t start = cycle_counter_start();
+        const uint64_t stop  = cycle_counter_stop();
+        overhead             = std::min(overhead, stop - start);
+    }
+    return overhead;
+}
+
+}  // namespace jpl_ephemeris
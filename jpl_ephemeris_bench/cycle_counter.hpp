@@ -0,0 +1,83 @@
+#ifndef JPL_EPHEMERIS_BENCH_CYCLE_COUNTER_HPP
+#define JPL_EPHEMERIS_BENCH_CYCLE_COUNTER_HPP
+
+/*!
+ * \file jpl_ephemeris_bench/cycle_counter.hpp
+ * \brief Serialized reads of the CPU time-stamp counter, for timing single calls
+ *
+ * \details On x86-64 the start of a timed region is LFENCE; RDTSC; LFENCE, so the read waits for the earlier instructions
+ * and the timed code cannot start before it, and the end is RDTSCP; LFENCE, so the read waits for the timed code and the
+ * later instructions cannot start before it (Paoloni, How to Benchmark Code Execution Times on Intel IA-32 and IA-64
+ * Instruction Set Architectures, 2010). On AArch64 the virtual counter is read behind an ISB. Elsewhere the counter falls
+ * back to std::chrono::steady_clock in nanoseconds. The reads are also compiler barriers.
+ */
+
+// Standard Library Includes
+#include <chrono>
+#include <cstdint>
+
+namespace jpl_ephemeris {
+
+//! Read the counter at the start of a timed region
+inline uint64_t cycle_counter_start() {
+#if defined(__x86_64__)
+    uint32_t lo = 0, hi = 0;
+    asm volatile("lfence\n\trdtsc\n\tlfence" : "=a"(lo), "=d"(hi) : : "memory");
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t val = 0;
+    asm volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(val) : : "memory");
+    return val;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+//! Read the counter at the end of a timed region
+inline uint64_t cycle_counter_stop() {
+#if defined(__x86_64__)
+    uint32_t lo = 0, hi = 0;
+    asm volatile("rdtscp\n\tlfence" : "=a"(lo), "=d"(hi) : : "rcx", "memory");
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t val = 0;
+    asm volatile("isb\n\tmrs %0, cntvct_el0\n\tisb" : "=r"(val) : : "memory");
+    return val;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/*!
+ * \brief Make the compiler produce a value before the next read of the counter, without generating any code
+ *
+ * \param value Output of the timed code
+ */
+template<class T>
+inline void keep_value(const T& value) {
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+/*!
+ * \brief Measure the rate of the counter against std::chrono::steady_clock
+ *
+ * \param duration_ms Duration of the measurement [ms]
+ *
+ * \return Counter ticks per nanosecond
+ */
+double calibrate_cycle_counter(unsigned int duration_ms = 100);
+
+/*!
+ * \brief Measure the overhead of an empty timed region, which is subtracted from every sample
+ *
+ * \details The minimum over the samples is used, since every other source of delay only adds to it.
+ *
+ * \param num_samples Number of empty regions timed
+ *
+ * \return Overhead [ticks]
+ */
+uint64_t measure_cycle_counter_overhead(unsigned int num_samples = 100000);
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,313 @@
+#include "latency_harness.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+// System Includes
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris_bench/bench_cases.hpp"
+#include "jpl_ephemeris_bench/cycle_counter.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Percentiles reported in the JSON output, and their names
+const std::vector<std::pair<double, const char*>> PERCENTILES{
+    {50., "p50"}, {90., "p90"}, {99., "p99"}, {99.9, "p99_9"}, {99.99, "p99_99"},
+};
+
+//! Keeps the compiler from discarding the evaluations
+volatile double sink = 0.;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Pin the calling thread to a CPU, which is a no-op on systems other than Linux
+void pin_to_cpu(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        throw std::runtime_error("LatencyHarness::run() - Unable to pin a thread to CPU " + std::to_string(cpu));
+    }
+#else
+    (void)cpu;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Saves the CPU affinity of the calling thread, and restores it on destruction (a no-op on systems other than Linux)
+class AffinityGuard {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        AffinityGuard() {
+#ifdef __linux__
+            CPU_ZERO(&saved_set_);
+            saved_ = pthread_getaffinity_np(pthread_self(), sizeof(saved_set_), &saved_set_) == 0;
+#endif
+        }
+
+        ~AffinityGuard() {
+#ifdef __linux__
+            if (saved_) {
+                pthread_setaffinity_np(pthread_self(), sizeof(saved_set_), &saved_set_);
+            }
+#endif
+        }
+
+        AffinityGuard(const AffinityGuard&) = delete;
+
+        AffinityGuard& operator=(const AffinityGuard&) = delete;
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+#ifdef __linux__
+        //! Affinity of the thread when the guard was created
+        cpu_set_t saved_set_{};
+#endif
+
+        //! True if the affinity was read, and is restored on destruction
+        bool saved_ = false;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the CPU the calling thread is running on, or -1 if unknown
+int get_current_cpu() {
+#ifdef __linux__
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Write a string as a JSON value; the names of the APIs never need escaping
+void write_string(std::ostream& out, const std::string& value) {
+    out << '"' << value << '"';
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+LatencyHarness::LatencyHarness(LatencyOptions options) : options_(std::move(options)) {
+    if (options_.num_samples == 0) {
+        throw std::invalid_argument("LatencyHarness() - Number of samples must be greater than zero.");
+    }
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::vector<LatencyResult> LatencyHarness::run(std::ostream* progress) {
+    if (options_.cpus.empty()) {
+        const int cpu = get_current_cpu();
+        if (cpu >= 0) {
+            options_.cpus.push_back(cpu);
+        }
+    }
+
+    // Calibrate on the first CPU, so the counter and the timed calls run on the same core type. The calling thread gets
+    // its original affinity back when the run ends, including by an exception.
+    const AffinityGuard affinity;
+    if (!options_.cpus.empty()) {
+        pin_to_cpu(options_.cpus.front());
+    }
+    ticks_per_ns_ = calibrate_cycle_counter();
+    overhead_     = measure_cycle_counter_overhead();
+
+    const std::vector<double> epochs = make_epochs();
+    if (options_.cpus.size() <= 1) {
+        std::vector<LatencyResult> results;
+        measure_thread(epochs, results, progress);
+        return results;
+    }
+
+    // Every thread measures the same APIs in the same order, so their results line up
+    std::vector<std::vector<LatencyResult>> thread_results(options_.cpus.size());
+    std::vector<std::exception_ptr> errors(options_.cpus.size());
+    std::vector<std::thread> threads;
+    for (size_t k = 0; k < options_.cpus.size(); k++) {
+        threads.emplace_back([&, k]() {
+            try {
+                pin_to_cpu(options_.cpus[k]);
+                measure_thread(epochs, thread_results[k], k == 0 ? progress : nullptr);
+            } catch (...) {
+                errors[k] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::vector<LatencyResult> results = std::move(thread_results[0]);
+    for (size_t k = 1; k < thread_results.size(); k++) {
+        for (size_t i = 0; i < results.size(); i++) {
+            results[i].histogram.merge(thread_results[k][i].histogram);
+        }
+    }
+    return results;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void LatencyHarness::write_json(const std::vector<LatencyResult>& results, std::ostream& out) const {
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"benchmark\": \"jpl_ephemeris_latency\",\n";
+    out << "  \"label\": ";
+    write_string(out, options_.label);
+    out << ",\n";
+#ifdef __VERSION__
+    out << "  \"compiler\": ";
+    write_string(out, __VERSION__);
+    out << ",\n";
+#endif
+    out << "  \"ticks_per_ns\": " << ticks_per_ns_ << ",\n";
+    out << "  \"overhead_ns\": " << static_cast<double>(overhead_) / ticks_per_ns_ << ",\n";
+    out << "  \"cpus\": [";
+    for (size_t k = 0; k < options_.cpus.size(); k++) {
+        out << (k == 0 ? "" : ", ") << options_.cpus[k];
+    }
+    out << "],\n";
+    out << "  \"options\": {\"num_samples\": " << options_.num_samples << ", \"num_warmup\": " << options_.num_warmup
+        << ", \"epochs\": \"" << (options_.sequential ? "sequential" : "random") << "\", \"seed\": " << options_.seed
+        << "},\n";
+    out << "  \"results\": [";
+
+    for (size_t k = 0; k < results.size(); k++) {
+        const LatencyResult& res     = results[k];
+        const LatencyHistogram& hist = res.histogram;
+        auto to_ns                   = [&](uint64_t ticks) { return static_cast<double>(ticks) / ticks_per_ns_; };
+
+        out << (k == 0 ? "\n" : ",\n") << "    {\"api\": ";
+        write_string(out, res.api);
+        out << ", \"target\": ";
+        write_string(out, res.target);
+        out << ", \"central_body\": ";
+        write_string(out, res.central_body);
+        out << ", \"quantity\": ";
+        write_string(out, res.quantity);
+        out << ", \"count\": " << hist.get_total_count() << ", \"ns\": {\"min\": " << to_ns(hist.get_min());
+        for (const auto& [percentile, name] : PERCENTILES) {
+            out << ", \"" << name << "\": " << to_ns(hist.get_value_at_percentile(percentile));
+        }
+        out << ", \"max\": " << to_ns(hist.get_max()) << ", \"mean\": " << hist.get_mean() / ticks_per_ns_ << "}}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void LatencyHarness::write_csv(const std::vector<LatencyResult>& results, std::ostream& out) const {
+    out << std::setprecision(8);
+    out << "api,target,central_body,quantity,latency_ns,count,percentile\n";
+    for (const LatencyResult& res : results) {
+        const LatencyHistogram& hist = res.histogram;
+        const double total           = static_cast<double>(hist.get_total_count());
+
+        uint64_t cumulative = 0;
+        for (size_t bucket = 0; bucket < hist.get_num_buckets(); bucket++) {
+            const uint64_t count = hist.get_count(bucket);
+            if (count == 0) {
+                continue;
+            }
+            cumulative += count;
+
+            const uint64_t upper = std::min(LatencyHistogram::get_bucket_upper(bucket), hist.get_max());
+            out << res.api << ',' << res.target << ',' << res.central_body << ',' << res.quantity << ','
+                << static_cast<double>(upper) / ticks_per_ns_ << ',' << count << ','
+                << 100. * static_cast<double>(cumulative) / total << '\n';
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double LatencyHarness::get_ticks_per_ns() const {
+    return ticks_per_ns_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHarness::get_overhead() const {
+    return overhead_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<double> LatencyHarness::make_epochs() const {
+    return make_bench_epochs(options_.sequential, options_.num_warmup + options_.num_samples, options_.seed);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void LatencyHarness::measure_thread(const std::vector<double>& epochs, std::vector<LatencyResult>& results,
+                                    std::ostream* progress) const {
+    visit_bench_cases([&](const char* api, const char* target, const char* central_body, const char* quantity, auto eval,
+                          const std::function<void()>&) {
+        const std::string name = std::string(api) + "/" + target + "/" + central_body + "/" + quantity;
+        if (name.find(options_.filter) == std::string::npos) {
+            return;
+        }
+        if (progress != nullptr) {
+            *progress << name << std::endl;
+        }
+
+        LatencyResult res;
+        res.api          = api;
+        res.target       = target;
+        res.central_body = central_body;
+        res.quantity     = quantity;
+
+        for (size_t i = 0; i < options_.num_warmup; i++) {
+            sink = eval(epochs[i])[0];
+        }
+
+        for (size_t i = options_.num_warmup; i < epochs.size(); i++) {
+            const uint64_t start = cycle_counter_start();
+            const auto out       = eval(epochs[i]);
+            keep_value(out);
+            const uint64_t stop = cycle_counter_stop();
+
+            sink                 = out[0];
+            const uint64_t ticks = stop - start;
+            res.histogram.record(ticks > overhead_ ? ticks - overhead_ : 0);
+        }
+        results.push_back(std::move(res));
+    });
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,163 @@
+#ifndef JPL_EPHEMERIS_BENCH_LATENCY_HARNESS_HPP
+#define JPL_EPHEMERIS_BENCH_LATENCY_HARNESS_HPP
+
+/*!
+ * \file jpl_ephemeris_bench/latency_harness.hpp
+ * \brief Per-call latency harness of the tables, the Sun, Earth, and Moon classes, and EphemerisContext
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris_bench Includes
+#include "jpl_ephemeris_bench/latency_histogram.hpp"
+
+namespace jpl_ephemeris {
+
+//! Settings of a LatencyHarness run
+struct LatencyOptions {
+    //! Number of timed calls per API and thread
+    size_t num_samples = 100000;
+
+    //! Number of untimed calls per API and thread before the timed ones
+    size_t num_warmup = 1000;
+
+    //! If true, the epochs are one minute apart, otherwise they are drawn uniformly over the range of the tables
+    bool sequential = false;
+
+    //! Seed of the random epochs
+    uint64_t seed = 42;
+
+    //! CPUs that a measuring thread is pinned to, one thread per CPU. If empty, the calling thread measures, pinned to
+    //! the CPU it is running on.
+    std::vector<int> cpus{};
+
+    //! Only run the APIs whose name (e.g. "context/Moon/Earth/state") contains this string
+    std::string filter{};
+
+    //! Free-form label copied to the output, e.g. a version or commit
+    std::string label{};
+};
+
+//! Latencies of one API, merged over the measuring threads
+struct LatencyResult {
+    //! API measured: "table", "body" (the Sun, Earth, and Moon classes), or "context" (EphemerisContext)
+    std::string api{};
+
+    //! Target body
+    std::string target{};
+
+    //! Central body
+    std::string central_body{};
+
+    //! Quantity evaluated: "position", "velocity", or "state"
+    std::string quantity{};
+
+    //! Latencies, after subtracting the overhead of the counter [ticks]
+    LatencyHistogram histogram{};
+};
+
+/*!
+ * \brief Per-call latency harness of the tables, the Sun, Earth, and Moon classes, and EphemerisContext
+ *
+ * \details Every call is timed on its own with serialized reads of the time-stamp counter (see cycle_counter.hpp), and the
+ * overhead of an empty timed region is subtracted from each sample, so calls of a few tens of nanoseconds are resolved.
+ * The samples are counted in a LatencyHistogram per API, and reported as percentiles, since real-time budgets are set by
+ * the tail rather than the mean. Each measuring thread is pinned to its own CPU (on Linux), evaluates the same APIs at the
+ * same epochs with its own EphemerisContext, and its histograms are merged into the results. The APIs are those of
+ * visit_bench_cases().
+ */
+class LatencyHarness {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Create the harness
+         *
+         * \param options Settings of the run
+         *
+         * \throws std::invalid_argument If the number of samples is zero
+         */
+        explicit LatencyHarness(LatencyOptions options);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Calibrate the counter, and time every API that matches the filter
+         *
+         * \details The calling thread is pinned for the calibration (and the measurement, with a single CPU), and gets its
+         * original CPU affinity back before returning.
+         *
+         * \param progress Stream that the name of each API is written to as it runs, or nullptr
+         *
+         * \return Results, in the order the APIs were run
+         *
+         * \throws std::runtime_error If a thread cannot be pinned to its CPU
+         */
+        std::vector<LatencyResult> run(std::ostream* progress = nullptr);
+
+        /*!
+         * \brief Write the percentiles of every API as a JSON document
+         *
+         * \param results Results of run()
+         * \param out Output stream
+         */
+        void write_json(const std::vector<LatencyResult>& results, std::ostream& out) const;
+
+        /*!
+         * \brief Write the percentile distribution of every API as CSV
+         *
+         * \details One row per non-empty bucket, with the columns api, target, central_body, quantity, latency_ns (upper
+         * end of the bucket), count, and percentile (percentage of the samples at or below latency_ns), as in the
+         * percentile distribution output of HdrHistogram.
+         *
+         * \param results Results of run()
+         * \param out Output stream
+         */
+        void write_csv(const std::vector<LatencyResult>& results, std::ostream& out) const;
+
+        //! Return the measured rate of the counter [ticks/ns]
+        double get_ticks_per_ns() const;
+
+        //! Return the measured overhead of the counter [ticks]
+        uint64_t get_overhead() const;
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Return the epochs of the timed and warm-up calls
+        std::vector<double> make_epochs() const;
+
+        //! Time every matching API on the current thread, writing one result per API
+        void measure_thread(const std::vector<double>& epochs, std::vector<LatencyResult>& results,
+                            std::ostream* progress) const;
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Settings of the run
+        LatencyOptions options_;
+
+        //! Rate of the counter [ticks/ns]
+        double ticks_per_ns_ = 1.;
+
+        //! Overhead of an empty timed region [ticks]
+        uint64_t overhead_ = 0;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
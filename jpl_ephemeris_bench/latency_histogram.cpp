@@ -0,0 +1,122 @@
+#include "latency_histogram.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of values counted exactly
+constexpr uint64_t SUB_BUCKET_COUNT = uint64_t(1) << LatencyHistogram::SUB_BUCKET_BITS;
+
+//! Number of buckets per power of two above the linear range
+constexpr uint64_t HALF_COUNT = SUB_BUCKET_COUNT / 2;
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+LatencyHistogram::LatencyHistogram() : counts_(SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS) * HALF_COUNT, 0) {}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t k = 0; k < counts_.size(); k++) {
+        counts_[k] += other.counts_[k];
+    }
+    total_count_ += other.total_count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHistogram::get_value_at_percentile(double percentile) const {
+    if (total_count_ == 0) {
+        return 0;
+    }
+
+    const double fraction = std::clamp(percentile, 0., 100.) / 100.;
+    const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(total_count_))));
+
+    uint64_t cumulative = 0;
+    for (size_t k = 0; k < counts_.size(); k++) {
+        cumulative += counts_[k];
+        if (cumulative >= target) {
+            return std::min(get_bucket_upper(k), max_);
+        }
+    }
+    return max_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHistogram::get_total_count() const {
+    return total_count_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHistogram::get_min() const {
+    return total_count_ == 0 ? 0 : min_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHistogram::get_max() const {
+    return max_;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+double LatencyHistogram::get_mean() const {
+    return total_count_ == 0 ? 0. : sum_ / static_cast<double>(total_count_);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+size_t LatencyHistogram::get_num_buckets() const {
+    return counts_.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHistogram::get_count(size_t bucket) const {
+    return counts_[bucket];
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint64_t LatencyHistogram::get_bucket_upper(size_t bucket) {
+    if (bucket < SUB_BUCKET_COUNT) {
+        return bucket;
+    }
+
+    // The top bucket ends at 2^64 - 1, which the unsigned wrap-around of the shift produces
+    const uint64_t offset   = bucket - SUB_BUCKET_COUNT;
+    const unsigned int exp  = static_cast<unsigned int>(offset / HALF_COUNT) + 1;
+    const uint64_t mantissa = offset % HALF_COUNT + HALF_COUNT;
+    return ((mantissa + 1) << exp) - 1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+size_t LatencyHistogram::get_bucket(uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+
+    // value >> exp keeps the top SUB_BUCKET_BITS bits, in [HALF_COUNT, SUB_BUCKET_COUNT)
+    const unsigned int exp = static_cast<unsigned int>(std::bit_width(value)) - SUB_BUCKET_BITS;
+    return static_cast<size_t>(SUB_BUCKET_COUNT + (exp - 1) * HALF_COUNT + ((value >> exp) - HALF_COUNT));
+}
+
+}  // namespace jpl_ephemeris
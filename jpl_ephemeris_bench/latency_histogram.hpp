@@ -0,0 +1,113 @@
+#ifndef JPL_EPHEMERIS_BENCH_LATENCY_HISTOGRAM_HPP
+#define JPL_EPHEMERIS_BENCH_LATENCY_HISTOGRAM_HPP
+
+/*!
+ * \file jpl_ephemeris_bench/latency_histogram.hpp
+ * \brief Histogram of latencies with a bounded relative error, in the style of HdrHistogram
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Histogram of latencies with a bounded relative error, in the style of HdrHistogram
+ *
+ * \details Values below 2^SUB_BUCKET_BITS are counted exactly. Above that, each power of two is split into
+ * 2^(SUB_BUCKET_BITS - 1) linear buckets, so every bucket is narrower than 2^(1 - SUB_BUCKET_BITS) of its values (0.8%),
+ * over the whole range of uint64_t, with a fixed amount of memory and a constant-time record(). The minimum, maximum, and
+ * mean are tracked exactly.
+ */
+class LatencyHistogram {
+    public:
+
+        //! Number of bits of the linear range, which sets the relative resolution
+        static constexpr unsigned int SUB_BUCKET_BITS = 8;
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        //! Create an empty histogram
+        LatencyHistogram();
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Count one value
+        void record(uint64_t value) {
+            counts_[get_bucket(value)]++;
+            total_count_++;
+            sum_ += static_cast<double>(value);
+            min_ = value < min_ ? value : min_;
+            max_ = value > max_ ? value : max_;
+        }
+
+        //! Add the counts of another histogram to this one
+        void merge(const LatencyHistogram& other);
+
+        /*!
+         * \brief Return the value below or at which the specified percentage of the values fall
+         *
+         * \details As in HdrHistogram, this is the highest value of the bucket that holds the percentile, capped at the
+         * maximum, so it never understates the latency.
+         *
+         * \param percentile Percentage in [0, 100]
+         *
+         * \return Value at the percentile, or zero if the histogram is empty
+         */
+        uint64_t get_value_at_percentile(double percentile) const;
+
+        //! Return the number of values counted
+        uint64_t get_total_count() const;
+
+        //! Return the smallest value counted, or zero if the histogram is empty
+        uint64_t get_min() const;
+
+        //! Return the largest value counted
+        uint64_t get_max() const;
+
+        //! Return the mean of the values counted, or zero if the histogram is empty
+        double get_mean() const;
+
+        //! Return the number of buckets
+        size_t get_num_buckets() const;
+
+        //! Return the number of values counted in a bucket
+        uint64_t get_count(size_t bucket) const;
+
+        //! Return the highest value that is counted in a bucket
+        static uint64_t get_bucket_upper(size_t bucket);
+
+        //! Return the bucket that counts a value
+        static size_t get_bucket(uint64_t value);
+
+    private:
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Count of each bucket
+        std::vector<uint64_t> counts_;
+
+        //! Number of values counted
+        uint64_t total_count_ = 0;
+
+        //! Sum of the values counted
+        double sum_ = 0.;
+
+        //! Smallest value counted
+        uint64_t min_ = UINT64_MAX;
+
+        //! Largest value counted
+        uint64_t max_ = 0;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,103 @@
+// Standard Library Includes
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// jpl_ephemeris_bench Includes
+#include "jpl_ephemeris_bench/latency_harness.hpp"
+
+using namespace jpl_ephemeris;
+
+namespace {
+
+void print_usage(const char* exec) {
+    LatencyOptions defaults;
+    std::cout << "Usage: " << exec << " [-o prefix] [-f filter] [-l label] [-n num_samples] [-w num_warmup] [-c cpus]\n"
+              << "       [-S] [-s seed] [-q]\n"
+              << "  -o  Write the percentiles to prefix.json and the percentile distributions to prefix.csv, instead of\n"
+              << "      the percentiles to stdout\n"
+              << "  -f  Only run the APIs whose name (e.g. context/Moon/Earth/state) contains this string\n"
+              << "  -l  Label copied to the results, e.g. a version or commit\n"
+              << "  -n  Number of timed calls per API and thread (default " << defaults.num_samples << ")\n"
+              << "  -w  Number of untimed calls per API and thread before the timed ones (default " << defaults.num_warmup
+              << ")\n"
+              << "  -c  Comma-separated CPUs to pin one measuring thread each to (default: the current CPU)\n"
+              << "  -S  Use epochs one minute apart instead of random epochs\n"
+              << "  -s  Seed of the random epochs (default " << defaults.seed << ")\n"
+              << "  -q  Do not report progress on stderr\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    LatencyOptions options;
+    std::string prefix;
+    bool quiet = false;
+
+    for (int k = 1; k < argc; k++) {
+        std::string arg = argv[k];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (arg == "-q") {
+            quiet = true;
+            continue;
+        }
+        if (arg == "-S") {
+            options.sequential = true;
+            continue;
+        }
+        if (k + 1 >= argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        if (arg == "-o") {
+            prefix = argv[++k];
+        } else if (arg == "-f") {
+            options.filter = argv[++k];
+        } else if (arg == "-l") {
+            options.label = argv[++k];
+        } else if (arg == "-n") {
+            options.num_samples = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-w") {
+            options.num_warmup = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-c") {
+            std::stringstream cpus(argv[++k]);
+            std::string cpu;
+            while (std::getline(cpus, cpu, ',')) {
+                options.cpus.push_back(std::atoi(cpu.c_str()));
+            }
+        } else if (arg == "-s") {
+            options.seed = std::strtoull(argv[++k], nullptr, 10);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        LatencyHarness harness(options);
+        std::vector<LatencyResult> results = harness.run(quiet ? nullptr : &std::cerr);
+
+        if (prefix.empty()) {
+            harness.write_json(results, std::cout);
+        } else {
+            std::ofstream json(prefix + ".json");
+            std::ofstream csv(prefix + ".csv");
+            if (!json || !csv) {
+                std::cerr << "Unable to open " << prefix << ".json or " << prefix << ".csv\n";
+                return 1;
+            }
+            harness.write_json(results, json);
+            harness.write_csv(results, csv);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Standard Library Includes
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// jpl_ephemeris_bench Includes
+#include "jpl_ephemeris_bench/benchmark_suite.hpp"
+
+using namespace jpl_ephemeris;
+
+namespace {
+
+void print_usage(const char* exec) {
+    BenchmarkOptions defaults;
+    std::cout << "Usage: " << exec << " [-o output.json] [-f filter] [-l label] [-n batch_size] [-r repetitions]\n"
+              << "       [-c cold_batch_size] [-R cold_repetitions] [-e evict_mib] [-s seed] [-q]\n"
+              << "  -o  Write the JSON results to this file instead of stdout\n"
+              << "  -f  Only run the cases whose name (e.g. context/Moon/Earth/state) contains this string\n"
+              << "  -l  Label copied to the results, e.g. a version or commit\n"
+              << "  -n  Number of epochs per warm pass (default " << defaults.batch_size << ")\n"
+              << "  -r  Number of warm passes (default " << defaults.repetitions << ")\n"
+              << "  -c  Number of epochs per cold pass (default " << defaults.cold_batch_size << ")\n"
+              << "  -R  Number of cold passes (default " << defaults.cold_repetitions << ")\n"
+              << "  -e  Size of the buffer read to evict the CPU caches before a cold pass [MiB] (default "
+              << defaults.evict_mib << ")\n"
+              << "  -s  Seed of the random epochs (default " << defaults.seed << ")\n"
+              << "  -q  Do not report progress on stderr\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    std::string output;
+    bool quiet = false;
+
+    for (int k = 1; k < argc; k++) {
+        std::string arg = argv[k];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (arg == "-q") {
+            quiet = true;
+            continue;
+        }
+        if (k + 1 >= argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        if (arg == "-o") {
+            output = argv[++k];
+        } else if (arg == "-f") {
+            options.filter = argv[++k];
+        } else if (arg == "-l") {
+            options.label = argv[++k];
+        } else if (arg == "-n") {
+            options.batch_size = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-r") {
+            options.repetitions = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-c") {
+            options.cold_batch_size = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-R") {
+            options.cold_repetitions = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-e") {
+            options.evict_mib = std::strtoull(argv[++k], nullptr, 10);
+        } else if (arg == "-s") {
+            options.seed = std::strtoull(argv[++k], nullptr, 10);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        BenchmarkSuite suite(options);
+        std::vector<BenchmarkResult> results = suite.run(quiet ? nullptr : &std::cerr);
+
+        if (output.empty()) {
+            suite.write_json(results, std::cout);
+        } else {
+            std::ofstream file(output);
+            if (!file) {
+                std::cerr << "Unable to open " << output << "\n";
+                return 1;
+            }
+            suite.write_json(results, file);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
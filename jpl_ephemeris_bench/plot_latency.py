@@ -0,0 +1,40 @@
+import csv
+import sys
+
+import matplotlib.pyplot as plt
+
+def plot_percentiles(title, csv_file, filter_text=""):
+    # Read the percentile distribution of each API from the CSV written by jpl_ephemeris_latency
+    curves = {}
+    with open(csv_file, 'r') as f:
+        for row in csv.DictReader(f):
+            name = "/".join([row['api'], row['target'], row['central_body'], row['quantity']])
+            if filter_text not in name:
+                continue
+            curves.setdefault(name, ([], []))
+            curves[name][0].append(float(row['percentile']))
+            curves[name][1].append(float(row['latency_ns']))
+
+    # Plot latency against 1 / (1 - percentile), so the tail is spread out as in HdrHistogram plots
+    fig, ax = plt.subplots(figsize=(12, 8))
+    ax.set_title(title)
+    for name, (percentiles, latencies) in curves.items():
+        x = [1.0 / max(1.0 - p / 100.0, 1e-6) for p in percentiles]
+        ax.step(x, latencies, where='post', label=name)
+
+    ticks = [1, 2, 10, 100, 1000, 10000, 100000]
+    ax.set_xscale('log')
+    ax.set_xticks(ticks)
+    ax.set_xticklabels(["0%", "50%", "90%", "99%", "99.9%", "99.99%", "99.999%"])
+    ax.set_xlabel("Percentile")
+    ax.set_ylabel("Latency (ns)")
+    ax.legend()
+    ax.grid()
+
+    # Show the plot
+    plt.show()
+
+# Example usage: python3 plot_latency.py latency.csv context/Moon
+csv_file = sys.argv[1] if len(sys.argv) > 1 else 'latency.csv'
+filter_text = sys.argv[2] if len(sys.argv) > 2 else ''
+plot_percentiles('Latency Percentile Distribution', csv_file, filter_text)
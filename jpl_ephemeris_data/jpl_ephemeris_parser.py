@@ -14,14 +14,15 @@ def parse_header_file(header_file):
     Pull the table out of the DE header file, which is located between the tags "GROUP   1050" and "GROUP   1070"
     
     Returns:
-        ndarray: Numpy array containing the header table 
         float: Earth/Moon mass ratio
+        ndarray: Numpy array containing the header table 
+        dict: Constants from GROUP 1040/1041, keyed by name (e.g. AU, CLIGHT, EMRAT, GMS, GMB)
 
     """
 
     def parse_group_1040(lines_group_1040):
         """
-        Simply identify the index in the block for EMRAT
+        Return the names of the constants, in the order their values appear in GROUP 1041
         """
         lines_group_1040 = lines_group_1040[2:]
 
@@ -32,16 +33,11 @@ def parse_header_file(header_file):
             else:
                 split_block.extend(line.strip().split())
 
-        # Now identify index of EMRAT
-        for ind, val in enumerate(split_block):
-            if val == "EMRAT":
-                return ind
+        return split_block
 
-        return None
-
-    def parse_group_1041(lines_group_1041, emrat_ind):
+    def parse_group_1041(lines_group_1041, names):
         """
-        Return the Earth/Moon mass ratio
+        Return a dictionary mapping the name of each constant to its value
         """
         lines_group_1041 = lines_group_1041[2:]
 
@@ -52,7 +48,7 @@ def parse_header_file(header_file):
             else:
                 split_block.extend(line.strip().split())
 
-        return float(split_block[emrat_ind].replace("D", "e"))
+        return {name: float(val.replace("D", "e")) for name, val in zip(names, split_block)}
         
     def parse_group_1050(lines_group_1050):
         # Put the header lines into a numpy array
@@ -86,12 +82,12 @@ def parse_header_file(header_file):
             elif group == "1050":
                 group_lines['1050'].append(line)
 
-    emrat_ind = parse_group_1040(group_lines['1040'])
-    if emrat_ind is None:
+    constants = parse_group_1041(group_lines['1041'], parse_group_1040(group_lines['1040']))
+    if "EMRAT" not in constants:
         raise Exception("Failed to parse out the EMRAT value from header file")
-    emratio = parse_group_1041(group_lines['1041'], emrat_ind)
+    emratio = constants["EMRAT"]
     jpl_ephem_header = parse_group_1050(group_lines['1050'])
-    return emratio, numpy.asarray(jpl_ephem_header)
+    return emratio, numpy.asarray(jpl_ephem_header), constants
 
 #---------------------------------------------------------------------------------------------------------------------------
 
@@ -255,6 +251,29 @@ def write_to_file(file_name: str, num_entries, days_per_poly, x_coeff_str, y_coe
 
 #---------------------------------------------------------------------------------------------------------------------------
 
+def write_constants_file(file_name: str, constants: dict):
+    """
+    Format and write the constants used by the library (see de_constants.hpp) to file
+
+    """
+    names = [("au", "AU", "Astronomical unit [km]"),
+             ("clight", "CLIGHT", "Speed of light [km/s]"),
+             ("emrat", "EMRAT", "Earth/Moon mass ratio"),
+             ("gms", "GMS", "Gravitational parameter of the Sun [AU^3/day^2]"),
+             ("gmb", "GMB", "Gravitational parameter of the Earth-Moon system [AU^3/day^2]"),
+             ("asun", "ASUN", "Radius of the Sun [km]"),
+             ("re", "RE", "Equatorial radius of the Earth [km]"),
+             ("am", "AM", "Radius of the Moon [km]")]
+
+    with open("{}".format(file_name), 'w') as fID:
+        for cpp_name, de_name, description in names:
+            fID.write("//! {}\n".format(description))
+            fID.write("static constexpr double {} = {};\n\n".format(cpp_name, repr(constants[de_name])))
+
+    return
+
+#---------------------------------------------------------------------------------------------------------------------------
+
 def convert_to_float(words):
     """
     Convert values from strings to floating point values
@@ -472,7 +491,7 @@ if __name__ == "__main__":
     os.makedirs(output_dir, exist_ok = True)
 
     # Parse the header table
-    emratio, jpl_ephem_header = parse_header_file("de_{}/header.430_572".format(ephem_number))
+    emratio, jpl_ephem_header, constants = parse_header_file("de_{}/header.430_572".format(ephem_number))
 
     # Parse the desired files
     file_names = ["de_{}/ascp1950.430".format(ephem_number), "de_{}/ascp2050.430".format(ephem_number)]
@@ -487,3 +506,5 @@ if __name__ == "__main__":
 
     for celestial_body in CelestialBodies:
         generate_ephemeris_file(block_lines, emratio, mjdj2k_0, mjdj2k_f, celestial_body, jpl_ephem_header)
+
+    write_constants_file("de_constants.txt", constants)
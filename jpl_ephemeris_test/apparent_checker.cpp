@@ -0,0 +1,186 @@
+#include "apparent_checker.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/earth.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+#include "jpl_ephemeris/celestial_bodies/moon.hpp"
+#include "jpl_ephemeris/celestial_bodies/sun.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of seconds per day
+constexpr double SEC_PER_DAY = 86400.0;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the dot product of two vectors
+double dot(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the cross product of two vectors
+std::array<double, 3> cross(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the position of the target relative to the SSB
+std::array<double, 3> get_target_position(CentralBody target, double mjdj2k_tdb) {
+    return target == CentralBody::Sun ? Sun::get_position(mjdj2k_tdb, CentralBody::SSB)
+                                      : Moon::get_position(mjdj2k_tdb, CentralBody::SSB);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Rotate vec by angle about axis, splitting it into its projection on the axis and the part rotated in the plane
+//! (vrotv_c)
+std::array<double, 3> rotate(const std::array<double, 3>& vec, std::array<double, 3> axis, double angle) {
+    const double len = std::sqrt(dot(axis, axis));
+    for (double& val : axis) {
+        val /= len;
+    }
+
+    const double along              = dot(vec, axis);
+    const std::array<double, 3> perp{vec[0] - along * axis[0], vec[1] - along * axis[1], vec[2] - along * axis[2]};
+    const std::array<double, 3> side = cross(axis, perp);
+
+    std::array<double, 3> rotated{};
+    for (size_t k = 0; k < 3; k++) {
+        rotated[k] = along * axis[k] + std::cos(angle) * perp[k] + std::sin(angle) * side[k];
+    }
+    return rotated;
+}
+
+}  // namespace
+
+//---------------------------------------
+// Functions
+//---------------------------------------
+
+const std::vector<double>& get_apparent_reference_epochs() {
+    static const std::vector<double> epochs{0.0, 1000.25, 5000.5, 9131.75, 12345.125, 18262.5, 27393.75, 36000.0};
+    return epochs;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<ApparentRecord> compute_apparent_reference(const std::vector<double>& epochs) {
+    std::vector<ApparentRecord> records;
+    for (double t : epochs) {
+        const std::array<double, 3> earth = Earth::get_position(t, CentralBody::SSB);
+        const std::array<double, 3> v     = Earth::get_velocity(t, CentralBody::SSB);
+        const std::array<double, 3> v_c{v[0] / DEConstants::clight, v[1] / DEConstants::clight,
+                                        v[2] / DEConstants::clight};
+
+        for (CentralBody target : {CentralBody::Sun, CentralBody::Moon}) {
+            std::array<double, 3> target_ssb = get_target_position(target, t);
+            std::array<double, 3> pos{target_ssb[0] - earth[0], target_ssb[1] - earth[1], target_ssb[2] - earth[2]};
+            const double lt_0 = std::sqrt(dot(pos, pos)) / DEConstants::clight;
+
+            target_ssb = get_target_position(target, t - lt_0 / SEC_PER_DAY);
+            pos        = {target_ssb[0] - earth[0], target_ssb[1] - earth[1], target_ssb[2] - earth[2]};
+            const double lt = std::sqrt(dot(pos, pos)) / DEConstants::clight;
+            records.push_back(ApparentRecord{t, target, AberrationCorrection::LT, pos, lt});
+
+            const double dist                 = std::sqrt(dot(pos, pos));
+            const std::array<double, 3> axis = cross({pos[0] / dist, pos[1] / dist, pos[2] / dist}, v_c);
+            const double sin_phi              = std::sqrt(dot(axis, axis));
+            const std::array<double, 3> apparent = sin_phi == 0. ? pos : rotate(pos, axis, std::asin(sin_phi));
+            records.push_back(ApparentRecord{t, target, AberrationCorrection::LT_S, apparent, lt});
+        }
+    }
+    return records;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<ApparentRecord> read_apparent_reference(const std::string& reference_file) {
+    std::ifstream file(reference_file);
+    if (!file) {
+        throw std::invalid_argument("read_apparent_reference() - Unable to open " + reference_file);
+    }
+
+    std::string line;
+    bool found_eot = false;
+    while (!found_eot && std::getline(file, line)) {
+        found_eot = line.rfind("EOT", 0) == 0;
+    }
+    if (!found_eot) {
+        throw std::invalid_argument("read_apparent_reference() - " + reference_file + " has no EOT line.");
+    }
+
+    std::vector<ApparentRecord> records;
+    size_t line_number = 0;
+    while (std::getline(file, line)) {
+        line_number++;
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+
+        std::istringstream words(line);
+        std::string target;
+        std::string abcorr;
+        ApparentRecord rec;
+        const bool parsed = static_cast<bool>(words >> rec.mjdj2k_tdb >> target >> abcorr >> rec.position[0]
+                                              >> rec.position[1] >> rec.position[2] >> rec.light_time);
+        const bool known_target = target == "SUN" || target == "MOON";
+        const bool known_abcorr = abcorr == "LT" || abcorr == "LT+S";
+        if (!parsed || !known_target || !known_abcorr) {
+            throw std::invalid_argument("read_apparent_reference() - Unable to parse record " + std::to_string(line_number)
+                                        + " of " + reference_file + ": " + line);
+        }
+        rec.target     = target == "SUN" ? CentralBody::Sun : CentralBody::Moon;
+        rec.correction = abcorr == "LT" ? AberrationCorrection::LT : AberrationCorrection::LT_S;
+        records.push_back(rec);
+    }
+    return records;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+ApparentSummary check_apparent_positions(const std::vector<ApparentRecord>& records, const ApparentTolerance& tolerance,
+                                         std::ostream* failures) {
+    ApparentEphemeris apparent;
+    ApparentSummary summary;
+    for (const ApparentRecord& rec : records) {
+        const ApparentPosition computed = apparent.get_position(rec.target, rec.mjdj2k_tdb, CentralBody::Earth,
+                                                                rec.correction);
+
+        double position_error = 0.;
+        for (size_t k = 0; k < 3; k++) {
+            position_error = std::max(position_error, std::abs(computed.position[k] - rec.position[k]));
+        }
+        const double light_time_error = std::abs(computed.light_time - rec.light_time);
+
+        summary.num_checked++;
+        summary.max_position_error   = std::max(summary.max_position_error, position_error);
+        summary.max_light_time_error = std::max(summary.max_light_time_error, light_time_error);
+        if (position_error > tolerance.position || light_time_error > tolerance.light_time) {
+            summary.num_failed++;
+            if (failures != nullptr) {
+                const std::streamsize precision = failures->precision();
+                *failures << "FAILED mjdj2k_tdb " << rec.mjdj2k_tdb << " "
+                          << (rec.target == CentralBody::Sun ? "SUN" : "MOON") << " "
+                          << (rec.correction == AberrationCorrection::LT ? "LT" : "LT+S") << ": position error "
+                          << std::setprecision(3) << position_error << " km, light time error " << light_time_error << " sec\n"
+                          << std::setprecision(precision);
+            }
+        }
+    }
+    return summary;
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,118 @@
+#ifndef JPL_EPHEMERIS_TEST_APPARENT_CHECKER_HPP
+#define JPL_EPHEMERIS_TEST_APPARENT_CHECKER_HPP
+
+/*!
+ * \file jpl_ephemeris_test/apparent_checker.hpp
+ * \brief Checks the apparent positions of ApparentEphemeris against spkpos_c values recorded offline with CSPICE, or
+ * against the light time and stellar aberration algorithm that spkpos_c documents
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/apparent_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+
+namespace jpl_ephemeris {
+
+//! One spkpos_c result of an apparent reference file
+struct ApparentRecord {
+    //! Modified Julian Date from the J2000 Epoch of the observation, in the TDB Time System
+    double mjdj2k_tdb = 0.;
+
+    //! Target, observed from the Earth
+    CentralBody target = CentralBody::Sun;
+
+    //! Aberration correction passed to spkpos_c
+    AberrationCorrection correction = AberrationCorrection::LT;
+
+    //! Position of the target relative to the Earth in the J2000 frame [km]
+    std::array<double, 3> position{0., 0., 0.};
+
+    //! One-way light time [sec]
+    double light_time = 0.;
+};
+
+//! Largest differences from the recorded values that are not counted as regressions
+struct ApparentTolerance {
+    //! Position [km]
+    double position = 1e-6;
+
+    //! Light time [sec]
+    double light_time = 1e-9;
+};
+
+//! Outcome of the checks of an apparent reference file
+struct ApparentSummary {
+    //! Number of records compared against the library
+    size_t num_checked = 0;
+
+    //! Number of records whose difference exceeds the tolerance
+    size_t num_failed = 0;
+
+    //! Largest difference of a position [km]
+    double max_position_error = 0.;
+
+    //! Largest difference of a light time [sec]
+    double max_light_time_error = 0.;
+
+    //! Return true if at least one record was checked and none of them failed
+    bool passed() const {
+        return num_checked > 0 && num_failed == 0;
+    }
+};
+
+/*!
+ * \brief Read the records of an apparent reference file
+ *
+ * \details Lines up to and including the "EOT" line are the header, and every following line holds
+ * "mjdj2k_tdb target abcorr x y z lt", where target is SUN or MOON and abcorr is LT or LT+S, as written by the
+ * cspice_comparison example with --record.
+ *
+ * \param reference_file Path to the reference file
+ *
+ * \return Records, in the order of the file
+ *
+ * \throws std::invalid_argument If the file cannot be read, has no EOT line, or a record cannot be parsed
+ */
+std::vector<ApparentRecord> read_apparent_reference(const std::string& reference_file);
+
+//! Epochs of the built-in reference and of the file written by the cspice_comparison example, MJD J2K TDB [days]
+const std::vector<double>& get_apparent_reference_epochs();
+
+/*!
+ * \brief Compute reference records for the Sun and Moon from the Earth, LT and LT+S, following the algorithm that
+ * spkpos_c documents
+ *
+ * \details The light time is one Newtonian iteration (spkltc_c): lt_0 = |r(t)| / c, then the target is moved back to
+ * t - lt_0, and lt = |r(t - lt_0)| / c. Stellar aberration (stelab_c) rotates the corrected position by
+ * asin(|u x v / c|) about u x v, where u is its direction and v the velocity of the Earth relative to the SSB. The
+ * geometric positions come from the Sun, Earth, and Moon classes, independently of the EphemerisContext used by
+ * ApparentEphemeris.
+ *
+ * \param epochs Epochs of the records, MJD J2K TDB [days]
+ *
+ * \return Four records per epoch: SUN LT, SUN LT+S, MOON LT, MOON LT+S
+ */
+std::vector<ApparentRecord> compute_apparent_reference(const std::vector<double>& epochs);
+
+/*!
+ * \brief Compare the records against ApparentEphemeris, observing from the Earth
+ *
+ * \param records Records of an apparent reference file
+ * \param tolerance Largest differences that pass
+ * \param failures Stream that the failed records are written to, or nullptr
+ *
+ * \return Summary of the checks
+ */
+ApparentSummary check_apparent_positions(const std::vector<ApparentRecord>& records, const ApparentTolerance& tolerance,
+                                         std::ostream* failures = nullptr);
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,77 @@
+// Standard Library Includes
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// jpl_ephemeris_test Includes
+#include "jpl_ephemeris_test/apparent_checker.hpp"
+
+using namespace jpl_ephemeris;
+
+namespace {
+
+void print_usage(const char* exec) {
+    std::cout << "Usage: " << exec << " [-p position_tolerance] [-l light_time_tolerance] [reference_file]\n"
+              << "  -p  Largest position difference [km] (default 1e-6)\n"
+              << "  -l  Largest light time difference [sec] (default 1e-9)\n"
+              << "Compares the LT and LT+S positions of the Sun and Moon from the Earth against the light time and\n"
+              << "stellar aberration algorithm that spkpos_c documents, evaluated on the Sun, Earth, and Moon classes.\n"
+              << "With reference_file, as recorded by the cspice_comparison example with --record, also compares\n"
+              << "against its spkpos_c values. Exits with a non-zero status if a record differs by more than the\n"
+              << "tolerance, or the file has no records.\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ApparentTolerance tolerance;
+    std::string reference_file;
+
+    for (int k = 1; k < argc; k++) {
+        std::string arg = argv[k];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (arg.empty() || arg[0] != '-') {
+            reference_file = arg;
+            continue;
+        }
+        if (k + 1 >= argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        const char* value = argv[++k];
+        if (arg == "-p") {
+            tolerance.position = std::strtod(value, nullptr);
+        } else if (arg == "-l") {
+            tolerance.light_time = std::strtod(value, nullptr);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    const auto report = [&tolerance](const std::string& name, const ApparentSummary& summary) {
+        std::cout << name << ": " << (summary.passed() ? "passed" : "FAILED") << ", " << summary.num_checked
+                  << " checked, " << summary.num_failed << " failed, max error " << summary.max_position_error
+                  << " km (tolerance " << tolerance.position << "), " << summary.max_light_time_error
+                  << " sec (tolerance " << tolerance.light_time << ")\n";
+        return summary.passed();
+    };
+
+    try {
+        bool passed = report("algorithm", check_apparent_positions(
+                                              compute_apparent_reference(get_apparent_reference_epochs()), tolerance,
+                                              &std::cout));
+        if (!reference_file.empty()) {
+            passed = report("spkpos_c", check_apparent_positions(read_apparent_reference(reference_file), tolerance,
+                                                                 &std::cout))
+                     && passed;
+        }
+        return passed ? 0 : 1;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+}
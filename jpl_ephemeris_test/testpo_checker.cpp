@@ -0,0 +1,362 @@
+#include "testpo_checker.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_constants.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/granule_cache.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Julian Date of the J2000 Epoch
+constexpr double JD_J2000 = 2451545.0;
+
+//! Seconds per day
+constexpr double SEC_PER_DAY = 86400.;
+
+//! Columns of the Sun, EMB, and geocentric Moon in GROUP 1050 of a DE header, counting from zero
+constexpr unsigned int SUN_COLUMN  = 10;
+constexpr unsigned int EMB_COLUMN  = 2;
+constexpr unsigned int MOON_COLUMN = 9;
+
+//! Number of record blocks per thread, so that a thread which finishes early can steal the remaining ones
+constexpr size_t BLOCKS_PER_THREAD = 4;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return true if the code is a body that the checker evaluates
+bool is_body(int code) {
+    return code == static_cast<int>(TestpoTarget::Earth) || code == static_cast<int>(TestpoTarget::Moon)
+           || code == static_cast<int>(TestpoTarget::Sun) || code == static_cast<int>(TestpoTarget::SSB)
+           || code == static_cast<int>(TestpoTarget::EMB);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return the CentralBody of a body other than the EMB
+CentralBody to_central_body(int code) {
+    switch (static_cast<TestpoTarget>(code)) {
+        case TestpoTarget::Earth:
+            return CentralBody::Earth;
+        case TestpoTarget::Moon:
+            return CentralBody::Moon;
+        case TestpoTarget::Sun:
+            return CentralBody::Sun;
+        case TestpoTarget::SSB:
+            return CentralBody::SSB;
+        default:
+            throw std::invalid_argument("TestpoChecker - Code " + std::to_string(code) + " is not a CentralBody.");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+//! Return true if the record is one of the target, and has a center that the checker evaluates
+bool is_checked(const TestpoRecord& rec, TestpoTarget target) {
+    if (rec.target != static_cast<int>(target) || rec.component < 1 || rec.component > 6) {
+        return false;
+    }
+    if (target == TestpoTarget::Nutations) {
+        return rec.center == 0 && rec.component <= 4;
+    }
+    if (target == TestpoTarget::Librations) {
+        return rec.center == 0;
+    }
+    return is_body(rec.center);
+}
+
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::string to_string(TestpoTarget target) {
+    switch (target) {
+        case TestpoTarget::Earth:
+            return "Earth";
+        case TestpoTarget::Moon:
+            return "Moon";
+        case TestpoTarget::Sun:
+            return "Sun";
+        case TestpoTarget::SSB:
+            return "SSB";
+        case TestpoTarget::EMB:
+            return "EMB";
+        case TestpoTarget::Nutations:
+            return "Nutations";
+        case TestpoTarget::Librations:
+            return "Librations";
+    }
+    return "Unknown";
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::string to_string(TestpoSource source) {
+    switch (source) {
+        case TestpoSource::Compiled:
+            return "compiled";
+        case TestpoSource::Resident:
+            return "resident";
+        case TestpoSource::DEAscii:
+            return "de_ascii";
+    }
+    return "unknown";
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+TestpoTolerance get_testpo_tolerance(TestpoTarget target) {
+    switch (target) {
+        case TestpoTarget::Earth:
+        case TestpoTarget::Moon:
+        case TestpoTarget::Sun:
+        case TestpoTarget::SSB:
+        case TestpoTarget::EMB:
+        case TestpoTarget::Nutations:
+            return TestpoTolerance{1e-13, 1e-15};
+        case TestpoTarget::Librations:
+            return TestpoTolerance{1e-10, 1e-15};
+    }
+    return TestpoTolerance{};
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<TestpoRecord> read_testpo(const std::string& testpo_file) {
+    std::ifstream file(testpo_file);
+    if (!file) {
+        throw std::invalid_argument("read_testpo() - Unable to open " + testpo_file);
+    }
+
+    std::string line;
+    bool found_eot = false;
+    while (!found_eot && std::getline(file, line)) {
+        found_eot = line.rfind("EOT", 0) == 0;
+    }
+    if (!found_eot) {
+        throw std::invalid_argument("read_testpo() - " + testpo_file + " has no EOT line.");
+    }
+
+    std::vector<TestpoRecord> records;
+    size_t line_number = 0;
+    while (std::getline(file, line)) {
+        line_number++;
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+
+        std::istringstream words(line);
+        std::string de;
+        TestpoRecord rec;
+        if (!(words >> de >> rec.date >> rec.jed >> rec.target >> rec.center >> rec.component >> rec.value)) {
+            throw std::invalid_argument("read_testpo() - Unable to parse record " + std::to_string(line_number) + " of "
+                                        + testpo_file + ": " + line);
+        }
+        records.push_back(std::move(rec));
+    }
+    return records;
+}
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+TestpoChecker::TestpoChecker(TestpoOptions options) : options_(std::move(options)), pool_(options_.num_threads) {
+    bool needs_bodies = false;
+    for (TestpoTarget target : options_.targets) {
+        const bool is_angle = target == TestpoTarget::Nutations || target == TestpoTarget::Librations;
+        if (is_angle && options_.source != TestpoSource::DEAscii) {
+            throw std::invalid_argument("TestpoChecker() - The " + to_string(target)
+                                        + " are only available from the ASCII DE files.");
+        }
+        needs_bodies = needs_bodies || !is_angle;
+    }
+
+    switch (options_.source) {
+        case TestpoSource::Compiled:
+            tables_ = EphemerisTableSet::get_compiled_in();
+            break;
+        case TestpoSource::Resident:
+            resident_ = std::make_unique<ResidentTables>();
+            tables_   = resident_->get_tables();
+            break;
+        case TestpoSource::DEAscii:
+            if (needs_bodies) {
+                load_de_ascii_bodies();
+            }
+            break;
+    }
+
+    for (TestpoTarget target : options_.targets) {
+        if (target == TestpoTarget::Nutations && !nutation_) {
+            nutation_.emplace(Nutation::from_de_ascii(options_.de_header, options_.de_data_files));
+        } else if (target == TestpoTarget::Librations && !libration_) {
+            libration_.emplace(LunarLibration::from_de_ascii(options_.de_header, options_.de_data_files));
+        }
+    }
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+std::vector<TestpoSummary> TestpoChecker::run(const std::vector<TestpoRecord>& records, std::ostream* failures) {
+    std::vector<TestpoSummary> summaries;
+    for (TestpoTarget target : options_.targets) {
+        TestpoSummary summary;
+        summary.target    = target;
+        summary.tolerance = get_testpo_tolerance(target);
+
+        std::vector<const TestpoRecord*> selected;
+        for (const TestpoRecord& rec : records) {
+            if (is_checked(rec, target)) {
+                selected.push_back(&rec);
+            }
+        }
+
+        std::vector<double> computed(selected.size(), 0.);
+        std::vector<char> in_range(selected.size(), 0);
+        if (target == TestpoTarget::Nutations || target == TestpoTarget::Librations) {
+            evaluate_angles(selected, computed, in_range);
+        } else {
+            // Contiguous blocks of records are close in time, so each block's context mostly hits its cached granules
+            const size_t num_blocks = std::min<size_t>(selected.size(), pool_.get_num_threads() * BLOCKS_PER_THREAD);
+            pool_.run(num_blocks, [&](size_t block) {
+                evaluate_bodies(selected, block * selected.size() / num_blocks, (block + 1) * selected.size() / num_blocks,
+                                computed, in_range);
+            });
+        }
+
+        size_t num_reported = 0;
+        for (size_t i = 0; i < selected.size(); i++) {
+            if (!in_range[i]) {
+                summary.num_out_of_range++;
+                continue;
+            }
+            summary.num_checked++;
+
+            const TestpoRecord& rec = *selected[i];
+            const bool is_position  = rec.component <= (target == TestpoTarget::Nutations ? 2 : 3);
+            const double error      = std::abs(computed[i] - rec.value);
+            double& max_error       = is_position ? summary.max_position_error : summary.max_velocity_error;
+            max_error               = std::max(max_error, error);
+
+            // The negated comparison also fails a NaN result
+            if (!(error <= (is_position ? summary.tolerance.position : summary.tolerance.velocity))) {
+                summary.num_failed++;
+                if (failures != nullptr && num_reported++ < options_.max_reported) {
+                    const std::streamsize precision = failures->precision();
+                    *failures << std::setprecision(17) << to_string(target) << ": " << rec.date << " jed " << rec.jed
+                              << " t " << rec.target << " c " << rec.center << " x " << rec.component << " expected "
+                              << rec.value << " computed " << computed[i] << " error " << std::setprecision(3) << error
+                              << "\n" << std::setprecision(precision);
+                }
+            }
+        }
+        summaries.push_back(summary);
+    }
+    return summaries;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TestpoChecker::load_de_ascii_bodies() {
+    de_tables_.push_back(DEAsciiTable::load(options_.de_header, options_.de_data_files, SUN_COLUMN, 3));
+    de_tables_.push_back(DEAsciiTable::load(options_.de_header, options_.de_data_files, EMB_COLUMN, 3));
+    de_tables_.push_back(DEAsciiTable::load(options_.de_header, options_.de_data_files, MOON_COLUMN, 3));
+
+    // The EMB is at earth + moon / (1 + emrat), so the Earth is at -moon / (1 + emrat) from it, coefficient by coefficient
+    const EphemerisTableView& moon = de_tables_[2].get_view();
+    EphemerisTableView earth_from_emb = moon;
+    const double factor               = -1. / (1. + DEConstants::emrat);
+    for (unsigned int c = 0; c < 3; c++) {
+        std::vector<double>& rows = earth_from_emb_rows_[c];
+        rows.assign(moon.interp[c], moon.interp[c] + static_cast<size_t>(moon.num_granules) * moon.row_size);
+        for (size_t k = 0; k < rows.size(); k++) {
+            if (k % moon.row_size >= 2) {
+                rows[k] *= factor;
+            }
+        }
+        earth_from_emb.interp[c] = rows.data();
+    }
+
+    tables_.sun_from_ssb   = de_tables_[0].get_view();
+    tables_.emb_from_ssb   = de_tables_[1].get_view();
+    tables_.earth_from_emb = earth_from_emb;
+    tables_.moon           = moon;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TestpoChecker::evaluate_bodies(const std::vector<const TestpoRecord*>& records, size_t begin, size_t end,
+                                    std::vector<double>& computed, std::vector<char>& in_range) const {
+    EphemerisContext context(tables_);
+    GranuleCache<15> emb(tables_.emb_from_ssb);
+    const int emb_code = static_cast<int>(TestpoTarget::EMB);
+
+    auto get_ssb_state = [&](int code, double mjdj2k_tdb) {
+        return code == emb_code ? emb.get_state(mjdj2k_tdb)
+                                : context.get_state(to_central_body(code), mjdj2k_tdb, CentralBody::SSB);
+    };
+
+    for (size_t i = begin; i < end; i++) {
+        const TestpoRecord& rec = *records[i];
+        const double mjdj2k_tdb = rec.jed - JD_J2000;
+
+        std::array<double, 6> state{};
+        try {
+            if (rec.target != emb_code && rec.center != emb_code) {
+                state = context.get_state(to_central_body(rec.target), mjdj2k_tdb, to_central_body(rec.center));
+            } else {
+                const std::array<double, 6> target = get_ssb_state(rec.target, mjdj2k_tdb);
+                const std::array<double, 6> center = get_ssb_state(rec.center, mjdj2k_tdb);
+                for (size_t k = 0; k < 6; k++) {
+                    state[k] = target[k] - center[k];
+                }
+            }
+        } catch (const std::out_of_range&) {
+            continue;
+        }
+
+        const size_t k = static_cast<size_t>(rec.component - 1);
+        computed[i]    = k < 3 ? state[k] / DEConstants::au : state[k] * SEC_PER_DAY / DEConstants::au;
+        in_range[i]    = 1;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void TestpoChecker::evaluate_angles(const std::vector<const TestpoRecord*>& records, std::vector<double>& computed,
+                                    std::vector<char>& in_range) {
+    for (size_t i = 0; i < records.size(); i++) {
+        const TestpoRecord& rec = *records[i];
+        const double mjdj2k_tdb = rec.jed - JD_J2000;
+        const size_t k          = static_cast<size_t>(rec.component - 1);
+
+        try {
+            if (rec.target == static_cast<int>(TestpoTarget::Nutations)) {
+                const std::array<double, 4> state = nutation_->get_state(mjdj2k_tdb);
+                computed[i]                       = k < 2 ? state[k] : state[k] * SEC_PER_DAY;
+            } else {
+                const std::array<double, 6> state = libration_->get_state(mjdj2k_tdb);
+                computed[i]                       = k < 3 ? state[k] : state[k] * SEC_PER_DAY;
+            }
+        } catch (const std::out_of_range&) {
+            continue;
+        }
+        in_range[i] = 1;
+    }
+}
+
+}  // namespace jpl_ephemeris
@@ -0,0 +1,259 @@
+#ifndef JPL_EPHEMERIS_TEST_TESTPO_CHECKER_HPP
+#define JPL_EPHEMERIS_TEST_TESTPO_CHECKER_HPP
+
+/*!
+ * \file jpl_ephemeris_test/testpo_checker.hpp
+ * \brief Checks the library against the JPL reference values of a testpo file (e.g. testpo.430)
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/de_ascii_table.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/ephemeris_table_set.hpp"
+#include "jpl_ephemeris/celestial_bodies/lunar_libration.hpp"
+#include "jpl_ephemeris/frames/nutation.hpp"
+#include "jpl_ephemeris/memory/residency.hpp"
+#include "jpl_ephemeris/parallel/thread_pool.hpp"
+
+namespace jpl_ephemeris {
+
+//! Codes of the t# and c# columns of a testpo file that the library can evaluate
+enum class TestpoTarget : int {
+    Earth = 3,        //!< Earth
+    Moon = 10,        //!< Moon
+    Sun = 11,         //!< Sun
+    SSB = 12,         //!< Solar System Barycenter
+    EMB = 13,         //!< Earth-Moon Barycenter
+    Nutations = 14,   //!< Nutations in longitude and obliquity (center 0)
+    Librations = 15,  //!< Lunar mantle librations (center 0)
+};
+
+//! One line of a testpo file
+struct TestpoRecord {
+    //! Calendar date, as written in the file (e.g. 2000.01.01)
+    std::string date{};
+
+    //! Julian Date in the TDB Time System
+    double jed = 0.;
+
+    //! Code of the target (t#)
+    int target = 0;
+
+    //! Code of the center (c#), zero for the nutations and librations
+    int center = 0;
+
+    //! Component (x#), 1-3 for the position [AU] or angles [rad], 4-6 for the velocity [AU/day] or rates [rad/day]
+    int component = 0;
+
+    //! Reference value
+    double value = 0.;
+};
+
+//! Largest differences from the reference values that are not counted as regressions
+struct TestpoTolerance {
+    //! Position [AU] or angle [rad]
+    double position = 0.;
+
+    //! Velocity [AU/day] or rate [rad/day]
+    double velocity = 0.;
+};
+
+//! Source of the tables checked by a TestpoChecker
+enum class TestpoSource : int {
+    Compiled = 0,  //!< Compiled-in tables
+    Resident = 1,  //!< Copy of the compiled-in tables in a ResidentTables mapping
+    DEAscii = 2,   //!< Tables read at runtime from the ASCII DE files with DEAsciiTable
+};
+
+//! Settings of a TestpoChecker
+struct TestpoOptions {
+    //! Source of the tables
+    TestpoSource source = TestpoSource::Compiled;
+
+    //! DE header file (e.g. header.430_572), only used with TestpoSource::DEAscii
+    std::string de_header{};
+
+    //! ASCII DE data files in increasing order of time (e.g. ascp1950.430), only used with TestpoSource::DEAscii
+    std::vector<std::string> de_data_files{};
+
+    //! Targets to check. The nutations and librations require TestpoSource::DEAscii.
+    std::vector<TestpoTarget> targets{TestpoTarget::Earth, TestpoTarget::Moon, TestpoTarget::Sun, TestpoTarget::SSB,
+                                      TestpoTarget::EMB};
+
+    //! Number of threads evaluating the bodies, or zero for one per hardware thread
+    unsigned int num_threads = 0;
+
+    //! Maximum number of failed records written out per target
+    size_t max_reported = 20;
+};
+
+//! Outcome of the checks of one target
+struct TestpoSummary {
+    //! Target checked
+    TestpoTarget target = TestpoTarget::Earth;
+
+    //! Tolerance of the target
+    TestpoTolerance tolerance{};
+
+    //! Number of records compared against the library
+    size_t num_checked = 0;
+
+    //! Number of records outside of the range of the tables
+    size_t num_out_of_range = 0;
+
+    //! Number of records whose difference exceeds the tolerance
+    size_t num_failed = 0;
+
+    //! Largest difference of a position or angle [AU or rad]
+    double max_position_error = 0.;
+
+    //! Largest difference of a velocity or rate [AU/day or rad/day]
+    double max_velocity_error = 0.;
+
+    //! Return true if at least one record was checked and none of them failed
+    bool passed() const {
+        return num_checked > 0 && num_failed == 0;
+    }
+};
+
+//! Return the name of a TestpoTarget, e.g. "Moon"
+std::string to_string(TestpoTarget target);
+
+//! Return the name of a TestpoSource: "compiled", "resident", or "de_ascii"
+std::string to_string(TestpoSource source);
+
+/*!
+ * \brief Return the tolerance of a target
+ *
+ * \details The bodies use the 1e-13 threshold of JPL's testeph (1.5 cm), and 1e-15 AU/day for the velocities, which
+ * leaves about two orders of magnitude above the rounding error of the compiled-in DE430 tables. The angle psi of the
+ * librations grows by 0.23 rad/day, to about 5e4 rad at the end of the tables, so its tolerance is scaled up accordingly.
+ *
+ * \param target Target
+ *
+ * \return Tolerance of the target
+ */
+TestpoTolerance get_testpo_tolerance(TestpoTarget target);
+
+/*!
+ * \brief Read the records of a testpo file
+ *
+ * \details Lines up to and including the "EOT" line are the header, and every following line holds
+ * "de# date jed t# c# x# value".
+ *
+ * \param testpo_file Path to the testpo file
+ *
+ * \return Records, in the order of the file
+ *
+ * \throws std::invalid_argument If the file cannot be read, has no EOT line, or a record cannot be parsed
+ */
+std::vector<TestpoRecord> read_testpo(const std::string& testpo_file);
+
+/*!
+ * \brief Checks the library against the JPL reference values of a testpo file (e.g. testpo.430)
+ *
+ * \details The bodies are evaluated with EphemerisContext relative to the requested center, apart from the EMB, which is
+ * evaluated from the EMB table and differenced with the SSB-relative state of the other body. The positions and velocities
+ * are converted from km and km/s with the AU of DEConstants. The nutations and librations are evaluated with Nutation and
+ * LunarLibration, and their rates converted from rad/s. Records of other bodies are ignored, and records outside of the
+ * range of the tables are counted but not checked, since testpo covers the full span of the DE (1550 to 2650 for DE430).
+ *
+ * The bodies are split into contiguous blocks of records, one EphemerisContext per block, and evaluated on a ThreadPool.
+ *
+ * With TestpoSource::DEAscii, the Sun (column 10), EMB (column 2), and geocentric Moon (column 9) are read from the ASCII
+ * DE files, and the Earth relative to the EMB is derived from the Moon as -moon / (1 + emrat), which is how the DE
+ * integration defines the EMB. The tables are only read for the targets that need them.
+ */
+class TestpoChecker {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Load the tables to check
+         *
+         * \param options Settings of the checks
+         *
+         * \throws std::invalid_argument If the nutations or librations are requested from tables other than
+         *     TestpoSource::DEAscii, or the ASCII DE files cannot be read
+         */
+        explicit TestpoChecker(TestpoOptions options);
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compare the records of the requested targets against the library
+         *
+         * \param records Records of a testpo file
+         * \param failures Stream that the failed records are written to, or nullptr
+         *
+         * \return Summary of each requested target, in the order of TestpoOptions::targets
+         */
+        std::vector<TestpoSummary> run(const std::vector<TestpoRecord>& records, std::ostream* failures = nullptr);
+
+        //! Return the views of the tables of the bodies
+        const EphemerisTableSet& get_tables() const {
+            return tables_;
+        }
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Read the Sun, EMB, and Moon columns of the ASCII DE files, and derive the Earth from the EMB
+        void load_de_ascii_bodies();
+
+        //! Evaluate the bodies of records[begin, end), setting computed and in_range
+        void evaluate_bodies(const std::vector<const TestpoRecord*>& records, size_t begin, size_t end,
+                             std::vector<double>& computed, std::vector<char>& in_range) const;
+
+        //! Evaluate the nutations or librations of records, setting computed and in_range
+        void evaluate_angles(const std::vector<const TestpoRecord*>& records, std::vector<double>& computed,
+                             std::vector<char>& in_range);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Settings of the checks
+        TestpoOptions options_;
+
+        //! Copy of the compiled-in tables, with TestpoSource::Resident
+        std::unique_ptr<ResidentTables> resident_{};
+
+        //! Sun, EMB, and Moon tables, with TestpoSource::DEAscii
+        std::vector<DEAsciiTable> de_tables_{};
+
+        //! Rows of the Earth relative to the EMB, with TestpoSource::DEAscii
+        std::array<std::vector<double>, 3> earth_from_emb_rows_{};
+
+        //! Views of the tables of the bodies
+        EphemerisTableSet tables_{};
+
+        //! Nutations, if requested
+        std::optional<Nutation> nutation_{};
+
+        //! Librations, if requested
+        std::optional<LunarLibration> libration_{};
+
+        //! Threads evaluating the bodies
+        ThreadPool pool_;
+};
+
+}  // namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,122 @@
+// Standard Library Includes
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris_test Includes
+#include "jpl_ephemeris_test/testpo_checker.hpp"
+
+using namespace jpl_ephemeris;
+
+namespace {
+
+//! Every target, in the order of the codes
+const std::vector<TestpoTarget> ALL_TARGETS{TestpoTarget::Earth, TestpoTarget::Moon, TestpoTarget::Sun,
+                                            TestpoTarget::SSB,   TestpoTarget::EMB,  TestpoTarget::Nutations,
+                                            TestpoTarget::Librations};
+
+void print_usage(const char* exec) {
+    std::cout << "Usage: " << exec << " [-s source] [-t targets] [-H de_header] [-j num_threads] [-m max_reported]\n"
+              << "       testpo_file [de_data_files...]\n"
+              << "  -s  Tables to check: compiled (default), resident, or de_ascii\n"
+              << "  -t  Comma-separated targets: Earth, Moon, Sun, SSB, EMB, Nutations, Librations (default: the bodies)\n"
+              << "  -H  DE header file (e.g. header.430_572), required with -s de_ascii, which reads the tables from the\n"
+              << "      data files following testpo_file (e.g. ascp1950.430 ascp2050.430)\n"
+              << "  -j  Number of threads evaluating the bodies (default: one per hardware thread)\n"
+              << "  -m  Maximum number of failed records written out per target (default 20)\n"
+              << "Exits with a non-zero status if a record of a target differs from testpo by more than the tolerance of\n"
+              << "the target, or no record of a target is within the range of the tables.\n";
+}
+
+//! Parse a comma-separated list of target names, returning false on an unknown name
+bool parse_targets(const std::string& list, std::vector<TestpoTarget>& targets) {
+    targets.clear();
+    std::stringstream names(list);
+    std::string name;
+    while (std::getline(names, name, ',')) {
+        bool found = false;
+        for (TestpoTarget target : ALL_TARGETS) {
+            if (to_string(target) == name) {
+                targets.push_back(target);
+                found = true;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return !targets.empty();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    TestpoOptions options;
+    std::vector<std::string> positional;
+
+    for (int k = 1; k < argc; k++) {
+        std::string arg = argv[k];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (arg.empty() || arg[0] != '-') {
+            positional.push_back(arg);
+            continue;
+        }
+        if (k + 1 >= argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        const std::string value = argv[++k];
+        if (arg == "-s" && value == "compiled") {
+            options.source = TestpoSource::Compiled;
+        } else if (arg == "-s" && value == "resident") {
+            options.source = TestpoSource::Resident;
+        } else if (arg == "-s" && value == "de_ascii") {
+            options.source = TestpoSource::DEAscii;
+        } else if (arg == "-t" && parse_targets(value, options.targets)) {
+            continue;
+        } else if (arg == "-H") {
+            options.de_header = value;
+        } else if (arg == "-j") {
+            options.num_threads = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (arg == "-m") {
+            options.max_reported = std::strtoull(value.c_str(), nullptr, 10);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (positional.empty() || (options.source == TestpoSource::DEAscii && (options.de_header.empty()
+                                                                            || positional.size() < 2))) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    options.de_data_files.assign(positional.begin() + 1, positional.end());
+
+    bool passed = true;
+    try {
+        const std::vector<TestpoRecord> records = read_testpo(positional[0]);
+        TestpoChecker checker(options);
+
+        for (const TestpoSummary& summary : checker.run(records, &std::cout)) {
+            const bool is_angle = summary.target == TestpoTarget::Nutations || summary.target == TestpoTarget::Librations;
+            std::cout << to_string(options.source) << " " << to_string(summary.target) << ": "
+                      << (summary.passed() ? "passed" : "FAILED") << ", " << summary.num_checked << " checked, "
+                      << summary.num_failed << " failed, " << summary.num_out_of_range << " outside the tables, max error "
+                      << summary.max_position_error << (is_angle ? " rad" : " AU") << " (tolerance "
+                      << summary.tolerance.position << "), " << summary.max_velocity_error
+                      << (is_angle ? " rad/day" : " AU/day") << " (tolerance " << summary.tolerance.velocity << ")\n";
+            passed = passed && summary.passed();
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+#ifndef JPL_EPHEMERISD_DAEMON_PROTOCOL_HPP
+#define JPL_EPHEMERISD_DAEMON_PROTOCOL_HPP
+
+/*!
+ * \file jpl_ephemerisd/daemon_protocol.hpp
+ * \brief Wire protocol shared by the jpl_ephemerisd query daemon and its client library
+ *
+ * \details The daemon only serves processes on the same node, so every message uses the native byte order and layout.
+ * Each request is a RequestHeader, optionally followed by a payload, and is answered by a ResponseHeader, followed by
+ * either the results or an error message.
+ *
+ * - Inline requests (use_shm = 0) are followed by num_epochs doubles, and the results follow the response header. They
+ *   hold at most DAEMON_MAX_INLINE_EPOCHS epochs, so clients split larger inline batches into several requests.
+ * - Shared-memory requests (use_shm = 1) carry no payload. The epochs are read from the attached segment at shm_offset,
+ *   and the results are written to the segment directly after them, so only the headers cross the socket.
+ * - An AttachSharedMemory request is followed by name_length bytes holding the POSIX shared-memory name of a segment of
+ *   shm_size bytes, which the daemon maps for the rest of the connection.
+ *
+ * Requests on one connection are answered in order, so a client can have several shared-memory requests in flight, as
+ * long as their regions of the segment do not overlap.
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <cstdint>
+
+namespace jpl_ephemeris {
+
+//! Default path of the UNIX domain socket the daemon listens on
+inline constexpr const char* DAEMON_DEFAULT_SOCKET_PATH = "/tmp/jpl_ephemerisd.sock";
+
+//! Magic value at the start of every header ("JPLE")
+inline constexpr uint32_t DAEMON_MAGIC = 0x454C504A;
+
+//! Maximum length of an error message or shared-memory name
+inline constexpr uint32_t DAEMON_MAX_STRING_LENGTH = 255;
+
+//! Maximum number of epochs of an inline request, which bounds the daemon's buffers to 3.5 MiB per connection
+inline constexpr uint64_t DAEMON_MAX_INLINE_EPOCHS = uint64_t(1) << 16;
+
+//! Type of a request sent to the daemon
+enum class DaemonRequestType : uint32_t {
+    Positions = 0,           //!< Positions [km], 3 values per epoch
+    Velocities = 1,          //!< Velocities [km/s], 3 values per epoch
+    States = 2,              //!< Positions [km] and velocities [km/s], 6 values per epoch
+    AttachSharedMemory = 3,  //!< Map a shared-memory segment for the rest of the connection
+};
+
+//! Status of a response from the daemon
+enum class DaemonStatus : uint32_t {
+    Ok = 0,               //!< Request succeeded
+    InvalidArgument = 1,  //!< Unexpected body, request type, or malformed request
+    OutOfRange = 2,       //!< Epoch outside of the tables, or region outside of the shared-memory segment
+    Error = 3,            //!< Any other failure
+};
+
+//! Header of every request sent to the daemon
+struct DaemonRequestHeader {
+    //! Must equal DAEMON_MAGIC
+    uint32_t magic = DAEMON_MAGIC;
+
+    //! DaemonRequestType of the request
+    uint32_t type = 0;
+
+    //! CentralBody whose position/velocity is computed
+    int32_t target = 0;
+
+    //! CentralBody that the target is measured relative to
+    int32_t central_body = 0;
+
+    //! Number of epochs (MJD J2K TDB) in the request
+    uint64_t num_epochs = 0;
+
+    //! Byte offset of the epochs in the shared-memory segment, when use_shm is set
+    uint64_t shm_offset = 0;
+
+    //! Size of the shared-memory segment [bytes], for AttachSharedMemory requests
+    uint64_t shm_size = 0;
+
+    //! Non-zero if the epochs and results are exchanged through the shared-memory segment
+    uint32_t use_shm = 0;
+
+    //! Length of the shared-memory name following an AttachSharedMemory request
+    uint32_t name_length = 0;
+};
+
+//! Header of every response sent by the daemon
+struct DaemonResponseHeader {
+    //! Must equal DAEMON_MAGIC
+    uint32_t magic = DAEMON_MAGIC;
+
+    //! DaemonStatus of the request
+    uint32_t status = 0;
+
+    //! Number of doubles in the results (inline or in the shared-memory segment)
+    uint64_t num_values = 0;
+
+    //! Length of the error message following the header, when status is not Ok
+    uint32_t message_length = 0;
+
+    //! Unused, keeps the header size a multiple of 8 bytes
+    uint32_t reserved = 0;
+};
+
+static_assert(sizeof(DaemonRequestHeader) == 48, "DaemonRequestHeader must not contain padding");
+static_assert(sizeof(DaemonResponseHeader) == 24, "DaemonResponseHeader must not contain padding");
+
+/*!
+ * \brief Return the number of result values per epoch for a request type
+ *
+ * \param type Request type
+ *
+ * \return Number of doubles per epoch, or zero if the request type does not return results
+ */
+inline size_t daemon_values_per_epoch(DaemonRequestType type) {
+    switch (type) {
+        case DaemonRequestType::Positions:
+        case DaemonRequestType::Velocities: {
+            return 3;
+        }
+        case DaemonRequestType::States: {
+            return 6;
+        }
+        default: {
+            return 0;
+        }
+    }
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif
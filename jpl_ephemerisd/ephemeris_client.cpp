@@ -0,0 +1,369 @@
+#include "ephemeris_client.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+
+// System Includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// jpl_ephemerisd Includes
+#include "jpl_ephemerisd/socket_io.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Number of pieces a large batch is split into, so pieces can be written while earlier ones are evaluated
+const size_t PIECES_PER_RING = 4;
+
+//! Region of the ring buffer holding one piece that is in flight
+struct RingSpan {
+    //! Byte offset of the piece in the segment
+    size_t offset = 0;
+
+    //! Number of bytes used by the epochs and results
+    size_t size = 0;
+
+    //! Index of the first epoch of the piece in the batch
+    size_t first_epoch = 0;
+
+    //! Number of epochs in the piece
+    size_t num_epochs = 0;
+};
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+EphemerisClient::EphemerisClient(const std::string& socket_path, size_t shm_capacity) :
+    fd_(-1), shm_(nullptr), shm_capacity_(0), shm_threshold_(DEFAULT_SHM_THRESHOLD) {
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        throw std::runtime_error("EphemerisClient() - Socket path is too long.");
+    }
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd_ < 0) {
+        throw std::runtime_error("EphemerisClient() - Unable to create socket.");
+    }
+    if (::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        close();
+        throw std::runtime_error("EphemerisClient() - Unable to connect to jpl_ephemerisd at " + socket_path + ".");
+    }
+
+    if (shm_capacity > 0) {
+        attach_shared_memory(shm_capacity);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EphemerisClient::~EphemerisClient() {
+    close();
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void EphemerisClient::get_positions(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                                    std::array<double, 3>* positions, CentralBody central_body) {
+    static_assert(sizeof(std::array<double, 3>) == 3 * sizeof(double), "std::array<double, 3> must not be padded");
+    request(DaemonRequestType::Positions, target, central_body, mjdj2k_tdb, num_epochs,
+            reinterpret_cast<double*>(positions));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::get_velocities(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                                     std::array<double, 3>* velocities, CentralBody central_body) {
+    request(DaemonRequestType::Velocities, target, central_body, mjdj2k_tdb, num_epochs,
+            reinterpret_cast<double*>(velocities));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::get_states(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                                 std::array<double, 6>* states, CentralBody central_body) {
+    static_assert(sizeof(std::array<double, 6>) == 6 * sizeof(double), "std::array<double, 6> must not be padded");
+    request(DaemonRequestType::States, target, central_body, mjdj2k_tdb, num_epochs, reinterpret_cast<double*>(states));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 3>> EphemerisClient::get_positions(CentralBody target,
+                                                                  const std::vector<double>& mjdj2k_tdb,
+                                                                  CentralBody central_body) {
+    std::vector<std::array<double, 3>> positions(mjdj2k_tdb.size());
+    get_positions(target, mjdj2k_tdb.data(), mjdj2k_tdb.size(), positions.data(), central_body);
+    return positions;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 3>> EphemerisClient::get_velocities(CentralBody target,
+                                                                   const std::vector<double>& mjdj2k_tdb,
+                                                                   CentralBody central_body) {
+    std::vector<std::array<double, 3>> velocities(mjdj2k_tdb.size());
+    get_velocities(target, mjdj2k_tdb.data(), mjdj2k_tdb.size(), velocities.data(), central_body);
+    return velocities;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::array<double, 6>> EphemerisClient::get_states(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                               CentralBody central_body) {
+    std::vector<std::array<double, 6>> states(mjdj2k_tdb.size());
+    get_states(target, mjdj2k_tdb.data(), mjdj2k_tdb.size(), states.data(), central_body);
+    return states;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::attach_shared_memory(size_t capacity) {
+    // Unique name per process and client
+    static std::atomic<unsigned int> counter{0};
+    std::string name = "/jpl_ephemerisd." + std::to_string(::getpid()) + "." + std::to_string(counter++);
+
+    int shm_fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (shm_fd < 0) {
+        return;
+    }
+
+    void* ptr = MAP_FAILED;
+    if (::ftruncate(shm_fd, static_cast<off_t>(capacity)) == 0) {
+        ptr = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+    }
+    ::close(shm_fd);
+    if (ptr == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        return;
+    }
+
+    DaemonRequestHeader header;
+    header.type        = static_cast<uint32_t>(DaemonRequestType::AttachSharedMemory);
+    header.shm_size    = capacity;
+    header.name_length = static_cast<uint32_t>(name.size());
+
+    bool attached = socket_write_all(fd_, &header, sizeof(header)) && socket_write_all(fd_, name.data(), name.size());
+    if (attached) {
+        try {
+            read_response();
+        } catch (const std::invalid_argument&) {
+            attached = false;
+        } catch (const std::out_of_range&) {
+            attached = false;
+        }
+    }
+
+    // Both processes have the segment mapped (or the attach failed), so the name is no longer needed
+    ::shm_unlink(name.c_str());
+
+    if (!attached) {
+        ::munmap(ptr, capacity);
+        return;
+    }
+    shm_          = static_cast<char*>(ptr);
+    shm_capacity_ = capacity;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::request(DaemonRequestType type, CentralBody target, CentralBody central_body,
+                              const double* mjdj2k_tdb, size_t num_epochs, double* out) {
+    if (fd_ < 0) {
+        throw std::runtime_error("EphemerisClient::request() - Not connected to jpl_ephemerisd.");
+    }
+    if (num_epochs == 0) {
+        return;
+    }
+
+    size_t bytes_per_epoch = sizeof(double) * (1 + daemon_values_per_epoch(type));
+    if (shm_ != nullptr && num_epochs >= shm_threshold_ && shm_capacity_ >= bytes_per_epoch) {
+        request_shm(type, target, central_body, mjdj2k_tdb, num_epochs, out);
+    } else {
+        request_inline(type, target, central_body, mjdj2k_tdb, num_epochs, out);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::request_inline(DaemonRequestType type, CentralBody target, CentralBody central_body,
+                                     const double* mjdj2k_tdb, size_t num_epochs, double* out) {
+    size_t values_per_epoch = daemon_values_per_epoch(type);
+
+    // The daemon rejects inline requests above DAEMON_MAX_INLINE_EPOCHS, so send the batch in chunks
+    for (size_t first_epoch = 0; first_epoch < num_epochs; first_epoch += DAEMON_MAX_INLINE_EPOCHS) {
+        size_t count = std::min<size_t>(DAEMON_MAX_INLINE_EPOCHS, num_epochs - first_epoch);
+
+        DaemonRequestHeader header;
+        header.type         = static_cast<uint32_t>(type);
+        header.target       = static_cast<int32_t>(target);
+        header.central_body = static_cast<int32_t>(central_body);
+        header.num_epochs   = count;
+
+        if (!socket_write_all(fd_, &header, sizeof(header))
+            || !socket_write_all(fd_, mjdj2k_tdb + first_epoch, count * sizeof(double))) {
+            close();
+            throw std::runtime_error("EphemerisClient::request() - Lost connection to jpl_ephemerisd.");
+        }
+
+        DaemonResponseHeader response = read_response();
+        if (response.num_values != count * values_per_epoch
+            || !socket_read_all(fd_, out + first_epoch * values_per_epoch, response.num_values * sizeof(double))) {
+            close();
+            throw std::runtime_error("EphemerisClient::request() - Unexpected response from jpl_ephemerisd.");
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::request_shm(DaemonRequestType type, CentralBody target, CentralBody central_body,
+                                  const double* mjdj2k_tdb, size_t num_epochs, double* out) {
+    size_t values_per_epoch = daemon_values_per_epoch(type);
+    size_t bytes_per_epoch  = sizeof(double) * (1 + values_per_epoch);
+    size_t piece_epochs     = std::max<size_t>(1, shm_capacity_ / PIECES_PER_RING / bytes_per_epoch);
+
+    // Pieces in flight, oldest first. The ring is empty when no pieces are in flight.
+    std::deque<RingSpan> in_flight;
+    size_t tail = 0;
+
+    // Find room for size bytes after the newest piece, wrapping to the start of the segment if needed
+    auto allocate = [&](size_t size, size_t& offset) {
+        if (in_flight.empty()) {
+            offset = 0;
+            return size <= shm_capacity_;
+        }
+        size_t head = in_flight.front().offset;
+        if (tail > head) {
+            if (tail + size <= shm_capacity_) {
+                offset = tail;
+                return true;
+            }
+            offset = 0;
+            return size <= head;
+        }
+        offset = tail;
+        return tail + size <= head;
+    };
+
+    // Wait for the oldest piece, and copy its results out of the segment
+    std::exception_ptr error;
+    auto collect = [&]() {
+        RingSpan span = in_flight.front();
+        in_flight.pop_front();
+        try {
+            DaemonResponseHeader response = read_response();
+            if (response.num_values != span.num_epochs * values_per_epoch) {
+                close();
+                throw std::runtime_error("EphemerisClient::request() - Unexpected response from jpl_ephemerisd.");
+            }
+            std::memcpy(out + span.first_epoch * values_per_epoch, shm_ + span.offset + span.num_epochs * sizeof(double),
+                        response.num_values * sizeof(double));
+        } catch (const std::runtime_error&) {
+            throw;
+        } catch (...) {
+            // Keep draining the pieces in flight, so the connection stays in sync, then rethrow
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    size_t next_epoch = 0;
+    while (next_epoch < num_epochs || !in_flight.empty()) {
+        size_t offset = 0;
+        size_t count  = std::min(piece_epochs, num_epochs - next_epoch);
+        size_t size   = count * bytes_per_epoch;
+        if (next_epoch < num_epochs && !error && allocate(size, offset)) {
+            std::memcpy(shm_ + offset, mjdj2k_tdb + next_epoch, count * sizeof(double));
+
+            DaemonRequestHeader header;
+            header.type         = static_cast<uint32_t>(type);
+            header.target       = static_cast<int32_t>(target);
+            header.central_body = static_cast<int32_t>(central_body);
+            header.num_epochs   = count;
+            header.shm_offset   = offset;
+            header.use_shm      = 1;
+            if (!socket_write_all(fd_, &header, sizeof(header))) {
+                close();
+                throw std::runtime_error("EphemerisClient::request() - Lost connection to jpl_ephemerisd.");
+            }
+
+            in_flight.push_back(RingSpan{offset, size, next_epoch, count});
+            tail = offset + size;
+            next_epoch += count;
+        } else if (!in_flight.empty()) {
+            collect();
+        } else {
+            // An earlier piece failed, and every piece in flight has been drained
+            break;
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+DaemonResponseHeader EphemerisClient::read_response() {
+    DaemonResponseHeader response;
+    if (!socket_read_all(fd_, &response, sizeof(response)) || response.magic != DAEMON_MAGIC) {
+        close();
+        throw std::runtime_error("EphemerisClient::request() - Lost connection to jpl_ephemerisd.");
+    }
+
+    if (response.status == static_cast<uint32_t>(DaemonStatus::Ok)) {
+        return response;
+    }
+
+    std::string message(std::min(response.message_length, DAEMON_MAX_STRING_LENGTH), '\0');
+    if (!socket_read_all(fd_, message.data(), message.size())) {
+        close();
+        throw std::runtime_error("EphemerisClient::request() - Lost connection to jpl_ephemerisd.");
+    }
+
+    switch (static_cast<DaemonStatus>(response.status)) {
+        case DaemonStatus::InvalidArgument: {
+            throw std::invalid_argument(message);
+        }
+        case DaemonStatus::OutOfRange: {
+            throw std::out_of_range(message);
+        }
+        default: {
+            throw std::runtime_error(message);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisClient::close() {
+    if (shm_ != nullptr) {
+        ::munmap(shm_, shm_capacity_);
+        shm_          = nullptr;
+        shm_capacity_ = 0;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+}  // End namespace jpl_ephemeris
@@ -0,0 +1,199 @@
+#ifndef JPL_EPHEMERISD_EPHEMERIS_CLIENT_HPP
+#define JPL_EPHEMERISD_EPHEMERIS_CLIENT_HPP
+
+/*!
+ * \file jpl_ephemerisd/ephemeris_client.hpp
+ * \brief Client for the jpl_ephemerisd query daemon
+ */
+
+// Standard Library Includes
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/central_body.hpp"
+#include "jpl_ephemerisd/daemon_protocol.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Client for the jpl_ephemerisd query daemon
+ *
+ * \details Small batches are sent inline over the UNIX domain socket. When shared memory is available, batches of at
+ * least get_shm_threshold() epochs are exchanged through a shared-memory segment used as a ring buffer: the batch is
+ * split into pieces, and the next piece is written while the daemon evaluates the previous ones, so only the request
+ * and response headers cross the socket.
+ *
+ * The client only links against this small library, not the ephemeris tables. A client is not thread safe; use one per
+ * thread.
+ */
+class EphemerisClient {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Connect to the daemon
+         *
+         * \param socket_path Path of the daemon's UNIX domain socket
+         * \param shm_capacity Size of the shared-memory ring buffer [bytes]. Zero disables the shared-memory path, which
+         *     is also disabled if the segment cannot be created or attached.
+         *
+         * \throws std::runtime_error If the connection to the daemon fails
+         */
+        explicit EphemerisClient(const std::string& socket_path = DAEMON_DEFAULT_SOCKET_PATH,
+                                 size_t shm_capacity = DEFAULT_SHM_CAPACITY);
+
+        //! Close the connection and unmap the shared-memory segment
+        ~EphemerisClient();
+
+        //! Delete the copy constructor
+        EphemerisClient(const EphemerisClient&) = delete;
+
+        //! Delete the copy assignment operator
+        EphemerisClient& operator=(const EphemerisClient&) = delete;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Compute the position of the target body relative to the specified CentralBody at each epoch
+         *
+         * \param target Body whose position is computed
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param positions Output positions in the GCRF frame [km], one per epoch
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If the daemon rejects target or central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         * \throws std::runtime_error If the connection to the daemon fails
+         */
+        void get_positions(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                           std::array<double, 3>* positions, CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Compute the velocity of the target body relative to the specified CentralBody at each epoch
+         *
+         * \param target Body whose velocity is computed
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param velocities Output velocities in the GCRF frame [km/s], one per epoch
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If the daemon rejects target or central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         * \throws std::runtime_error If the connection to the daemon fails
+         */
+        void get_velocities(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs,
+                            std::array<double, 3>* velocities, CentralBody central_body = CentralBody::Earth);
+
+        /*!
+         * \brief Compute the position and velocity of the target body relative to the specified CentralBody at each epoch
+         *
+         * \param target Body whose state is computed
+         * \param mjdj2k_tdb Modified Julian Dates from the J2000 Epoch, in the TDB Time System
+         * \param num_epochs Number of epochs
+         * \param states Output states in the GCRF frame, stacked as [x, y, z, vx, vy, vz] in [km] and [km/s]
+         * \param central_body Central body that the target is measured relative to
+         *
+         * \throws std::invalid_argument If the daemon rejects target or central_body
+         * \throws std::out_of_range If any epoch is outside of the range covered by the tables
+         * \throws std::runtime_error If the connection to the daemon fails
+         */
+        void get_states(CentralBody target, const double* mjdj2k_tdb, size_t num_epochs, std::array<double, 6>* states,
+                        CentralBody central_body = CentralBody::Earth);
+
+        //! \copydoc get_positions(CentralBody, const double*, size_t, std::array<double, 3>*, CentralBody)
+        std::vector<std::array<double, 3>> get_positions(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                         CentralBody central_body = CentralBody::Earth);
+
+        //! \copydoc get_velocities(CentralBody, const double*, size_t, std::array<double, 3>*, CentralBody)
+        std::vector<std::array<double, 3>> get_velocities(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                          CentralBody central_body = CentralBody::Earth);
+
+        //! \copydoc get_states(CentralBody, const double*, size_t, std::array<double, 6>*, CentralBody)
+        std::vector<std::array<double, 6>> get_states(CentralBody target, const std::vector<double>& mjdj2k_tdb,
+                                                      CentralBody central_body = CentralBody::Earth);
+
+        //! Return true if the shared-memory path is available
+        bool has_shared_memory() const {
+            return shm_ != nullptr;
+        }
+
+        //! Return the minimum number of epochs for a batch to use the shared-memory path
+        size_t get_shm_threshold() const {
+            return shm_threshold_;
+        }
+
+        /*!
+         * \brief Set the minimum number of epochs for a batch to use the shared-memory path
+         *
+         * \param num_epochs Minimum number of epochs
+         */
+        void set_shm_threshold(size_t num_epochs) {
+            shm_threshold_ = num_epochs;
+        }
+
+        //! Default size of the shared-memory ring buffer [bytes]
+        static constexpr size_t DEFAULT_SHM_CAPACITY = 64 * 1024 * 1024;
+
+        //! Default minimum number of epochs for a batch to use the shared-memory path
+        static constexpr size_t DEFAULT_SHM_THRESHOLD = 4096;
+
+    private:
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Create a shared-memory segment and ask the daemon to map it, leaving shm_ null on failure
+        void attach_shared_memory(size_t capacity);
+
+        //! Send a request using the inline or shared-memory path
+        void request(DaemonRequestType type, CentralBody target, CentralBody central_body, const double* mjdj2k_tdb,
+                     size_t num_epochs, double* out);
+
+        //! Send a request with the epochs and results inline on the socket
+        void request_inline(DaemonRequestType type, CentralBody target, CentralBody central_body,
+                            const double* mjdj2k_tdb, size_t num_epochs, double* out);
+
+        //! Send a request through the shared-memory ring buffer, pipelining pieces of the batch
+        void request_shm(DaemonRequestType type, CentralBody target, CentralBody central_body, const double* mjdj2k_tdb,
+                         size_t num_epochs, double* out);
+
+        /*!
+         * \brief Read a response header, throwing the matching exception if it reports an error
+         *
+         * \return Response header
+         */
+        DaemonResponseHeader read_response();
+
+        //! Close the socket and unmap the segment
+        void close();
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Socket connected to the daemon
+        int fd_;
+
+        //! Mapped shared-memory segment, or null if the shared-memory path is disabled
+        char* shm_;
+
+        //! Size of the shared-memory segment [bytes]
+        size_t shm_capacity_;
+
+        //! Minimum number of epochs for a batch to use the shared-memory path
+        size_t shm_threshold_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
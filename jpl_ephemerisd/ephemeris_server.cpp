@@ -0,0 +1,374 @@
+#include "ephemeris_server.hpp"
+
+// Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+// System Includes
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/ephemeris_tables/moon_gcrf_table.hpp"
+#include "jpl_ephemerisd/socket_io.hpp"
+
+namespace jpl_ephemeris {
+
+namespace {
+
+//! Evaluate every granule of every table once, so that the tables are resident before the first request
+void warm_up_tables() {
+    EphemerisContext context;
+    const EphemerisTableView moon = MoonGCRFTable::get_table_view();
+
+    // The Sun relative to the Moon uses all four tables, and the Moon granules are the shortest
+    for (unsigned int ind = 0; ind < moon.num_granules; ind++) {
+        const double* row = moon.get_row(0, ind);
+        context.get_state(CentralBody::Sun, 0.5 * (row[0] + row[1]), CentralBody::Moon);
+    }
+}
+
+}  // namespace
+
+//---------------------------------------
+// Constructors
+//---------------------------------------
+
+EphemerisServer::EphemerisServer(const std::string& socket_path, unsigned int num_threads, size_t batch_threshold) :
+    socket_path_(socket_path), listen_fd_(-1), stop_pipe_{-1, -1}, batch_(num_threads),
+    batch_threshold_(batch_threshold), connections_mutex_(), connections_(), finished_() {
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socket_path_.size() >= sizeof(addr.sun_path)) {
+        throw std::runtime_error("EphemerisServer() - Socket path is too long.");
+    }
+    std::strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+
+    warm_up_tables();
+
+    if (::pipe(stop_pipe_) != 0) {
+        throw std::runtime_error("EphemerisServer() - Unable to create the stop pipe.");
+    }
+
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) {
+        throw std::runtime_error("EphemerisServer() - Unable to create socket.");
+    }
+
+    ::unlink(socket_path_.c_str());
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(listen_fd_, 64) != 0) {
+        ::close(listen_fd_);
+        ::close(stop_pipe_[0]);
+        ::close(stop_pipe_[1]);
+        throw std::runtime_error("EphemerisServer() - Unable to listen on " + socket_path_ + ".");
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+EphemerisServer::~EphemerisServer() {
+    close_connections();
+    ::close(listen_fd_);
+    ::close(stop_pipe_[0]);
+    ::close(stop_pipe_[1]);
+    ::unlink(socket_path_.c_str());
+}
+
+//---------------------------------------
+// Class Methods
+//---------------------------------------
+
+void EphemerisServer::run() {
+    std::array<pollfd, 2> fds{pollfd{listen_fd_, POLLIN, 0}, pollfd{stop_pipe_[0], POLLIN, 0}};
+    while (true) {
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents != 0) {
+            break;
+        }
+        if ((fds[0].revents & POLLIN) == 0) {
+            continue;
+        }
+
+        int fd = ::accept(listen_fd_, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+
+        // Join the threads of connections that have closed since the last accept
+        for (std::thread& thread : finished_) {
+            thread.join();
+        }
+        finished_.clear();
+
+        connections_.emplace(fd, std::thread(&EphemerisServer::serve_connection, this, fd));
+    }
+
+    close_connections();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisServer::stop() {
+    char byte = 0;
+    ssize_t written = ::write(stop_pipe_[1], &byte, 1);
+    (void)written;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisServer::serve_connection(int fd) {
+    EphemerisContext context;
+    SharedMemory shm;
+    std::vector<double> epochs;
+    std::vector<double> values;
+
+    DaemonRequestHeader header;
+    while (socket_read_all(fd, &header, sizeof(header))) {
+        if (header.magic != DAEMON_MAGIC) {
+            send_error(fd, DaemonStatus::InvalidArgument, "jpl_ephemerisd - Unexpected magic value in request.");
+            break;
+        }
+
+        DaemonRequestType type = static_cast<DaemonRequestType>(header.type);
+        if (type == DaemonRequestType::AttachSharedMemory) {
+            if (header.name_length == 0 || header.name_length > DAEMON_MAX_STRING_LENGTH) {
+                send_error(fd, DaemonStatus::InvalidArgument, "jpl_ephemerisd - Invalid shared-memory name length.");
+                break;
+            }
+            std::string name(header.name_length, '\0');
+            if (!socket_read_all(fd, name.data(), name.size())) {
+                break;
+            }
+            try {
+                attach_shared_memory(header, name, shm);
+                send_ok(fd, 0);
+            } catch (const std::exception& error) {
+                send_error(fd, DaemonStatus::InvalidArgument, error.what());
+            }
+            continue;
+        }
+
+        size_t values_per_epoch = daemon_values_per_epoch(type);
+        if (values_per_epoch == 0) {
+            send_error(fd, DaemonStatus::InvalidArgument, "jpl_ephemerisd - Unexpected request type.");
+            break;
+        }
+        size_t num_values = header.num_epochs * values_per_epoch;
+
+        if (header.use_shm != 0) {
+            // The epochs and results must fit inside the attached segment, and the doubles must be aligned
+            size_t bytes = header.num_epochs * sizeof(double) * (1 + values_per_epoch);
+            if (shm.data == nullptr || header.shm_offset % sizeof(double) != 0 || header.shm_offset > shm.size
+                || header.num_epochs > shm.size || bytes > shm.size - header.shm_offset) {
+                send_error(fd, DaemonStatus::OutOfRange,
+                           "jpl_ephemerisd - Request does not fit inside the attached shared-memory segment.");
+                continue;
+            }
+
+            const double* in = reinterpret_cast<const double*>(shm.data + header.shm_offset);
+            double* out      = reinterpret_cast<double*>(shm.data + header.shm_offset) + header.num_epochs;
+            try {
+                evaluate(header, context, in, out);
+            } catch (const std::out_of_range& error) {
+                send_error(fd, DaemonStatus::OutOfRange, error.what());
+                continue;
+            } catch (const std::invalid_argument& error) {
+                send_error(fd, DaemonStatus::InvalidArgument, error.what());
+                continue;
+            }
+            if (!send_ok(fd, num_values)) {
+                break;
+            }
+            continue;
+        }
+
+        if (header.num_epochs > DAEMON_MAX_INLINE_EPOCHS) {
+            // The payload cannot be skipped without reading it, so the connection is closed
+            send_error(fd, DaemonStatus::InvalidArgument,
+                       "jpl_ephemerisd - Too many epochs for an inline request, use shared memory instead.");
+            break;
+        }
+
+        epochs.resize(header.num_epochs);
+        values.resize(num_values);
+        if (!socket_read_all(fd, epochs.data(), epochs.size() * sizeof(double))) {
+            break;
+        }
+        try {
+            evaluate(header, context, epochs.data(), values.data());
+        } catch (const std::out_of_range& error) {
+            send_error(fd, DaemonStatus::OutOfRange, error.what());
+            continue;
+        } catch (const std::invalid_argument& error) {
+            send_error(fd, DaemonStatus::InvalidArgument, error.what());
+            continue;
+        }
+        if (!send_ok(fd, num_values) || !socket_write_all(fd, values.data(), values.size() * sizeof(double))) {
+            break;
+        }
+    }
+
+    if (shm.data != nullptr) {
+        ::munmap(shm.data, shm.size);
+    }
+
+    // Hand the thread over to be joined, then release the socket so its descriptor can be reused
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        auto iter = connections_.find(fd);
+        if (iter != connections_.end()) {
+            finished_.push_back(std::move(iter->second));
+            connections_.erase(iter);
+        }
+    }
+    ::close(fd);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisServer::close_connections() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(connections_mutex_);
+        for (auto& [fd, thread] : connections_) {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+    }
+
+    // The connection threads move themselves to finished_ as they exit
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(connections_mutex_);
+            for (std::thread& thread : finished_) {
+                threads.push_back(std::move(thread));
+            }
+            finished_.clear();
+            if (connections_.empty()) {
+                break;
+            }
+        }
+        std::this_thread::yield();
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisServer::evaluate(const DaemonRequestHeader& header, EphemerisContext& context, const double* mjdj2k_tdb,
+                               double* out) {
+    static_assert(sizeof(std::array<double, 6>) == 6 * sizeof(double), "std::array<double, 6> must not be padded");
+
+    CentralBody target       = static_cast<CentralBody>(header.target);
+    CentralBody central_body = static_cast<CentralBody>(header.central_body);
+    size_t num_epochs        = header.num_epochs;
+    DaemonRequestType type   = static_cast<DaemonRequestType>(header.type);
+
+    if (num_epochs >= batch_threshold_) {
+        switch (type) {
+            case DaemonRequestType::Positions: {
+                batch_.get_positions(target, mjdj2k_tdb, num_epochs, reinterpret_cast<std::array<double, 3>*>(out),
+                                     central_body);
+                return;
+            }
+            case DaemonRequestType::Velocities: {
+                batch_.get_velocities(target, mjdj2k_tdb, num_epochs, reinterpret_cast<std::array<double, 3>*>(out),
+                                      central_body);
+                return;
+            }
+            default: {
+                batch_.get_states(target, mjdj2k_tdb, num_epochs, reinterpret_cast<std::array<double, 6>*>(out),
+                                  central_body);
+                return;
+            }
+        }
+    }
+
+    for (size_t k = 0; k < num_epochs; k++) {
+        switch (type) {
+            case DaemonRequestType::Positions: {
+                std::array<double, 3> pos = context.get_position(target, mjdj2k_tdb[k], central_body);
+                std::copy(pos.begin(), pos.end(), out + 3 * k);
+                break;
+            }
+            case DaemonRequestType::Velocities: {
+                std::array<double, 3> vel = context.get_velocity(target, mjdj2k_tdb[k], central_body);
+                std::copy(vel.begin(), vel.end(), out + 3 * k);
+                break;
+            }
+            default: {
+                std::array<double, 6> state = context.get_state(target, mjdj2k_tdb[k], central_body);
+                std::copy(state.begin(), state.end(), out + 6 * k);
+                break;
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void EphemerisServer::attach_shared_memory(const DaemonRequestHeader& header, const std::string& name,
+                                           SharedMemory& shm) {
+    int shm_fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (shm_fd < 0) {
+        throw std::invalid_argument("jpl_ephemerisd - Unable to open shared-memory segment " + name + ".");
+    }
+
+    struct stat info{};
+    if (::fstat(shm_fd, &info) != 0 || info.st_size < 0 || static_cast<uint64_t>(info.st_size) < header.shm_size) {
+        ::close(shm_fd);
+        throw std::invalid_argument("jpl_ephemerisd - Shared-memory segment is smaller than requested.");
+    }
+
+    void* ptr = ::mmap(nullptr, header.shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+    ::close(shm_fd);
+    if (ptr == MAP_FAILED) {
+        throw std::invalid_argument("jpl_ephemerisd - Unable to map shared-memory segment " + name + ".");
+    }
+
+    // Replace any segment attached earlier on this connection
+    if (shm.data != nullptr) {
+        ::munmap(shm.data, shm.size);
+    }
+    shm.data = static_cast<char*>(ptr);
+    shm.size = header.shm_size;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool EphemerisServer::send_ok(int fd, size_t num_values) {
+    DaemonResponseHeader response;
+    response.status     = static_cast<uint32_t>(DaemonStatus::Ok);
+    response.num_values = num_values;
+    return socket_write_all(fd, &response, sizeof(response));
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+bool EphemerisServer::send_error(int fd, DaemonStatus status, const std::string& message) {
+    DaemonResponseHeader response;
+    response.status         = static_cast<uint32_t>(status);
+    response.message_length = static_cast<uint32_t>(std::min<size_t>(message.size(), DAEMON_MAX_STRING_LENGTH));
+    return socket_write_all(fd, &response, sizeof(response))
+           && socket_write_all(fd, message.data(), response.message_length);
+}
+
+}  // End namespace jpl_ephemeris
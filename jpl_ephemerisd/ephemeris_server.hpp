@@ -0,0 +1,151 @@
+#ifndef JPL_EPHEMERISD_EPHEMERIS_SERVER_HPP
+#define JPL_EPHEMERISD_EPHEMERIS_SERVER_HPP
+
+/*!
+ * \file jpl_ephemerisd/ephemeris_server.hpp
+ * \brief Server of the jpl_ephemerisd query daemon
+ */
+
+// Standard Library Includes
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// jpl_ephemeris Includes
+#include "jpl_ephemeris/celestial_bodies/batch_ephemeris.hpp"
+#include "jpl_ephemeris/celestial_bodies/ephemeris_context.hpp"
+#include "jpl_ephemerisd/daemon_protocol.hpp"
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Server of the jpl_ephemerisd query daemon
+ *
+ * \details The tables are touched once at start-up, so they are resident before the first request. Every connection is
+ * served by its own thread with its own EphemerisContext; batches of at least get_batch_threshold() epochs are evaluated
+ * with a BatchEphemeris shared by all of the connections.
+ */
+class EphemerisServer {
+    public:
+
+        //---------------------------------------
+        // Constructors
+        //---------------------------------------
+
+        /*!
+         * \brief Warm up the tables and start listening on the socket
+         *
+         * \param socket_path Path of the UNIX domain socket. An existing socket file at this path is replaced.
+         * \param num_threads Number of threads used for large batches, zero uses the number of hardware threads
+         * \param batch_threshold Minimum number of epochs for a request to be evaluated in parallel
+         *
+         * \throws std::runtime_error If the socket cannot be created
+         */
+        EphemerisServer(const std::string& socket_path, unsigned int num_threads, size_t batch_threshold);
+
+        //! Stop serving, and remove the socket file
+        ~EphemerisServer();
+
+        //! Delete the copy constructor
+        EphemerisServer(const EphemerisServer&) = delete;
+
+        //! Delete the copy assignment operator
+        EphemerisServer& operator=(const EphemerisServer&) = delete;
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        /*!
+         * \brief Accept and serve connections until stop() is called
+         */
+        void run();
+
+        /*!
+         * \brief Make run() return, and close every connection
+         *
+         * \note Only writes to a pipe, so it is safe to call from a signal handler
+         */
+        void stop();
+
+        //! Return the minimum number of epochs for a request to be evaluated in parallel
+        size_t get_batch_threshold() const {
+            return batch_threshold_;
+        }
+
+    private:
+
+        //! Shared-memory segment mapped for a connection
+        struct SharedMemory {
+            //! Start of the mapping, or null if none is attached
+            char* data = nullptr;
+
+            //! Size of the mapping [bytes]
+            size_t size = 0;
+        };
+
+        //---------------------------------------
+        // Class Methods
+        //---------------------------------------
+
+        //! Serve the requests of one connection until it is closed
+        void serve_connection(int fd);
+
+        //! Shut down every open connection, and join all of the connection threads
+        void close_connections();
+
+        /*!
+         * \brief Evaluate a request
+         *
+         * \param header Request header
+         * \param context Granule cache of the connection
+         * \param mjdj2k_tdb Epochs of the request
+         * \param out Output values
+         */
+        void evaluate(const DaemonRequestHeader& header, EphemerisContext& context, const double* mjdj2k_tdb,
+                      double* out);
+
+        //! Map the shared-memory segment named in an AttachSharedMemory request
+        static void attach_shared_memory(const DaemonRequestHeader& header, const std::string& name, SharedMemory& shm);
+
+        //! Send a successful response header
+        static bool send_ok(int fd, size_t num_values);
+
+        //! Send an error response
+        static bool send_error(int fd, DaemonStatus status, const std::string& message);
+
+        //---------------------------------------
+        // Class Attributes
+        //---------------------------------------
+
+        //! Path of the UNIX domain socket
+        std::string socket_path_;
+
+        //! Listening socket
+        int listen_fd_;
+
+        //! Pipe used to wake up run() when stop() is called
+        int stop_pipe_[2];
+
+        //! Batch engine shared by all of the connections
+        BatchEphemeris batch_;
+
+        //! Minimum number of epochs for a request to be evaluated in parallel
+        size_t batch_threshold_;
+
+        //! Protects connections_
+        std::mutex connections_mutex_;
+
+        //! Threads serving the open connections, keyed by socket
+        std::map<int, std::thread> connections_;
+
+        //! Threads of connections that have closed, waiting to be joined
+        std::vector<std::thread> finished_;
+};
+
+}  // End namespace jpl_ephemeris
+
+#endif
@@ -0,0 +1,81 @@
+// Standard Library Includes
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// jpl_ephemerisd Includes
+#include "jpl_ephemerisd/ephemeris_server.hpp"
+
+using namespace jpl_ephemeris;
+
+namespace {
+
+//! Server stopped by SIGINT and SIGTERM
+EphemerisServer* g_server = nullptr;
+
+//! Signal handler, which only wakes up the accept loop
+void handle_signal(int) {
+    if (g_server != nullptr) {
+        g_server->stop();
+    }
+}
+
+void print_usage(const char* exec) {
+    std::cout << "Usage: " << exec << " [-s socket_path] [-t num_threads] [-b batch_threshold]\n"
+              << "  -s  Path of the UNIX domain socket (default " << DAEMON_DEFAULT_SOCKET_PATH << ")\n"
+              << "  -t  Number of threads used for large batches, 0 uses every hardware thread (default 0)\n"
+              << "  -b  Minimum number of epochs for a request to be evaluated in parallel (default 65536)\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string socket_path  = DAEMON_DEFAULT_SOCKET_PATH;
+    unsigned int num_threads = 0;
+    size_t batch_threshold   = 65536;
+
+    for (int k = 1; k < argc; k++) {
+        std::string arg = argv[k];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        if (k + 1 >= argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        if (arg == "-s") {
+            socket_path = argv[++k];
+        } else if (arg == "-t") {
+            num_threads = static_cast<unsigned int>(std::strtoul(argv[++k], nullptr, 10));
+        } else if (arg == "-b") {
+            batch_threshold = std::strtoull(argv[++k], nullptr, 10);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        EphemerisServer server(socket_path, num_threads, batch_threshold);
+        g_server = &server;
+
+        struct sigaction action{};
+        action.sa_handler = handle_signal;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGINT, &action, nullptr);
+        sigaction(SIGTERM, &action, nullptr);
+        std::signal(SIGPIPE, SIG_IGN);
+
+        std::cout << "jpl_ephemerisd listening on " << socket_path << std::endl;
+        server.run();
+        g_server = nullptr;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
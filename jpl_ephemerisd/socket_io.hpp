@@ -0,0 +1,75 @@
+#ifndef JPL_EPHEMERISD_SOCKET_IO_HPP
+#define JPL_EPHEMERISD_SOCKET_IO_HPP
+
+/*!
+ * \file jpl_ephemerisd/socket_io.hpp
+ * \brief Blocking helpers for reading and writing complete messages on a stream socket
+ */
+
+// Standard Library Includes
+#include <cerrno>
+#include <cstddef>
+
+// System Includes
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace jpl_ephemeris {
+
+/*!
+ * \brief Write all of the bytes to the socket, retrying on partial writes and interrupts
+ *
+ * \param fd Socket file descriptor
+ * \param data Bytes to write
+ * \param size Number of bytes to write
+ *
+ * \return True on success, false if the socket failed or was closed
+ */
+inline bool socket_write_all(int fd, const void* data, size_t size) {
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = ::send(fd, ptr, size, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        ptr += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+/*!
+ * \brief Read exactly size bytes from the socket, retrying on partial reads and interrupts
+ *
+ * \param fd Socket file descriptor
+ * \param data Output buffer
+ * \param size Number of bytes to read
+ *
+ * \return True on success, false if the socket failed or was closed before size bytes were read
+ */
+inline bool socket_read_all(int fd, void* data, size_t size) {
+    char* ptr = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t num_read = ::recv(fd, ptr, size, 0);
+        if (num_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (num_read == 0) {
+            return false;
+        }
+        ptr += num_read;
+        size -= static_cast<size_t>(num_read);
+    }
+    return true;
+}
+
+}  // End namespace jpl_ephemeris
+
+#endif